@@ -129,6 +129,7 @@ def test_properties_rw_base():
             (
                 (intel_auto.SchedulePolicy.ROUND_ROBIN, "SchedulePolicy.ROUND_ROBIN", 0),
                 (intel_auto.SchedulePolicy.DEVICE_PRIORITY, "SchedulePolicy.DEVICE_PRIORITY", 1),
+                (intel_auto.SchedulePolicy.SHORTEST_EXPECTED_DELAY, "SchedulePolicy.SHORTEST_EXPECTED_DELAY", 2),
                 (intel_auto.SchedulePolicy.DEFAULT, "SchedulePolicy.DEVICE_PRIORITY", 1),
             ),
         ),
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/core/node.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief Persistent storage of constant folding results.
+///
+/// Results are keyed by the hash of a foldable sub-graph: operation types, attributes, output types and shapes of
+/// every node and the data of the input Constants. Each entry is stored as a separate file in the cache directory,
+/// so the cache can be shared between processes. The entry also keeps the full description of the sub-graph with the
+/// content hashes of its inputs, which is compared on load, so colliding keys don't return wrong constants. The least
+/// recently used entries are removed when the size of the cache exceeds the limit.
+class OPENVINO_API ConstantFoldCache {
+public:
+    using Key = uint64_t;
+    using KeyMap = std::unordered_map<const Node*, std::optional<Key>>;
+
+    /// \brief Creates cache.
+    ///
+    /// \param cache_dir  Directory where folded constants are stored. Created if not exists.
+    /// \param min_size   Minimal size in bytes of folded outputs worth to be cached.
+    /// \param max_size   Maximal size in bytes of all entries in the cache directory, 0 means unlimited.
+    explicit ConstantFoldCache(std::filesystem::path cache_dir, size_t min_size = 4096, size_t max_size = 0);
+
+    /// \brief Checks whether node itself can be a part of the cached sub-graph. Node inputs are not checked.
+    static bool can_be_cached(const Node* node);
+
+    /// \brief Computes key of the sub-graph which produces node outputs.
+    ///
+    /// \param node  Root of the foldable sub-graph.
+    /// \param keys  Memoized keys of already visited nodes. Nodes which can't be cached are stored with empty key.
+    ///
+    /// \return Key of the sub-graph or empty if the sub-graph can't be cached.
+    std::optional<Key> compute_key(const Node* node, KeyMap& keys) const;
+
+    /// \brief Describes the sub-graph which produces node outputs: operation types, attributes, connections, output
+    ///        types and shapes of the nodes and the content hashes of the input Constants.
+    ///
+    /// \param node  Root of the foldable sub-graph, it must have a key.
+    /// \param keys  Keys computed by compute_key for the node.
+    static std::string describe(const Node* node, const KeyMap& keys);
+
+    /// \brief Checks whether node outputs are large enough to be cached.
+    bool is_worth_caching(const Node* node) const;
+
+    /// \brief Loads folded outputs of node stored with given key.
+    ///
+    /// The entry is used only if it was stored for the same sub-graph description, and holds the outputs of the
+    /// node's types and shapes. Corrupted or truncated entries are ignored.
+    ///
+    /// \return Constants for every output or empty vector if there is no matching entry.
+    OutputVector load(Key key, const Node* node, const std::string& description) const;
+
+    /// \brief Stores folded outputs of the sub-graph with given key. Outputs which are not Constants are not stored.
+    void store(Key key, const std::string& description, const OutputVector& outputs) const;
+
+    const std::filesystem::path& get_cache_dir() const {
+        return m_cache_dir;
+    }
+
+private:
+    std::filesystem::path get_entry_path(Key key) const;
+    void evict(const std::filesystem::path& stored_path) const;
+
+    std::filesystem::path m_cache_dir;
+    size_t m_min_size;
+    size_t m_max_size;
+};
+
+/// \brief Sets process-wide constant folding cache used by ov::pass::ConstantFolding. Pass nullptr to disable it.
+///        The cache is disabled by default.
+OPENVINO_API void set_constant_fold_cache(std::shared_ptr<ConstantFoldCache> cache);
+
+/// \brief Returns constant folding cache of the current thread set by ConstantFoldCacheScope, otherwise the
+///        process-wide one, or nullptr if the cache is disabled.
+OPENVINO_API std::shared_ptr<ConstantFoldCache> get_constant_fold_cache();
+
+/// \brief Sets constant folding cache of the current thread for the lifetime of the scope, e.g. for a compilation
+///        with ov::constant_folding_cache_size set. It takes precedence over the process-wide cache.
+class OPENVINO_API ConstantFoldCacheScope {
+public:
+    explicit ConstantFoldCacheScope(std::shared_ptr<ConstantFoldCache> cache);
+    ~ConstantFoldCacheScope();
+
+    ConstantFoldCacheScope(const ConstantFoldCacheScope&) = delete;
+    ConstantFoldCacheScope& operator=(const ConstantFoldCacheScope&) = delete;
+
+private:
+    std::shared_ptr<ConstantFoldCache> m_previous;
+};
+
+}  // namespace util
+}  // namespace ov
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <filesystem>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -33,6 +35,23 @@ public:
         return m_data_hash;
     }
 
+protected:
+    /// @brief Returns offset (relative to the blob start) where the next unique blob will be placed.
+    virtual FilePosition get_write_offset() const;
+
+    /// @brief Stores a unique (not deduplicated) blob at the given offset. The default implementation appends it to
+    /// the output stream.
+    /// @param offset             Offset relative to the blob start, as returned by get_write_offset().
+    /// @param data               Pointer to the blob data.
+    /// @param size               Size of the blob in bytes.
+    /// @param data_holder        Owner of the data if it was produced by the writer itself (e.g. FP16 compression).
+    /// @param data_is_temporary  The data pointer is not valid after write() returns.
+    virtual void write_blob(FilePosition offset,
+                            const char* data,
+                            size_t size,
+                            std::unique_ptr<char[]> data_holder,
+                            bool data_is_temporary);
+
 private:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
@@ -45,4 +64,47 @@ private:
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
 };
+
+/**
+ * @brief Constant writer which produces the same binary output as ConstantWriter, but defers writing of the blobs.
+ * Offsets are assigned in call order, while the data is written with several positional file handles in parallel
+ * into a preallocated file. Blobs owned by the writer are flushed once their total size exceeds a threshold to keep
+ * memory usage bounded. flush() must be called before the file is used.
+ */
+class OPENVINO_API ParallelConstantWriter : public ConstantWriter {
+public:
+    /// @brief Creates writer.
+    /// @param bin_data            Stream opened for bin_path. It must not be written by anyone else while the writer
+    ///                            is in use.
+    /// @param bin_path            Path of the file the stream writes to.
+    /// @param enable_compression  Enables deduplication of constants.
+    ParallelConstantWriter(std::ostream& bin_data, std::filesystem::path bin_path, bool enable_compression = true);
+    ~ParallelConstantWriter() override;
+
+    /// @brief Writes all pending blobs to the file.
+    void flush();
+
+protected:
+    FilePosition get_write_offset() const override;
+
+    void write_blob(FilePosition offset,
+                    const char* data,
+                    size_t size,
+                    std::unique_ptr<char[]> data_holder,
+                    bool data_is_temporary) override;
+
+private:
+    struct PendingBlob {
+        FilePosition offset;
+        const char* data;
+        size_t size;
+        std::unique_ptr<char[]> data_holder;
+    };
+
+    std::filesystem::path m_bin_path;
+    FilePosition m_stream_offset;  // position of the blob start in the file
+    FilePosition m_write_offset;
+    std::vector<PendingBlob> m_pending_blobs;
+    size_t m_pending_owned_size;
+};
 }  // namespace ov::util
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/validate.hpp"
 
 namespace ov {
@@ -80,6 +81,16 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Enables collection of the execution profile of the passes during run_passes call.
+    /// The profile includes nested Managers and MatcherPasses executed inside GraphRewrite.
+    /// \param enable Value "true" enables profiling; "false", otherwise
+    void enable_profiling(bool enable = true);
+
+    /// \return Profile collected during the last run_passes call with enabled profiling.
+    const PassProfile& get_profile() const {
+        return m_profile;
+    }
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -108,6 +119,9 @@ protected:
     std::string m_name = "UnnamedManager";
 
 private:
+    bool m_profiling = false;
+    PassProfile m_profile;
+
     bool run_pass(const std::shared_ptr<PassBase>& pass, const std::shared_ptr<Model>& model);
 };
 }  // namespace pass
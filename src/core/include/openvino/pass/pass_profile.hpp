@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+/**
+ * @brief Execution profile of a transformation pass collected by pass::Manager.
+ *
+ * Profiles are hierarchical: children of a Manager are the executed passes, children of a pass are nested Managers
+ * run by the pass and MatcherPasses executed inside GraphRewrite.
+ * @ingroup ov_pass_cpp_api
+ */
+struct PassProfile {
+    /// @brief Name of the pass or Manager.
+    std::string name;
+    /// @brief Start time of the execution, steady clock time since epoch.
+    std::chrono::nanoseconds start_time{0};
+    /// @brief Wall time of the execution. For MatcherPasses it is accumulated over all applications.
+    std::chrono::nanoseconds duration{0};
+    /// @brief Number of nodes processed by GraphRewrite.
+    size_t nodes_visited = 0;
+    /// @brief Number of times a MatcherPass was applied to a node.
+    size_t matcher_calls = 0;
+    /// @brief Number of times a MatcherPass callback changed the model.
+    size_t matcher_hits = 0;
+    /// @brief True if the pass changed the model.
+    bool changed_model = false;
+    /// @brief Nested profiles in execution order.
+    std::vector<PassProfile> children;
+};
+
+/**
+ * @brief Writes the profile in Chrome Trace Event format (can be opened in chrome://tracing or Perfetto).
+ * @param profile Profile to write.
+ * @param stream Output stream.
+ * @ingroup ov_pass_cpp_api
+ */
+OPENVINO_API void write_chrome_trace(const PassProfile& profile, std::ostream& stream);
+
+}  // namespace pass
+}  // namespace ov
@@ -0,0 +1,502 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/constant_fold_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace util {
+namespace {
+constexpr uint64_t cache_entry_magic = 0x4643564f;  // "OVCF"
+constexpr uint64_t cache_entry_version = 3;
+constexpr const char cache_entry_extension[] = ".ovcf";
+
+uint64_t hash_string(std::string_view str) {
+    return std::hash<std::string_view>{}(str);
+}
+
+// compute_hash is fast but weak, so it is combined with a second hash to make collisions of different data unlikely
+uint64_t hash_data(const void* data, size_t size) {
+    const auto seed = ov::runtime::compute_hash(data, size);
+    return u64_hash_combine(seed, hash_string({static_cast<const char*>(data), size}));
+}
+
+template <class T, typename std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
+void append(std::string& str, const T& value) {
+    str.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void append(std::string& str, const std::string& value) {
+    append(str, static_cast<uint64_t>(value.size()));
+    str.append(value);
+}
+
+template <class T>
+void append(std::string& str, const std::vector<T>& values) {
+    append(str, static_cast<uint64_t>(values.size()));
+    for (const auto& value : values) {
+        append(str, value);
+    }
+}
+
+void append_output_descriptions(std::string& str, const Node* node) {
+    for (const auto& output : node->outputs()) {
+        append(str, output.get_element_type().get_type_name());
+        append(str, std::vector<uint64_t>(output.get_shape().begin(), output.get_shape().end()));
+    }
+}
+
+#define SERIALIZE_ACCESSOR(type)                                                      \
+    void on_adapter(const std::string& name, ValueAccessor<type>& adapter) override { \
+        append(m_result, name);                                                       \
+        append(m_result, adapter.get());                                              \
+    }
+
+#define SERIALIZE_ACCESSOR_V(type) SERIALIZE_ACCESSOR(type) SERIALIZE_ACCESSOR(std::vector<type>)
+
+/// \brief Serializes node attributes. Attributes of types which can't be serialized make the node not cacheable.
+class AttributeSerializer : public ov::AttributeVisitor {
+public:
+    SERIALIZE_ACCESSOR(bool)
+    SERIALIZE_ACCESSOR_V(std::string)
+    SERIALIZE_ACCESSOR_V(int8_t)
+    SERIALIZE_ACCESSOR_V(int16_t)
+    SERIALIZE_ACCESSOR_V(int32_t)
+    SERIALIZE_ACCESSOR_V(int64_t)
+    SERIALIZE_ACCESSOR_V(uint8_t)
+    SERIALIZE_ACCESSOR_V(uint16_t)
+    SERIALIZE_ACCESSOR_V(uint32_t)
+    SERIALIZE_ACCESSOR_V(uint64_t)
+    SERIALIZE_ACCESSOR_V(float)
+    SERIALIZE_ACCESSOR_V(double)
+
+    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
+        m_serializable = false;
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_serializable = false;
+    }
+
+    bool is_serializable() const {
+        return m_serializable;
+    }
+
+    const std::string& get_result() const {
+        return m_result;
+    }
+
+private:
+    std::string m_result;
+    bool m_serializable = true;
+};
+
+#undef SERIALIZE_ACCESSOR_V
+#undef SERIALIZE_ACCESSOR
+
+/// \brief Serializes node type and attributes, empty if the node can't be cached.
+std::optional<std::string> serialize_node(const Node* node) {
+    AttributeSerializer serializer;
+    if (!const_cast<Node*>(node)->visit_attributes(serializer) || !serializer.is_serializable()) {
+        return {};
+    }
+    const auto& type_info = node->get_type_info();
+    std::string result;
+    append(result, std::string(type_info.name));
+    append(result, std::string(type_info.version_id ? type_info.version_id : ""));
+    append(result, serializer.get_result());
+    return result;
+}
+
+std::optional<ConstantFoldCache::Key> compute_constant_key(const op::v0::Constant& constant) {
+    if (constant.get_element_type() == element::string) {
+        return {};
+    }
+    auto key = u64_hash_combine(hash_string(constant.get_type_info().name),
+                                hash_string(constant.get_element_type().get_type_name()));
+    for (const auto& dim : constant.get_shape()) {
+        key = u64_hash_combine(key, dim);
+    }
+    return u64_hash_combine(key, hash_data(constant.get_data_ptr(), constant.get_byte_size()));
+}
+
+std::optional<ConstantFoldCache::Key> compute_node_key(const Node* node, const ConstantFoldCache::KeyMap& keys) {
+    if (!ConstantFoldCache::can_be_cached(node)) {
+        return {};
+    }
+    const auto serialized = serialize_node(node);
+    if (!serialized) {
+        return {};
+    }
+    auto key = hash_string(*serialized);
+    for (const auto& input : node->input_values()) {
+        const auto& input_key = keys.at(input.get_node());
+        if (!input_key) {
+            return {};
+        }
+        key = u64_hash_combine(key, u64_hash_combine(*input_key, input.get_index()));
+    }
+    for (const auto& output : node->outputs()) {
+        key = u64_hash_combine(key, hash_string(output.get_element_type().get_type_name()));
+        for (const auto& dim : output.get_shape()) {
+            key = u64_hash_combine(key, dim);
+        }
+    }
+    return key;
+}
+
+template <class T>
+void write_value(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_block(std::ostream& stream, const void* data, uint64_t size) {
+    write_value<uint64_t>(stream, size);
+    stream.write(static_cast<const char*>(data), size);
+}
+
+/// \brief Reads the cache entry. Every length read from the entry is checked against the remaining size of the
+///        file and the expected value before anything is allocated.
+class EntryReader {
+public:
+    EntryReader(std::istream& stream, uint64_t size) : m_stream(stream), m_remaining(size) {}
+
+    bool read(void* data, uint64_t size) {
+        if (size > m_remaining) {
+            return false;
+        }
+        m_remaining -= size;
+        m_stream.read(static_cast<char*>(data), size);
+        return static_cast<bool>(m_stream);
+    }
+
+    template <class T>
+    bool read_expected(const T& expected) {
+        T value{};
+        return read(&value, sizeof(value)) && value == expected;
+    }
+
+    /// \brief Reads the block written by write_block and compares it with the expected data.
+    bool read_expected_block(const void* expected, uint64_t size) {
+        if (!read_expected<uint64_t>(size)) {
+            return false;
+        }
+        constexpr uint64_t chunk_size = 64 * 1024;
+        std::vector<char> chunk(std::min(size, chunk_size));
+        for (uint64_t offset = 0; offset < size; offset += chunk.size()) {
+            const auto current = std::min<uint64_t>(chunk.size(), size - offset);
+            if (!read(chunk.data(), current) ||
+                std::memcmp(chunk.data(), static_cast<const char*>(expected) + offset, current) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::istream& m_stream;
+    uint64_t m_remaining;
+};
+
+thread_local std::shared_ptr<ConstantFoldCache> scoped_constant_fold_cache;
+std::mutex cache_mutex;
+std::shared_ptr<ConstantFoldCache> constant_fold_cache;
+}  // namespace
+
+ConstantFoldCache::ConstantFoldCache(std::filesystem::path cache_dir, size_t min_size, size_t max_size)
+    : m_cache_dir(std::move(cache_dir)),
+      m_min_size(min_size),
+      m_max_size(max_size) {
+    create_directory_recursive(m_cache_dir);
+}
+
+bool ConstantFoldCache::can_be_cached(const Node* node) {
+    if (ov::pass::constant_folding_is_disabled(node) || node->get_input_size() == 0 || op::util::is_parameter(node) ||
+        op::util::is_output(node) || op::util::is_sink(node) || ov::is_type<op::util::ReadValueBase>(node) ||
+        ov::is_type<op::util::MultiSubGraphOp>(node)) {
+        return false;
+    }
+    for (const auto& output : node->outputs()) {
+        const auto& type = output.get_element_type();
+        if (output.get_partial_shape().is_dynamic() || type.is_dynamic() || type == element::string) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<ConstantFoldCache::Key> ConstantFoldCache::compute_key(const Node* node, KeyMap& keys) const {
+    // Iterative post-order traversal to avoid deep recursion on long chains of foldable nodes
+    std::vector<std::pair<const Node*, bool>> stack{{node, false}};
+    while (!stack.empty()) {
+        auto [current, inputs_visited] = stack.back();
+        stack.pop_back();
+        if (keys.count(current)) {
+            continue;
+        }
+        if (const auto constant = ov::as_type<const op::v0::Constant>(current)) {
+            keys[current] = compute_constant_key(*constant);
+        } else if (!can_be_cached(current)) {
+            keys[current] = std::nullopt;
+        } else if (inputs_visited) {
+            keys[current] = compute_node_key(current, keys);
+        } else {
+            stack.emplace_back(current, true);
+            for (const auto& input : current->input_values()) {
+                if (!keys.count(input.get_node())) {
+                    stack.emplace_back(input.get_node(), false);
+                }
+            }
+        }
+    }
+    return keys.at(node);
+}
+
+bool ConstantFoldCache::is_worth_caching(const Node* node) const {
+    size_t size = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic()) {
+            return false;
+        }
+        size += output.get_element_type().size() * shape_size(output.get_shape());
+    }
+    return size >= m_min_size;
+}
+
+std::string ConstantFoldCache::describe(const Node* node, const KeyMap& keys) {
+    std::string description;
+    std::unordered_map<const Node*, uint64_t> ids;
+    std::vector<std::pair<const Node*, bool>> stack{{node, false}};
+    while (!stack.empty()) {
+        auto [current, inputs_visited] = stack.back();
+        stack.pop_back();
+        if (ids.count(current)) {
+            continue;
+        }
+        if (ov::is_type<op::v0::Constant>(current)) {
+            // the key of the constant is the hash of its data, so the data is neither copied nor compared
+            const auto& key = keys.at(current);
+            OPENVINO_ASSERT(key, "Can't describe the sub-graph of node without cache key: ", *node);
+            append(description, *key);
+            append_output_descriptions(description, current);
+        } else if (inputs_visited) {
+            const auto serialized = serialize_node(current);
+            OPENVINO_ASSERT(serialized, "Can't describe the sub-graph of node without cache key: ", *current);
+            append(description, *serialized);
+            for (const auto& input : current->input_values()) {
+                append(description, ids.at(input.get_node()));
+                append(description, static_cast<uint64_t>(input.get_index()));
+            }
+            append_output_descriptions(description, current);
+        } else {
+            stack.emplace_back(current, true);
+            for (const auto& input : current->input_values()) {
+                if (!ids.count(input.get_node())) {
+                    stack.emplace_back(input.get_node(), false);
+                }
+            }
+            continue;
+        }
+        ids.emplace(current, ids.size());
+    }
+    return description;
+}
+
+OutputVector ConstantFoldCache::load(Key key, const Node* node, const std::string& description) const {
+    const auto entry_path = get_entry_path(key);
+    std::error_code ec;
+    const auto entry_size = std::filesystem::file_size(entry_path, ec);
+    if (ec) {
+        return {};
+    }
+    std::ifstream entry(entry_path, std::ios::binary);
+    if (!entry) {
+        return {};
+    }
+    EntryReader reader(entry, entry_size);
+    if (!reader.read_expected(cache_entry_magic) || !reader.read_expected(cache_entry_version) ||
+        !reader.read_expected(key)) {
+        return {};
+    }
+    // the key may collide, so the entry must be stored for the same sub-graph and input data
+    if (!reader.read_expected_block(description.data(), description.size())) {
+        return {};
+    }
+
+    if (!reader.read_expected<uint64_t>(node->get_output_size())) {
+        return {};
+    }
+    OutputVector outputs;
+    for (const auto& expected : node->outputs()) {
+        const auto& type = expected.get_element_type();
+        const auto& shape = expected.get_shape();
+        const auto type_name = type.get_type_name();
+        if (!reader.read_expected_block(type_name.data(), type_name.size()) ||
+            !reader.read_expected<uint64_t>(shape.size())) {
+            return {};
+        }
+        for (const auto& dim : shape) {
+            if (!reader.read_expected<uint64_t>(dim)) {
+                return {};
+            }
+        }
+        ov::Tensor tensor(type, shape);
+        if (!reader.read_expected<uint64_t>(tensor.get_byte_size()) ||
+            !reader.read(tensor.data(), tensor.get_byte_size())) {
+            return {};
+        }
+        outputs.push_back(std::make_shared<op::v0::Constant>(tensor));
+    }
+    if (m_max_size != 0) {
+        // the modification time orders the entries for the eviction
+        std::filesystem::last_write_time(entry_path, std::filesystem::file_time_type::clock::now(), ec);
+    }
+    return outputs;
+}
+
+void ConstantFoldCache::store(Key key, const std::string& description, const OutputVector& outputs) const {
+    size_t size = description.size();
+    for (const auto& output : outputs) {
+        const auto constant = ov::as_type<op::v0::Constant>(output.get_node());
+        if (!constant) {
+            return;
+        }
+        size += constant->get_byte_size();
+    }
+    if (m_max_size != 0 && size > m_max_size) {
+        return;
+    }
+
+    // Write to a temporary file first, so concurrent readers never see a partially written entry
+    const auto entry_path = get_entry_path(key);
+    std::stringstream tmp_name;
+    tmp_name << entry_path.filename().string() << "." << std::hex << std::random_device{}() << ".tmp";
+    const auto tmp_path = m_cache_dir / tmp_name.str();
+    {
+        std::ofstream entry(tmp_path, std::ios::binary);
+        if (!entry) {
+            return;
+        }
+        write_value<uint64_t>(entry, cache_entry_magic);
+        write_value<uint64_t>(entry, cache_entry_version);
+        write_value<Key>(entry, key);
+        write_block(entry, description.data(), description.size());
+        write_value<uint64_t>(entry, outputs.size());
+        for (const auto& output : outputs) {
+            const auto constant = ov::as_type<op::v0::Constant>(output.get_node());
+            const auto type_name = constant->get_element_type().get_type_name();
+            write_block(entry, type_name.data(), type_name.size());
+            write_value<uint64_t>(entry, constant->get_shape().size());
+            for (const auto& dim : constant->get_shape()) {
+                write_value<uint64_t>(entry, dim);
+            }
+            write_block(entry, constant->get_data_ptr(), constant->get_byte_size());
+        }
+        if (!entry) {
+            entry.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, entry_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+    } else if (m_max_size != 0) {
+        evict(entry_path);
+    }
+}
+
+void ConstantFoldCache::evict(const std::filesystem::path& stored_path) const {
+    // The directory is scanned on every store, as other processes may share it. Stores happen on cache misses
+    // only, which are followed by the much longer evaluation of the folded sub-graph
+    struct Entry {
+        std::filesystem::path path;
+        std::filesystem::file_time_type time;
+        uintmax_t size;
+    };
+    std::vector<Entry> entries;
+    uintmax_t total_size = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(m_cache_dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != cache_entry_extension) {
+            continue;
+        }
+        std::error_code entry_ec;
+        const auto size = it->file_size(entry_ec);
+        const auto time = it->last_write_time(entry_ec);
+        if (entry_ec) {
+            continue;
+        }
+        total_size += size;
+        // the entry just stored is never evicted
+        if (it->path() != stored_path) {
+            entries.push_back({it->path(), time, size});
+        }
+    }
+    if (total_size <= m_max_size) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.time < rhs.time;
+    });
+    for (const auto& entry : entries) {
+        if (total_size <= m_max_size) {
+            break;
+        }
+        if (std::filesystem::remove(entry.path, ec)) {
+            total_size -= entry.size;
+        }
+    }
+}
+
+std::filesystem::path ConstantFoldCache::get_entry_path(Key key) const {
+    std::stringstream name;
+    name << std::hex << key << cache_entry_extension;
+    return m_cache_dir / name.str();
+}
+
+void set_constant_fold_cache(std::shared_ptr<ConstantFoldCache> cache) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    constant_fold_cache = std::move(cache);
+}
+
+std::shared_ptr<ConstantFoldCache> get_constant_fold_cache() {
+    if (scoped_constant_fold_cache) {
+        return scoped_constant_fold_cache;
+    }
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return constant_fold_cache;
+}
+
+ConstantFoldCacheScope::ConstantFoldCacheScope(std::shared_ptr<ConstantFoldCache> cache)
+    : m_previous(std::exchange(scoped_constant_fold_cache, std::move(cache))) {}
+
+ConstantFoldCacheScope::~ConstantFoldCacheScope() {
+    scoped_constant_fold_cache = std::move(m_previous);
+}
+
+}  // namespace util
+}  // namespace ov
@@ -4,7 +4,11 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <unordered_set>
+#include <utility>
+
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/constant_fold_cache.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
@@ -101,11 +105,86 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+using CacheKeys = std::unordered_map<const ov::Node*, std::pair<ov::util::ConstantFoldCache::Key, std::string>>;
+
+/**
+ * \brief Replaces foldable sub-graphs with the results stored in the constant folding cache.
+ *
+ * Only roots of the foldable sub-graphs (nodes which have a consumer that can't be folded) are looked up, so
+ * evaluation of the whole sub-graph is skipped on cache hit.
+ *
+ * \param model      Model to process.
+ * \param cache      Constant folding cache.
+ * \param rewritten  Set to true if any sub-graph is replaced.
+ *
+ * \return Keys and sub-graph descriptions of the roots missed in the cache. Their folding results should be stored
+ *         after evaluation.
+ */
+static CacheKeys fold_from_cache(const std::shared_ptr<ov::Model>& model,
+                                 const ov::util::ConstantFoldCache& cache,
+                                 bool& rewritten) {
+    const auto ops = model->get_ordered_ops();
+    std::unordered_set<const ov::Node*> foldable;
+    for (const auto& node : ops) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+            if (constant->get_element_type() != ov::element::string) {
+                foldable.insert(node.get());
+            }
+        } else if (ov::util::ConstantFoldCache::can_be_cached(node.get()) &&
+                   std::all_of(node->input_values().begin(), node->input_values().end(), [&](const auto& input) {
+                       return foldable.count(input.get_node()) != 0;
+                   })) {
+            foldable.insert(node.get());
+        }
+    }
+
+    CacheKeys missed_keys;
+    ov::util::ConstantFoldCache::KeyMap keys;
+    for (const auto& node : ops) {
+        if (!foldable.count(node.get()) || ov::is_type<ov::op::v0::Constant>(node) ||
+            !cache.is_worth_caching(node.get())) {
+            continue;
+        }
+        bool is_root = false;
+        for (const auto& output : node->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                is_root = is_root || !foldable.count(consumer.get_node());
+            }
+        }
+        if (!is_root) {
+            continue;
+        }
+        const auto key = cache.compute_key(node.get(), keys);
+        if (!key) {
+            continue;
+        }
+        auto description = ov::util::ConstantFoldCache::describe(node.get(), keys);
+        const auto replacements = cache.load(*key, node.get(), description);
+        if (replacements.size() != node->get_output_size()) {
+            // the sub-graph is described before folding, since its nodes are replaced during it
+            missed_keys.emplace(node.get(), std::make_pair(*key, std::move(description)));
+            continue;
+        }
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            const auto& replacement_ptr = replacements[i].get_node_shared_ptr();
+            replacement_ptr->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+            node->output(i).replace(replacements[i]);
+            ov::copy_runtime_info(node, replacement_ptr);
+            ov::copy_weightless_cache_attr(node, replacement_ptr);
+        }
+        rewritten = true;
+    }
+    return missed_keys;
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    const auto cache = util::get_constant_fold_cache();
+    const auto missed_cache_keys = cache ? fold_from_cache(model, *cache, rewritten) : CacheKeys{};
+
     // Creating a local vector and moving each element to reduce memory peak.
     // Elements of 'nodes' vector are nullptr after the std::move in the loop.
     auto nodes = model->get_ordered_ops();
@@ -165,6 +244,9 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     rewritten = true;
                 }
             }
+            if (const auto key = missed_cache_keys.find(original_node.get()); key != missed_cache_keys.end()) {
+                cache->store(key->second.first, key->second.second, replacements);
+            }
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <optional>
 #include <regex>
 #include <string>
 #include <unordered_set>
@@ -15,9 +16,12 @@
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_profiler.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -66,6 +70,144 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace {
+/* Index of MatcherPasses used to select matchers which can match a node.
+ * Matchers are discriminated by the root type of the pattern (including types registered for the parents of the
+ * node type), then by the number of root inputs and the types of the nodes producing them. Matchers which root type
+ * is unknown (e.g. pattern::any_input or MatcherPass without Matcher) are put to the fallback bucket and are
+ * checked for every node. Candidates are cached per node type, so the lookup is done once per type.
+ */
+class MatcherDispatchIndex {
+public:
+    struct Entry {
+        size_t matcher_index;
+        // number of root inputs; empty if any number of inputs is accepted
+        std::optional<size_t> input_count;
+        // types accepted for producers of the root inputs; empty vector if any type is accepted
+        std::vector<std::vector<ov::NodeTypeInfo>> input_types;
+    };
+
+    void add(size_t matcher_index, const std::shared_ptr<ov::pass::pattern::Matcher>& matcher) {
+        m_candidates.clear();
+        if (!matcher) {
+            m_fallback.push_back({matcher_index, {}, {}});
+            return;
+        }
+
+        auto root = matcher->get_pattern_value().get_node_shared_ptr();
+        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+        // Matcher and to gen actual root node we need to take it's parent.
+        if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::AnyOutput>(root)) {
+            root = any_type->input_value(0).get_node_shared_ptr();
+        }
+
+        std::vector<ov::NodeTypeInfo> root_types;
+        if (!collect_types(root, root_types)) {
+            m_fallback.push_back({matcher_index, {}, {}});
+            return;
+        }
+
+        // Input count is checked by the matcher for root operations and WrapType with inputs
+        Entry entry{matcher_index, {}, {}};
+        const bool has_fixed_inputs = !ov::is_type<ov::pass::pattern::op::Or>(root) &&
+                                      (!ov::is_type<ov::pass::pattern::op::WrapType>(root) || root->get_input_size());
+        if (has_fixed_inputs) {
+            entry.input_count = root->get_input_size();
+            for (const auto& input : root->input_values()) {
+                std::vector<ov::NodeTypeInfo> input_types;
+                if (!collect_types(input.get_node_shared_ptr(), input_types) ||
+                    ov::is_type<ov::pass::pattern::op::Or>(input.get_node())) {
+                    input_types.clear();
+                }
+                entry.input_types.push_back(std::move(input_types));
+            }
+        }
+        for (const auto& root_type : root_types) {
+            m_typed[root_type].push_back(entry);
+        }
+    }
+
+    /// Returns matchers for node of given type in order of the registration
+    const std::vector<const Entry*>& get_candidates(const ov::DiscreteTypeInfo& node_type) {
+        auto found = m_candidates.find(node_type);
+        if (found != m_candidates.end())
+            return found->second;
+
+        auto& candidates = m_candidates[node_type];
+        for (const auto* type_info = &node_type; type_info; type_info = type_info->parent) {
+            auto matchers = m_typed.find(*type_info);
+            if (matchers != m_typed.end()) {
+                for (const auto& entry : matchers->second)
+                    candidates.push_back(&entry);
+            }
+        }
+        for (const auto& entry : m_fallback)
+            candidates.push_back(&entry);
+
+        std::sort(candidates.begin(), candidates.end(), [](const Entry* lhs, const Entry* rhs) {
+            return lhs->matcher_index < rhs->matcher_index;
+        });
+        // the same matcher may be registered for several types of the hierarchy
+        candidates.erase(std::unique(candidates.begin(),
+                                     candidates.end(),
+                                     [](const Entry* lhs, const Entry* rhs) {
+                                         return lhs->matcher_index == rhs->matcher_index;
+                                     }),
+                         candidates.end());
+        return candidates;
+    }
+
+    /// Checks root inputs of the matcher against the node. Doesn't give false negatives.
+    static bool accepts(const Entry& entry, const ov::Node& node) {
+        if (!entry.input_count)
+            return true;
+        if (*entry.input_count != node.get_input_size())
+            return false;
+        // Inputs of commutative operations are matched in any order
+        if (ov::op::util::is_commutative(&node))
+            return true;
+        for (size_t i = 0; i < entry.input_types.size(); ++i) {
+            const auto& types = entry.input_types[i];
+            if (types.empty())
+                continue;
+            const auto& input_type = node.get_input_node_ptr(i)->get_type_info();
+            if (std::none_of(types.begin(), types.end(), [&](const ov::NodeTypeInfo& type) {
+                    return input_type.is_castable(type);
+                }))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    // Collects types which pattern node can match. Returns false if the node can match any type.
+    static bool collect_types(const std::shared_ptr<ov::Node>& pattern_node, std::vector<ov::NodeTypeInfo>& types) {
+        if (auto wrap_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(pattern_node)) {
+            const auto& wrapped_types = wrap_type->get_wrapped_types();
+            types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+            return true;
+        }
+        if (ov::is_type<ov::pass::pattern::op::Or>(pattern_node)) {
+            // Or matches if any of the alternatives matches
+            for (const auto& alternative : pattern_node->input_values()) {
+                if (!collect_types(alternative.get_node_shared_ptr(), types))
+                    return false;
+            }
+            return true;
+        }
+        if (std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(pattern_node))
+            return false;
+        types.push_back(pattern_node->get_type_info());
+        return true;
+    }
+
+    std::unordered_map<ov::NodeTypeInfo, std::vector<Entry>> m_typed;
+    std::vector<Entry> m_fallback;
+    std::unordered_map<ov::NodeTypeInfo, std::vector<const Entry*>> m_candidates;
+};
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,52 +243,24 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    MatcherDispatchIndex dispatch_index;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
-
-        auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
-            }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
-        }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+        dispatch_index.add(matcher_index, m_matchers[matcher_index]->get_matcher());
     }
 
+    // Statistics of the matchers are collected only if the pass is profiled
+    auto profile = profiling::current();
+    std::vector<PassProfile> matcher_profiles(profile ? m_matchers.size() : 0);
+    size_t nodes_visited = 0;
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -159,7 +273,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = false;
+        if (profile) {
+            const auto start_time = profiling::now();
+            status = m_pass->apply(std::move(node));
+            auto& matcher_profile = matcher_profiles[matcher_index];
+            matcher_profile.duration += profiling::now() - start_time;
+            ++matcher_profile.matcher_calls;
+            matcher_profile.matcher_hits += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(std::move(node));
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -175,9 +299,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -185,6 +306,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         auto node = weak_node.lock();
         if (!node)
             continue;
+        ++nodes_visited;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
@@ -200,48 +322,38 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        // Only matchers which root can match the node are run, in order of the registration
+        for (const auto* entry : dispatch_index.get_candidates(node->get_type_info())) {
+            if (!MatcherDispatchIndex::accepts(*entry, *node))
+                continue;
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+            if (run_matcher_pass(entry->matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+    }
+
+    if (profile) {
+        // GraphRewrite may be run several times within the same pass (e.g. for sub-graphs), so the statistics
+        // are accumulated
+        profile->nodes_visited += nodes_visited;
+        for (size_t matcher_index = 0; matcher_index < matcher_profiles.size(); ++matcher_index) {
+            const auto& matcher_profile = matcher_profiles[matcher_index];
+            if (matcher_profile.matcher_calls == 0)
+                continue;
+            const auto& name = m_matchers[matcher_index]->get_name();
+            auto found = std::find_if(profile->children.begin(), profile->children.end(), [&](const PassProfile& p) {
+                return p.name == name;
+            });
+            if (found == profile->children.end()) {
+                found = profile->children.insert(profile->children.end(), PassProfile{});
+                found->name = name;
+                found->start_time = profile->start_time;
             }
+            found->duration += matcher_profile.duration;
+            found->matcher_calls += matcher_profile.matcher_calls;
+            found->matcher_hits += matcher_profile.matcher_hits;
         }
     }
     return rewritten;
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -21,6 +22,7 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_profiler.hpp"
 #include "perf_counters.hpp"
 
 #ifdef ENABLE_PROFILING_ITT_FULL
@@ -333,6 +335,10 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::enable_profiling(bool enable) {
+    m_profiling = enable;
+}
+
 bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "pass::Manager::run_passes");
     Profiler profiler(m_name);
@@ -340,6 +346,15 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     bool manager_changed_model = false;
     bool needs_validation = false;
 
+    // Profile is collected if it is enabled for this Manager or it is run inside a profiled pass
+    std::optional<profiling::Scope> profile_scope;
+    if (m_profiling) {
+        m_profile = PassProfile{};
+        profile_scope.emplace(m_profile, m_name);
+    } else if (profiling::current()) {
+        profile_scope.emplace(m_name);
+    }
+
     profiler.start_timer(m_name);
     for (const auto& pass : m_pass_list) {
         if (needs_validation) {
@@ -366,7 +381,14 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
         const auto& pass_name = pass->get_name();
 
         profiler.start_timer(pass_name);
-        bool pass_changed_model = run_pass(pass, model);
+        bool pass_changed_model = false;
+        {
+            profiling::Scope pass_scope(pass_name);
+            pass_changed_model = run_pass(pass, model);
+            if (auto pass_profile = pass_scope.get()) {
+                pass_profile->changed_model = pass_changed_model;
+            }
+        }
         profiler.stop_timer(pass_name, pass_changed_model);
 
         manager_changed_model = manager_changed_model || pass_changed_model;
@@ -376,6 +398,9 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
         profiler.serialize(model, pass_name);
     }
     profiler.stop_timer(m_name, manager_changed_model);
+    if (profile_scope && profile_scope->get()) {
+        profile_scope->get()->changed_model = manager_changed_model;
+    }
 
     return manager_changed_model;
 }
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profile.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+#include "pass_profiler.hpp"
+
+namespace ov {
+namespace pass {
+namespace profiling {
+namespace {
+std::vector<PassProfile*>& scopes_stack() {
+    thread_local std::vector<PassProfile*> stack;
+    return stack;
+}
+}  // namespace
+
+PassProfile* current() {
+    const auto& stack = scopes_stack();
+    return stack.empty() ? nullptr : stack.back();
+}
+
+std::chrono::nanoseconds now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+}
+
+Scope::Scope(const std::string& name) {
+    if (auto parent = current()) {
+        start(&parent->children.emplace_back(), name);
+    }
+}
+
+Scope::Scope(PassProfile& root, const std::string& name) {
+    start(&root, name);
+}
+
+Scope::~Scope() {
+    if (m_profile) {
+        m_profile->duration = now() - m_profile->start_time;
+        scopes_stack().pop_back();
+    }
+}
+
+void Scope::start(PassProfile* profile, const std::string& name) {
+    m_profile = profile;
+    m_profile->name = name;
+    m_profile->start_time = now();
+    scopes_stack().push_back(m_profile);
+}
+}  // namespace profiling
+
+namespace {
+void write_json_string(const std::string& str, std::ostream& stream) {
+    stream << '"';
+    for (const auto c : str) {
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+// Aggregated profiles (e.g. MatcherPasses) have no own start time, so children are laid out one after another
+// starting from their recorded start time to keep the events properly nested in the trace.
+void write_events(const PassProfile& profile,
+                  std::chrono::nanoseconds start_time,
+                  std::chrono::nanoseconds origin,
+                  bool& first,
+                  std::ostream& stream) {
+    const auto to_us = [](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::micro>(time).count();
+    };
+    stream << (first ? "\n" : ",\n") << R"({"name":)";
+    write_json_string(profile.name, stream);
+    stream << R"(,"ph":"X","pid":1,"tid":1,"ts":)" << to_us(start_time - origin)
+           << R"(,"dur":)" << to_us(profile.duration) << R"(,"args":{"nodes_visited":)" << profile.nodes_visited
+           << R"(,"matcher_calls":)" << profile.matcher_calls << R"(,"matcher_hits":)" << profile.matcher_hits
+           << R"(,"changed_model":)" << (profile.changed_model ? "true" : "false") << "}}";
+    first = false;
+
+    auto child_start = start_time;
+    for (const auto& child : profile.children) {
+        child_start = std::max(child_start, child.start_time);
+        write_events(child, child_start, origin, first, stream);
+        child_start += child.duration;
+    }
+}
+}  // namespace
+
+void write_chrome_trace(const PassProfile& profile, std::ostream& stream) {
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    const auto fill = stream.fill();
+
+    bool first = true;
+    stream << std::fixed << std::setprecision(3) << R"({"traceEvents":[)";
+    write_events(profile, profile.start_time, profile.start_time, first, stream);
+    stream << "\n]}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+    stream.fill(fill);
+}
+
+}  // namespace pass
+}  // namespace ov
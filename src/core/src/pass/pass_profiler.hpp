@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "openvino/pass/pass_profile.hpp"
+
+namespace ov {
+namespace pass {
+namespace profiling {
+
+/// \brief Returns profile of the scope being executed on this thread or nullptr if profiling is not active.
+PassProfile* current();
+
+/// \brief Returns steady clock time since epoch.
+std::chrono::nanoseconds now();
+
+/// \brief Profiles execution of the scope. The profile is put to the profile of the enclosing scope, so nested
+/// Managers and passes build a hierarchy. Does nothing if profiling is not active on this thread.
+class Scope {
+public:
+    /// \brief Starts a child scope of the current one if profiling is active.
+    explicit Scope(const std::string& name);
+
+    /// \brief Starts profiling session with the given root profile.
+    Scope(PassProfile& root, const std::string& name);
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope();
+
+    /// \brief Returns profile of the scope or nullptr if profiling is not active.
+    PassProfile* get() const {
+        return m_profile;
+    }
+
+private:
+    void start(PassProfile* profile, const std::string& name);
+
+    PassProfile* m_profile = nullptr;
+};
+
+}  // namespace profiling
+}  // namespace pass
+}  // namespace ov
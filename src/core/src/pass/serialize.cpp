@@ -132,7 +132,9 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            ov::util::ParallelConstantWriter constant_writer(bin_file, m_bin_path);
+            serialize_func(xml_file, bin_file, model, m_version, false, constant_writer);
+            constant_writer.flush();
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -4,12 +4,25 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <atomic>
+#include <cstring>
+#include <fstream>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/common_util.hpp"
 
 namespace ov::util {
+namespace {
+// Number of elements converted to FP16 by one task
+constexpr size_t fp16_conversion_block = 64 * 1024;
+// Blobs are split into pieces of this size to spread large constants between writing threads
+constexpr size_t write_piece_size = 64 * 1024 * 1024;
+// Limit of memory kept for pending blobs owned by the parallel writer
+constexpr size_t max_pending_owned_size = 256 * 1024 * 1024;
+}  // namespace
 
 ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
     : m_hash_to_file_positions{},
@@ -26,11 +39,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    bool compress_to_fp16,
                                                    ov::element::Type src_type,
                                                    bool ptr_is_temporary) {
-    const FilePosition write_pos = m_binary_output.get().tellp();
-    const auto offset = write_pos - m_blob_offset;
+    const auto offset = get_write_offset();
     new_size = size;
 
-    const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
+    auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
     if (m_enable_compression) {
@@ -57,10 +69,18 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // fast hash (skip data)
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
     }
-    m_binary_output.get().write(data_ptr, new_size);
+    write_blob(offset, data_ptr, new_size, std::move(fp16_data), ptr_is_temporary);
     return offset;
 }
 
+ConstantWriter::FilePosition ConstantWriter::get_write_offset() const {
+    return static_cast<FilePosition>(m_binary_output.get().tellp()) - m_blob_offset;
+}
+
+void ConstantWriter::write_blob(FilePosition, const char* data, size_t size, std::unique_ptr<char[]>, bool) {
+    m_binary_output.get().write(data, size);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
@@ -73,7 +93,12 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
         auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const float*>(ptr);
-        ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
+        const auto num_blocks = ov::util::ceil_div(num_src_elements, fp16_conversion_block);
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            const auto start = block * fp16_conversion_block;
+            const auto count = std::min(fp16_conversion_block, num_src_elements - start);
+            ov::reference::convert_from_f32_to_f16_with_clamp(src_data + start, dst_data + start, count);
+        });
         return new_ptr;
     } else if (src_type == ov::element::f64) {
         auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
@@ -81,7 +106,7 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto src_data = reinterpret_cast<const double*>(ptr);
 
         // Reference implementation for fp64 to fp16 conversion
-        for (size_t i = 0; i < num_src_elements; ++i) {
+        ov::parallel_for(num_src_elements, [&](size_t i) {
             // if abs value is smaller than the smallest positive fp16, but not zero
             if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
                 dst_data[i] = 0;
@@ -92,11 +117,103 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
             } else {
                 dst_data[i] = static_cast<ov::float16>(src_data[i]);
             }
-        }
+        });
         return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
     }
 }
 
+ParallelConstantWriter::ParallelConstantWriter(std::ostream& bin_data,
+                                               std::filesystem::path bin_path,
+                                               bool enable_compression)
+    : ConstantWriter(bin_data, enable_compression),
+      m_bin_path(std::move(bin_path)),
+      m_stream_offset(bin_data.tellp()),
+      m_write_offset{0},
+      m_pending_blobs{},
+      m_pending_owned_size{0} {}
+
+ParallelConstantWriter::~ParallelConstantWriter() = default;
+
+ConstantWriter::FilePosition ParallelConstantWriter::get_write_offset() const {
+    return m_write_offset;
+}
+
+void ParallelConstantWriter::write_blob(FilePosition offset,
+                                        const char* data,
+                                        size_t size,
+                                        std::unique_ptr<char[]> data_holder,
+                                        bool data_is_temporary) {
+    m_write_offset = offset + static_cast<FilePosition>(size);
+    if (size == 0) {
+        return;
+    }
+    if (!data_holder && data_is_temporary) {
+        data_holder = std::unique_ptr<char[]>(new char[size]);
+        std::memcpy(data_holder.get(), data, size);
+        data = data_holder.get();
+    }
+    if (data_holder) {
+        m_pending_owned_size += size;
+    }
+    m_pending_blobs.push_back({offset, data, size, std::move(data_holder)});
+    if (m_pending_owned_size > max_pending_owned_size) {
+        flush();
+    }
+}
+
+void ParallelConstantWriter::flush() {
+    if (m_pending_blobs.empty()) {
+        return;
+    }
+
+    struct Piece {
+        FilePosition position;
+        const char* data;
+        size_t size;
+    };
+    // Blobs are registered in offset order, so each thread gets a contiguous region of the file
+    std::vector<Piece> pieces;
+    for (const auto& blob : m_pending_blobs) {
+        for (size_t pos = 0; pos < blob.size; pos += write_piece_size) {
+            pieces.push_back({m_stream_offset + blob.offset + static_cast<FilePosition>(pos),
+                              blob.data + pos,
+                              std::min(write_piece_size, blob.size - pos)});
+        }
+    }
+
+    std::error_code ec;
+    const auto file_size = static_cast<std::uintmax_t>(m_stream_offset + m_write_offset);
+    if (std::filesystem::file_size(m_bin_path, ec) < file_size && !ec) {
+        std::filesystem::resize_file(m_bin_path, file_size, ec);
+    }
+
+    std::atomic_bool write_failed{static_cast<bool>(ec)};
+    const auto num_threads = static_cast<int>(std::min<size_t>(parallel_get_max_threads(), pieces.size()));
+    ov::parallel_nt(num_threads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        ov::splitter(pieces.size(), nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+        std::ofstream bin_file(m_bin_path, std::ios::binary | std::ios::in | std::ios::out);
+        for (auto i = start; i < end && bin_file; ++i) {
+            bin_file.seekp(pieces[i].position);
+            bin_file.write(pieces[i].data, pieces[i].size);
+        }
+        bin_file.flush();
+        if (!bin_file) {
+            write_failed = true;
+        }
+    });
+
+    m_pending_blobs.clear();
+    m_pending_owned_size = 0;
+    if (write_failed) {
+        // report the same error as the output stream with enabled exceptions does
+        throw std::ios_base::failure("Failed to write constants to: " + m_bin_path.string());
+    }
+}
+
 }  // namespace ov::util
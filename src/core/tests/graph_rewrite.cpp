@@ -16,6 +16,7 @@
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +270,50 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndGenericMatcherPasses) {
+    auto f = get_model();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    const auto ref_order = f->get_ordered_ops();
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(order, ref_order);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
+class InputTypeBasedTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("InputTypeBasedTestPass");
+    InputTypeBasedTestPass(size_t input_index, size_t& matched) : MatcherPass() {
+        OutputVector inputs{pattern::any_input(), pattern::any_input()};
+        inputs[input_index] = pattern::wrap_type<op::v0::Constant>();
+        auto divide = pattern::wrap_type<op::v1::Divide>(inputs);
+        ov::graph_rewrite_callback callback = [&matched](pattern::Matcher&) {
+            ++matched;
+            return false;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(divide, "InputTypeBasedTestPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, InputTypeBasedMatcherPass) {
+    auto f = get_model();
+
+    size_t matched_first = 0, matched_second = 0;
+    Anchor anchor;
+    anchor.add_matcher<InputTypeBasedTestPass>(0, matched_first);
+    anchor.add_matcher<InputTypeBasedTestPass>(1, matched_second);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched_first, 0);
+    ASSERT_EQ(matched_second, 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -6,9 +6,16 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <numeric>
+
 #include "common_test_utils/all_close_f.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_tools.hpp"
+#include "openvino/core/constant_fold_cache.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
 #include "openvino/op/ops.hpp"
 #include "ov_ops/type_relaxed.hpp"
@@ -4023,6 +4030,160 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(res_node, nullptr);
 }
 
+static std::shared_ptr<Model> make_fold_cache_model(float scale_value = 2.0f) {
+    std::vector<float> values(64 * 64);
+    std::iota(values.begin(), values.end(), 0.0f);
+    auto data = op::v0::Constant::create(element::f32, Shape{64, 64}, values);
+    auto scale = op::v0::Constant::create(element::f32, Shape{}, {scale_value});
+    auto shift = op::v0::Constant::create(element::f32, Shape{}, {1.0f});
+    auto multiply = std::make_shared<op::v1::Multiply>(data, scale);
+    auto subtract = std::make_shared<op::v1::Subtract>(multiply, shift);
+    subtract->set_friendly_name("test");
+    return std::make_shared<Model>(subtract, ParameterVector{});
+}
+
+// Looks up the folded root of the model, which must not be folded yet
+static OutputVector load_folded(const ov::util::ConstantFoldCache& cache, const std::shared_ptr<Model>& model) {
+    ov::util::ConstantFoldCache::KeyMap keys;
+    const auto root = model->get_results()[0]->get_input_node_ptr(0);
+    const auto key = cache.compute_key(root, keys);
+    return cache.load(*key, root, ov::util::ConstantFoldCache::describe(root, keys));
+}
+
+TEST(constant_folding, fold_cache) {
+    const std::filesystem::path cache_dir = ov::test::utils::generateTestFilePrefix() + "_cf_cache";
+    const auto cache = std::make_shared<ov::util::ConstantFoldCache>(cache_dir, 0);
+    ov::util::set_constant_fold_cache(cache);
+
+    EXPECT_TRUE(load_folded(*cache, make_fold_cache_model()).empty());
+    auto model = make_fold_cache_model();
+    run_constant_folding(model);
+    const auto expected = get_result_constant_data<float>(model, 0);
+
+    const auto loaded = load_folded(*cache, make_fold_cache_model());
+    ASSERT_EQ(loaded.size(), 1);
+    EXPECT_EQ(ov::as_type_ptr<op::v0::Constant>(loaded[0].get_node_shared_ptr())->cast_vector<float>(), expected);
+    // the sub-graph folded from other data is missed
+    EXPECT_TRUE(load_folded(*cache, make_fold_cache_model(3.0f)).empty());
+
+    auto cached_model = make_fold_cache_model();
+    run_constant_folding(cached_model);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(cached_model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(cached_model), 0);
+    EXPECT_EQ(get_result_constant(cached_model)->get_friendly_name(), "test");
+    EXPECT_EQ(get_result_constant_data<float>(cached_model, 0), expected);
+
+    ov::util::set_constant_fold_cache(nullptr);
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST(constant_folding, fold_cache_ignores_corrupted_entries) {
+    const std::filesystem::path cache_dir = ov::test::utils::generateTestFilePrefix() + "_cf_cache";
+    const auto cache = std::make_shared<ov::util::ConstantFoldCache>(cache_dir, 0);
+    ov::util::set_constant_fold_cache(cache);
+
+    auto model = make_fold_cache_model();
+    run_constant_folding(model);
+    const auto expected = get_result_constant_data<float>(model, 0);
+    ASSERT_FALSE(load_folded(*cache, make_fold_cache_model()).empty());
+
+    // every file of the cache is damaged, whatever the layout of the entries is
+    const auto damage_entries = [&](const std::function<void(const std::filesystem::path&, uintmax_t)>& damage) {
+        for (const auto& entry : std::filesystem::directory_iterator(cache_dir)) {
+            damage(entry.path(), entry.file_size());
+        }
+    };
+    damage_entries([](const std::filesystem::path& path, uintmax_t size) {
+        std::filesystem::resize_file(path, size / 2);
+    });
+    EXPECT_TRUE(load_folded(*cache, make_fold_cache_model()).empty());
+    auto truncated_model = make_fold_cache_model();
+    run_constant_folding(truncated_model);
+    EXPECT_EQ(get_result_constant_data<float>(truncated_model, 0), expected);
+    ASSERT_FALSE(load_folded(*cache, make_fold_cache_model()).empty());
+
+    damage_entries([](const std::filesystem::path& path, uintmax_t size) {
+        std::fstream entry(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::vector<char> garbage(std::min<uintmax_t>(size, 64), '\xff');
+        entry.write(garbage.data(), garbage.size());
+    });
+    EXPECT_TRUE(load_folded(*cache, make_fold_cache_model()).empty());
+    auto corrupted_model = make_fold_cache_model();
+    run_constant_folding(corrupted_model);
+    EXPECT_EQ(get_result_constant_data<float>(corrupted_model, 0), expected);
+
+    ov::util::set_constant_fold_cache(nullptr);
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST(constant_folding, fold_cache_checks_inputs_on_key_collision) {
+    const std::filesystem::path cache_dir = ov::test::utils::generateTestFilePrefix() + "_cf_cache";
+    const ov::util::ConstantFoldCache cache(cache_dir, 0);
+
+    const auto model = make_fold_cache_model(2.0f);
+    ov::util::ConstantFoldCache::KeyMap keys;
+    const auto root = model->get_results()[0]->get_input_node_ptr(0);
+    cache.compute_key(root, keys);
+    const auto description = ov::util::ConstantFoldCache::describe(root, keys);
+    auto folded_model = make_fold_cache_model(2.0f);
+    run_constant_folding(folded_model);
+
+    // the result of the first model is stored with the key of the second one, as if the keys collided
+    auto other_model = make_fold_cache_model(3.0f);
+    ov::util::ConstantFoldCache::KeyMap other_keys;
+    const auto other_root = other_model->get_results()[0]->get_input_node_ptr(0);
+    const auto other_key = cache.compute_key(other_root, other_keys);
+    cache.store(*other_key, description, {get_result_constant(folded_model)});
+
+    EXPECT_TRUE(cache.load(*other_key, other_root, ov::util::ConstantFoldCache::describe(other_root, other_keys))
+                    .empty());
+    EXPECT_FALSE(cache.load(*other_key, root, description).empty());
+
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST(constant_folding, fold_cache_evicts_least_recently_used) {
+    const std::filesystem::path cache_dir = ov::test::utils::generateTestFilePrefix() + "_cf_cache";
+    // the result of the model takes 16 KB, so the cache holds one of them
+    const auto cache = std::make_shared<ov::util::ConstantFoldCache>(cache_dir, 0, 24 * 1024);
+    ov::util::set_constant_fold_cache(cache);
+
+    auto model = make_fold_cache_model(2.0f);
+    run_constant_folding(model);
+    EXPECT_FALSE(load_folded(*cache, make_fold_cache_model(2.0f)).empty());
+
+    auto other_model = make_fold_cache_model(3.0f);
+    run_constant_folding(other_model);
+    EXPECT_FALSE(load_folded(*cache, make_fold_cache_model(3.0f)).empty());
+    EXPECT_TRUE(load_folded(*cache, make_fold_cache_model(2.0f)).empty());
+
+    // the result larger than the whole cache is not stored
+    const std::filesystem::path small_cache_dir = cache_dir.string() + "_small";
+    const auto small_cache = std::make_shared<ov::util::ConstantFoldCache>(small_cache_dir, 0, 1024);
+    ov::util::set_constant_fold_cache(small_cache);
+    auto large_model = make_fold_cache_model();
+    run_constant_folding(large_model);
+    EXPECT_TRUE(load_folded(*small_cache, make_fold_cache_model()).empty());
+
+    ov::util::set_constant_fold_cache(nullptr);
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::remove_all(small_cache_dir);
+}
+
+TEST(constant_folding, fold_cache_scope) {
+    const std::filesystem::path cache_dir = ov::test::utils::generateTestFilePrefix() + "_cf_cache";
+    {
+        ov::util::ConstantFoldCacheScope scope(std::make_shared<ov::util::ConstantFoldCache>(cache_dir, 0));
+        ASSERT_NE(ov::util::get_constant_fold_cache(), nullptr);
+        auto model = make_fold_cache_model();
+        run_constant_folding(model);
+    }
+    EXPECT_EQ(ov::util::get_constant_fold_cache(), nullptr);
+    // the folded result is reused by another cache in the same directory
+    EXPECT_FALSE(load_folded(ov::util::ConstantFoldCache(cache_dir, 0), make_fold_cache_model()).empty());
+    std::filesystem::remove_all(cache_dir);
+}
+
 class UnsupportedTypesTest : public testing::TestWithParam<element::Type> {};
 
 TEST_P(UnsupportedTypesTest, add_multiply) {
@@ -8,6 +8,8 @@
 
 #include <fstream>
 #include <iterator>
+#include <numeric>
+#include <sstream>
 
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
@@ -95,6 +97,26 @@ TEST_P(SerializePassTestP, serialize_simple_model_with_constant) {
     EXPECT_TRUE(is_valid) << error_msg;
 }
 
+TEST_F(SerializePassTest, serialize_to_file_same_as_to_stream) {
+    const auto p1 = std::make_shared<Parameter>(element::f32, PartialShape{1024});
+    std::vector<float> values(1024);
+    std::iota(values.begin(), values.end(), 0.0f);
+    const auto c1 = std::make_shared<Constant>(element::f32, Shape{1024}, values);
+    const auto c2 = std::make_shared<Constant>(element::f32, Shape{1024}, values);
+    const auto c3 = std::make_shared<Constant>(element::f32, Shape{1024}, std::vector<float>{2.0f});
+    const auto s1 = std::make_shared<Constant>(element::string, Shape{3}, std::vector<std::string>{"a", "bc", "a"});
+    const auto add = std::make_shared<Add>(std::make_shared<Add>(p1, c1), std::make_shared<Add>(c2, c3));
+    m_model = std::make_shared<Model>(OutputVector{add, s1}, ParameterVector{p1}, "simple_model");
+
+    std::stringstream xml_stream, bin_stream;
+    OV_ASSERT_NO_THROW(pass::Serialize(xml_stream, bin_stream).run_on_model(m_model));
+    OV_ASSERT_NO_THROW(pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(m_model));
+
+    std::ifstream bin_file(m_out_bin_path, std::ios::binary);
+    const std::string bin_data{std::istreambuf_iterator<char>(bin_file), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(bin_data, bin_stream.str());
+}
+
 using SerializationParams = std::tuple<std::string, std::string>;
 
 class SerializationTest : public ov::test::TestsCommon, public testing::WithParamInterface<SerializationParams> {
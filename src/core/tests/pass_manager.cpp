@@ -364,3 +364,33 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, profile) {
+    auto model = make_test_graph();
+    const auto node_count = model->get_ordered_ops().size();
+
+    pass::Manager pass_manager("TestManager");
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.enable_profiling();
+    pass_manager.register_pass<TestMatcherPassFalse>();
+    pass_manager.register_pass<TestModelPassTrue>();
+    pass_manager.run_passes(model);
+
+    const auto& profile = pass_manager.get_profile();
+    EXPECT_EQ(profile.name, "TestManager");
+    EXPECT_TRUE(profile.changed_model);
+    ASSERT_EQ(profile.children.size(), 2);
+
+    const auto& matcher_pass_profile = profile.children[0];
+    EXPECT_FALSE(matcher_pass_profile.changed_model);
+    EXPECT_EQ(matcher_pass_profile.nodes_visited, node_count);
+    ASSERT_EQ(matcher_pass_profile.children.size(), 1);
+    EXPECT_EQ(matcher_pass_profile.children[0].name, "TestMatcherPassFalse");
+    EXPECT_EQ(matcher_pass_profile.children[0].matcher_calls, node_count);
+    EXPECT_EQ(matcher_pass_profile.children[0].matcher_hits, 0);
+    EXPECT_TRUE(profile.children[1].changed_model);
+
+    std::stringstream trace;
+    pass::write_chrome_trace(profile, trace);
+    EXPECT_NE(trace.str().find(R"("name":"TestMatcherPassFalse")"), std::string::npos);
+}
@@ -47,6 +47,34 @@ public:
 
     void execute(Task task) override;
 
+    /**
+     * @brief Run the task on the thread of the preferred stream. The task can be stolen by an idle stream only when
+     *        the preferred stream is busy, so requests keep their NUMA node and cache locality while balanced
+     * @param task A task to start
+     * @param stream_index Index of the preferred stream
+     */
+    void run_on_stream(Task task, int stream_index) override;
+
+    /**
+     * @brief Queue the task by its priority class and deadline. Own tasks of the preferred stream go before the
+     *        common ones of the same priority
+     * @param task A task to start
+     * @param priority Priority class of the task
+     * @param deadline Time point the task should be started by
+     * @param stream_index Index of the preferred stream, or -1 if the task can run on any stream
+     */
+    void run_with_priority(Task task,
+                           ov::hint::Priority priority,
+                           std::chrono::steady_clock::time_point deadline,
+                           int stream_index) override;
+
+    /**
+     * @brief Runs the queued tasks of a higher priority than the current task inline on the calling stream thread.
+     *        Returns immediately if there are no such tasks or the caller is not a thread of this executor
+     * @return true if any task was run
+     */
+    bool yield_to_higher_priority() override;
+
     int get_stream_id() override;
 
     int get_streams_num() override;
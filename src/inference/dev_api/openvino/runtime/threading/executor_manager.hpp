@@ -45,6 +45,17 @@ public:
     virtual std::shared_ptr<ov::threading::IStreamsExecutor> get_idle_cpu_streams_executor(
         const ov::threading::IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns cpu streams executor shared by all the callers with the same config, even if it is in use, so
+     * their tasks are scheduled by priority in a single set of streams instead of competing for the cores
+     *
+     * @param config Streams executor config
+     *
+     * @return pointer to streams executor
+     */
+    virtual std::shared_ptr<ov::threading::IStreamsExecutor> get_shared_cpu_streams_executor(
+        const ov::threading::IStreamsExecutor::Config& config) = 0;
+
     /**
      * @brief Allows to configure executor manager
      *
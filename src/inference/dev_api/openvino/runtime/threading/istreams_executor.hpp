@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -289,6 +290,35 @@ public:
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
+
+    /**
+     * @brief Run the task preferably on the stream with the given index, so the data touched by the task stays local
+     *        to the stream. The default implementation ignores the preference and calls run()
+     * @param task A task to start
+     * @param stream_index Index of the preferred stream in the [0, get_streams_num()) range
+     */
+    virtual void run_on_stream(Task task, int stream_index);
+
+    /**
+     * @brief Run the task according to its priority class and deadline: tasks of a higher priority are started first,
+     *        tasks of the same priority are started in the earliest deadline first order. The default implementation
+     *        ignores the priority and the deadline and calls run_on_stream() or run()
+     * @param task A task to start
+     * @param priority Priority class of the task
+     * @param deadline Time point the task should be started by
+     * @param stream_index Index of the preferred stream, or -1 if the task can run on any stream
+     */
+    virtual void run_with_priority(Task task,
+                                   ov::hint::Priority priority,
+                                   std::chrono::steady_clock::time_point deadline,
+                                   int stream_index);
+
+    /**
+     * @brief Preemption point of long tasks: runs the queued tasks of a higher priority than the task executed by the
+     *        calling stream thread before returning. The default implementation does nothing
+     * @return true if any task was run
+     */
+    virtual bool yield_to_higher_priority();
 };
 
 static std::mutex _streams_executor_mutex;
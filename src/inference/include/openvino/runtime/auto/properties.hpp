@@ -37,7 +37,8 @@ static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK
 enum class SchedulePolicy {
     ROUND_ROBIN = 0,            // will schedule the infer request using round robin policy
     DEVICE_PRIORITY = 1,        // will schedule the infer request based on the device priority
-    DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
+    SHORTEST_EXPECTED_DELAY = 2,  // will schedule the infer request to the device with the shortest expected delay
+    DEFAULT = DEVICE_PRIORITY,    //!<  Default schedule policy is DEVICE_PRIORITY
 };
 
 /** @cond INTERNAL */
@@ -47,6 +48,8 @@ inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy)
         return os << "ROUND_ROBIN";
     case SchedulePolicy::DEVICE_PRIORITY:
         return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::SHORTEST_EXPECTED_DELAY:
+        return os << "SHORTEST_EXPECTED_DELAY";
     default:
         OPENVINO_THROW("Unsupported schedule policy value");
     }
@@ -59,6 +62,8 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
         policy = SchedulePolicy::ROUND_ROBIN;
     } else if (str == "DEVICE_PRIORITY") {
         policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "SHORTEST_EXPECTED_DELAY") {
+        policy = SchedulePolicy::SHORTEST_EXPECTED_DELAY;
     } else if (str == "DEFAULT") {
         policy = SchedulePolicy::DEFAULT;
     } else {
@@ -74,5 +79,14 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
  * @ingroup ov_runtime_cpp_prop_api
  */
 static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
+/**
+ * @brief Read-only property to get load statistics of each hardware device in AUTO CUMULATIVE_THROUGHPUT or MULTI case
+ * The value maps a device name to ov::AnyMap with keys "IN_FLIGHT" (number of running infer requests),
+ * "COMPLETED" (number of completed infer requests) and "LATENCY_EWMA_MS" (exponentially weighted moving average of
+ * the infer request latency in milliseconds)
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> device_load_statistics{"DEVICE_LOAD_STATISTICS"};
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides CompletionQueue.
+ *
+ * @file openvino/runtime/completion_queue.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief Queue of finished asynchronous inferences that is drained in bulk.
+ *
+ * Requests started through the queue do not need a user callback or a waiting thread each: when a request completes,
+ * it is appended to the queue and a single thread collects all the requests completed so far with one call to
+ * CompletionQueue::wait or CompletionQueue::wait_for. Waiting threads are woken up only when the queue becomes
+ * non-empty, so requests completing while the previous batch is processed are returned together with no extra wakeup.
+ * @note The queue installs its own completion callback on the started requests.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API CompletionQueue {
+public:
+    /**
+     * @brief Finished request returned by the queue.
+     */
+    struct Completion {
+        /// @brief Finished request.
+        InferRequest request;
+        /// @brief User tag passed to CompletionQueue::start_async.
+        uint64_t tag = 0;
+        /// @brief Exception thrown by the inference, or nullptr if the inference succeeded.
+        std::exception_ptr exception;
+    };
+
+    /**
+     * @brief Constructs an empty queue.
+     */
+    CompletionQueue();
+
+    /**
+     * @brief Destructor. Requests that are still running are kept alive by the queue and finish before it is
+     * destroyed.
+     */
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    /**
+     * @brief Starts inference of the request in asynchronous mode. The request is appended to the queue when the
+     * inference finishes.
+     * @param request Request to start. The queue keeps a reference to it until the completion is returned.
+     * @param tag User value returned with the completion.
+     */
+    void start_async(InferRequest& request, uint64_t tag = 0);
+
+    /**
+     * @brief Moves finished requests to @p completions without blocking.
+     * @param completions Vector the finished requests are appended to.
+     * @param max_count Maximum number of requests to return.
+     * @return Number of returned requests.
+     */
+    size_t poll(std::vector<Completion>& completions, size_t max_count = SIZE_MAX);
+
+    /**
+     * @brief Blocks until at least one request is finished and moves finished requests to @p completions.
+     * @param completions Vector the finished requests are appended to.
+     * @param max_count Maximum number of requests to return.
+     * @return Number of returned requests. It is zero only if no request was started through the queue.
+     */
+    size_t wait(std::vector<Completion>& completions, size_t max_count = SIZE_MAX);
+
+    /**
+     * @brief Waits for at least one finished request for the specified timeout and moves finished requests to
+     * @p completions.
+     * @param completions Vector the finished requests are appended to.
+     * @param max_count Maximum number of requests to return.
+     * @param timeout Maximum duration to block for.
+     * @return Number of returned requests, zero if the timeout expired.
+     */
+    size_t wait_for(std::vector<Completion>& completions, size_t max_count, const std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Returns the number of requests started through the queue that were not returned yet.
+     * @return Number of running and finished requests.
+     */
+    size_t pending() const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> m_impl;
+};
+
+}  // namespace ov
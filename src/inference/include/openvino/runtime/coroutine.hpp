@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides C++20 awaitable wrappers for InferRequest.
+ *
+ * @file openvino/runtime/coroutine.hpp
+ */
+#pragma once
+
+#include <functional>
+
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+
+/**
+ * @brief Runs the resumption of a coroutine awaiting an inference on the executor shared by the awaitables.
+ *
+ * The completion callback of a request runs before the request is finished, so the coroutine is not resumed from
+ * the callback itself: an InferRequest::wait call from the resumed coroutine would never return.
+ * @param resumption Task resuming the coroutine.
+ * @ingroup ov_runtime_cpp_api
+ */
+OPENVINO_RUNTIME_API void post_resumption(std::function<void()> resumption);
+
+}  // namespace ov
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#    if __has_include(<coroutine>)
+#        define OV_RUNTIME_HAS_COROUTINE
+#    endif
+#endif
+
+#ifdef OV_RUNTIME_HAS_COROUTINE
+
+#    include <coroutine>
+#    include <exception>
+
+#    include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief Awaitable that starts asynchronous inference of a request and resumes the awaiting coroutine when the
+ * inference finishes.
+ *
+ * The completion callback of the request posts the resumption of the coroutine with ov::post_resumption, so the
+ * coroutine continues on the executor shared by the awaitables once the request is finished, and may wait for or
+ * restart the request. The request must stay alive until the coroutine is resumed.
+ * @note The awaitable overwrites the completion callback of the request.
+ * @ingroup ov_runtime_cpp_api
+ */
+class InferRequestAwaiter {
+public:
+    /**
+     * @brief Constructs the awaitable for the request.
+     * @param request Request to start on suspension.
+     */
+    explicit InferRequestAwaiter(InferRequest& request) : m_request(request) {}
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        m_request.set_callback([this, handle](std::exception_ptr exception) {
+            m_exception = exception;
+            // The awaiter may be gone once the coroutine is resumed, so the callback referencing it is replaced
+            // beforehand. The new callback is not empty, otherwise the request would restore this one.
+            m_request.set_callback([](std::exception_ptr) {});
+            post_resumption([handle] {
+                handle.resume();
+            });
+        });
+        m_request.start_async();
+    }
+
+    void await_resume() const {
+        if (m_exception)
+            std::rethrow_exception(m_exception);
+    }
+
+private:
+    InferRequest& m_request;
+    std::exception_ptr m_exception;
+};
+
+/**
+ * @brief Starts asynchronous inference of the request when awaited: `co_await ov::async_infer(request);`.
+ * @param request Request to infer.
+ * @return Awaitable that rethrows the inference exception, if any, on resumption.
+ * @ingroup ov_runtime_cpp_api
+ */
+inline InferRequestAwaiter async_infer(InferRequest& request) {
+    return InferRequestAwaiter{request};
+}
+
+}  // namespace ov
+
+#endif  // OV_RUNTIME_HAS_COROUTINE
@@ -993,6 +993,18 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to set the maximal size in bytes of the constant folding cache. Disabled by default.
+ * When it is set together with ov::cache_dir, results of the constant folding done during model compilation are
+ * stored in the `constant_folding` subdirectory of the cache directory and reused by the following compilations.
+ * The least recently used results are removed once the cache exceeds the size.
+ *
+ * value type: uint64_t
+ *   - 0 disables the cache
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> constant_folding_cache_size{"CONSTANT_FOLDING_CACHE_SIZE"};
+
 /**
  * @brief Namespace with device properties
  */
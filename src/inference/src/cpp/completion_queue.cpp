@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/completion_queue.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace ov {
+
+struct CompletionQueue::Impl {
+    // Called from the completion callback of the request, so it only moves the entry and wakes a waiter up if the
+    // queue was empty: waiters drain everything accumulated since then in a single batch
+    void complete(uint64_t key, std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto it = m_in_flight.find(key);
+        // The request may have been restarted by the user without the queue after the completion was returned
+        if (it == m_in_flight.end())
+            return;
+        it->second.exception = std::move(exception);
+        m_completed.push_back(std::move(it->second));
+        m_in_flight.erase(it);
+        if (m_waiters == 0)
+            return;
+        if (m_in_flight.empty()) {
+            m_cv.notify_all();
+        } else if (m_completed.size() == 1) {
+            m_cv.notify_one();
+        }
+    }
+
+    size_t drain(std::vector<Completion>& completions, size_t max_count) {
+        const size_t count = std::min(max_count, m_completed.size());
+        completions.reserve(completions.size() + count);
+        for (size_t i = 0; i < count; i++) {
+            completions.push_back(std::move(m_completed.front()));
+            m_completed.pop_front();
+        }
+        // Wake another waiter up if this one left some completions behind
+        if (m_waiters > 0 && !m_completed.empty())
+            m_cv.notify_one();
+        return count;
+    }
+
+    template <typename Wait>
+    size_t wait(std::vector<Completion>& completions, size_t max_count, Wait&& wait_func) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_waiters++;
+        wait_func(lock, [this] {
+            return !m_completed.empty() || m_in_flight.empty();
+        });
+        m_waiters--;
+        return drain(completions, max_count);
+    }
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::unordered_map<uint64_t, Completion> m_in_flight;
+    std::deque<Completion> m_completed;
+    uint64_t m_next_key = 0;
+    size_t m_waiters = 0;
+};
+
+CompletionQueue::CompletionQueue() : m_impl{std::make_shared<Impl>()} {}
+
+CompletionQueue::~CompletionQueue() {
+    std::deque<Completion> completed;
+    {
+        std::unique_lock<std::mutex> lock{m_impl->m_mutex};
+        m_impl->m_waiters++;
+        m_impl->m_cv.wait(lock, [this] {
+            return m_impl->m_in_flight.empty();
+        });
+        m_impl->m_waiters--;
+        completed.swap(m_impl->m_completed);
+    }
+    // The requests are released outside of the lock and never from a completion callback
+}
+
+void CompletionQueue::start_async(InferRequest& request, uint64_t tag) {
+    uint64_t key = 0;
+    {
+        std::lock_guard<std::mutex> lock{m_impl->m_mutex};
+        key = m_impl->m_next_key++;
+        m_impl->m_in_flight.emplace(key, Completion{request, tag, nullptr});
+    }
+    try {
+        // The request is owned by the queue, so the callback holds a weak reference to avoid a cycle
+        request.set_callback([weak_impl = std::weak_ptr<Impl>(m_impl), key](std::exception_ptr exception) {
+            if (auto impl = weak_impl.lock())
+                impl->complete(key, std::move(exception));
+        });
+        request.start_async();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock{m_impl->m_mutex};
+        m_impl->m_in_flight.erase(key);
+        if (m_impl->m_waiters > 0 && m_impl->m_in_flight.empty())
+            m_impl->m_cv.notify_all();
+        throw;
+    }
+}
+
+size_t CompletionQueue::poll(std::vector<Completion>& completions, size_t max_count) {
+    std::lock_guard<std::mutex> lock{m_impl->m_mutex};
+    return m_impl->drain(completions, max_count);
+}
+
+size_t CompletionQueue::wait(std::vector<Completion>& completions, size_t max_count) {
+    return m_impl->wait(completions, max_count, [this](std::unique_lock<std::mutex>& lock, const auto& ready) {
+        m_impl->m_cv.wait(lock, ready);
+    });
+}
+
+size_t CompletionQueue::wait_for(std::vector<Completion>& completions,
+                                 size_t max_count,
+                                 const std::chrono::milliseconds timeout) {
+    return m_impl->wait(completions, max_count, [&](std::unique_lock<std::mutex>& lock, const auto& ready) {
+        m_impl->m_cv.wait_for(lock, timeout, ready);
+    });
+}
+
+size_t CompletionQueue::pending() const {
+    std::lock_guard<std::mutex> lock{m_impl->m_mutex};
+    return m_impl->m_in_flight.size() + m_impl->m_completed.size();
+}
+
+}  // namespace ov
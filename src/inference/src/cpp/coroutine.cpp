@@ -0,0 +1,18 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/coroutine.hpp"
+
+#include <utility>
+
+#include "openvino/runtime/threading/executor_manager.hpp"
+
+namespace ov {
+
+void post_resumption(std::function<void()> resumption) {
+    // The executor is not shared with the plugins, so the resumed coroutines are not queued behind the inferences
+    threading::executor_manager()->get_executor("OVCoroutineResumption")->run(std::move(resumption));
+}
+
+}  // namespace ov
@@ -12,6 +12,7 @@
 #include "itt.hpp"
 #include "model_reader.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/core/constant_fold_cache.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/op_extension.hpp"
@@ -214,6 +215,7 @@ static const auto core_properties_names = ov::util::make_array(ov::cache_dir.nam
                                                                ov::cache_model_path.name(),
                                                                ov::cache_blob_id.name(),
                                                                ov::enable_mmap.name(),
+                                                               ov::constant_folding_cache_size.name(),
                                                                ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
@@ -871,6 +873,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_cache_dir = cache_dir;
+        cache_content.m_constant_folding_cache_size = parsed.m_core_config.get_constant_folding_cache_size();
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
@@ -908,6 +912,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_cache_dir = cache_dir;
+        cache_content.m_constant_folding_cache_size = parsed.m_core_config.get_constant_folding_cache_size();
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
@@ -941,6 +947,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         CoreConfig::remove_core(parsed.m_config);
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), model_path};
+        cache_content.m_cache_dir = cache_dir;
+        cache_content.m_constant_folding_cache_size = parsed.m_core_config.get_constant_folding_cache_size();
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(cache_content.m_model_path, create_compile_config(plugin, parsed.m_config));
         });
@@ -971,6 +979,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap()};
+        cache_content.m_cache_dir = cache_dir;
+        cache_content.m_constant_folding_cache_size = parsed.m_core_config.get_constant_folding_cache_size();
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed.m_config));
         });
@@ -1282,6 +1292,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::constant_folding_cache_size.name()) {
+        return decltype(ov::constant_folding_cache_size)::value_type(m_core_config.get_constant_folding_cache_size());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1495,7 +1507,20 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin&
             ? get_cfg_with_shared_ctx(parsed_config, cache_content)
             : parsed_config;
 
-    auto compiled_model = context ? plugin.compile_model(model, context, cfg) : plugin.compile_model(model, cfg);
+    ov::SoPtr<ov::ICompiledModel> compiled_model;
+    {
+        // folded constants are cached next to the compiled models, so they are reused when the model is compiled
+        // again with other properties or for other devices
+        const auto use_constant_fold_cache =
+            !cache_content.m_cache_dir.empty() && cache_content.m_constant_folding_cache_size != 0;
+        ov::util::ConstantFoldCacheScope constant_fold_cache_scope(
+            use_constant_fold_cache
+                ? std::make_shared<ov::util::ConstantFoldCache>(cache_content.m_cache_dir / "constant_folding",
+                                                                4096,
+                                                                cache_content.m_constant_folding_cache_size)
+                : nullptr);
+        compiled_model = context ? plugin.compile_model(model, context, cfg) : plugin.compile_model(model, cfg);
+    }
     if (cache_content.m_cache_manager && device_supports_model_caching(plugin)) {
         try {
             // need to export network for further import from "cache"
@@ -1700,6 +1725,7 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         m_devices_cache_config = other.m_devices_cache_config;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
+    m_constant_folding_cache_size = other.m_constant_folding_cache_size;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
@@ -1723,6 +1749,10 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::constant_folding_cache_size.name()); cfg_entry != config.end()) {
+        m_constant_folding_cache_size = cfg_entry->second.as<uint64_t>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1745,6 +1775,10 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+uint64_t ov::CoreConfig::get_constant_folding_cache_size() const {
+    return m_constant_folding_cache_size;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
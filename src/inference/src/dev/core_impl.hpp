@@ -48,6 +48,8 @@ public:
 
     bool get_enable_mmap() const;
 
+    uint64_t get_constant_folding_cache_size() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -59,6 +61,7 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    uint64_t m_constant_folding_cache_size{0};
 };
 
 struct Parsed {
@@ -158,6 +161,8 @@ private:
         ov::IContextStore* m_shared_ctx{};
         std::string m_blob_id{};
         std::filesystem::path m_model_path{};
+        std::filesystem::path m_cache_dir{};
+        uint64_t m_constant_folding_cache_size{};
         std::shared_ptr<const ov::Model> model{};
         bool m_mmap_enabled{};
     };
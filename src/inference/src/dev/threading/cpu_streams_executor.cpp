@@ -4,8 +4,13 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -24,6 +29,16 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// The executor, the stream index and the priority of the current task of a stream thread
+struct WorkerState {
+    const void* impl = nullptr;
+    int stream = -1;
+    ov::hint::Priority priority = ov::hint::Priority::MEDIUM;
+};
+thread_local WorkerState t_worker;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
@@ -352,6 +367,10 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        _affineTaskQueues.resize(streams_num);
+        _streamBusy.resize(streams_num, false);
+        _streamIdle.resize(streams_num, false);
+        _streamCondVars = std::vector<std::condition_variable>(streams_num);
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -359,32 +378,218 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                t_worker = {this, streamId, ov::hint::Priority::MEDIUM};
                 for (bool stopped = false; !stopped;) {
-                    Task task;
+                    QueuedTask task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        while (!PopTask(streamId, task) && !(stopped = _isStopped)) {
+                            _streamIdle[streamId] = true;
+                            _streamCondVars[streamId].wait(lock);
+                        }
+                        _streamIdle[streamId] = false;
+                        _streamBusy[streamId] = static_cast<bool>(task.task);
+                        if (task.task && HasStealableTask()) {
+                            // each stream taking a task wakes the next idle one, while the tasks can be stolen
+                            WakeIdleStream();
                         }
                     }
-                    if (task) {
-                        Execute(task, *(_streams->local()));
+                    if (task.task) {
+                        t_worker.priority = task.priority;
+                        Execute(task.task, *(_streams->local()));
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _streamBusy[streamId] = false;
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    // A task waiting in the queues. Tasks without an explicit deadline use the submission time, so they are started
+    // in FIFO order and are not starved by the tasks with a deadline
+    struct QueuedTask {
+        Task task;
+        ov::hint::Priority priority = ov::hint::Priority::MEDIUM;
+        std::chrono::steady_clock::time_point deadline;
+        uint64_t seq = 0;
+    };
+
+    // Higher priority class first, the earliest deadline first inside the class
+    static bool RunsBefore(const QueuedTask& lhs, const QueuedTask& rhs) {
+        if (lhs.priority != rhs.priority) {
+            return lhs.priority > rhs.priority;
         }
-        _queueCondVar.notify_one();
+        if (lhs.deadline != rhs.deadline) {
+            return lhs.deadline < rhs.deadline;
+        }
+        return lhs.seq < rhs.seq;
+    }
+
+    static bool RunsAfter(const QueuedTask& lhs, const QueuedTask& rhs) {
+        return RunsBefore(rhs, lhs);
+    }
+
+    // Must be called under _mutex
+    void Take(QueuedTask& from, QueuedTask& to) {
+        _queuedTasks[static_cast<int>(from.priority)]--;
+        to = std::move(from);
+    }
+
+    void TakeFront(std::deque<QueuedTask>& queue, QueuedTask& task) {
+        Take(queue.front(), task);
+        queue.pop_front();
+    }
+
+    void TakeTop(QueuedTask& task) {
+        std::pop_heap(_taskQueue.begin(), _taskQueue.end(), RunsAfter);
+        Take(_taskQueue.back(), task);
+        _taskQueue.pop_back();
+    }
+
+    // Must be called under _mutex. The own queue of the stream goes first unless the common queue has a task of a
+    // higher priority. Tasks of the other streams are stolen only if their stream is busy, i.e. the load is not
+    // balanced
+    bool PopTask(int streamId, QueuedTask& task) {
+        auto& own = _affineTaskQueues[streamId];
+        if (!_taskQueue.empty() && (own.empty() || _taskQueue.front().priority > own.front().priority)) {
+            TakeTop(task);
+            return true;
+        }
+        if (!own.empty()) {
+            TakeFront(own, task);
+            return true;
+        }
+        std::deque<QueuedTask>* victim = nullptr;
+        for (size_t i = 0; i < _affineTaskQueues.size(); ++i) {
+            if (_streamBusy[i] && !_affineTaskQueues[i].empty() &&
+                (!victim || _affineTaskQueues[i].front().priority > victim->front().priority ||
+                 (_affineTaskQueues[i].front().priority == victim->front().priority &&
+                  _affineTaskQueues[i].size() > victim->size()))) {
+                victim = &_affineTaskQueues[i];
+            }
+        }
+        if (!victim) {
+            return false;
+        }
+        TakeFront(*victim, task);
+        return true;
+    }
+
+    // Must be called under _mutex. Only the own queue and the common queue are checked, the tasks of the other
+    // streams are left to them
+    bool PopTaskAbove(int streamId, ov::hint::Priority priority, QueuedTask& task) {
+        auto& own = _affineTaskQueues[streamId];
+        const bool own_above = !own.empty() && own.front().priority > priority;
+        const bool common_above = !_taskQueue.empty() && _taskQueue.front().priority > priority;
+        if (common_above && (!own_above || _taskQueue.front().priority > own.front().priority)) {
+            TakeTop(task);
+            return true;
+        }
+        if (own_above) {
+            TakeFront(own, task);
+            return true;
+        }
+        return false;
+    }
+
+    bool HasQueuedAbove(ov::hint::Priority priority) const {
+        for (int p = static_cast<int>(priority) + 1; p < static_cast<int>(_queuedTasks.size()); ++p) {
+            if (_queuedTasks[p] > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Must be called under _mutex. The stream is marked as woken up, so the next task wakes another idle stream
+    void WakeStream(size_t streamId) {
+        _streamIdle[streamId] = false;
+        _streamCondVars[streamId].notify_one();
+    }
+
+    // Must be called under _mutex
+    bool HasStealableTask() const {
+        if (!_taskQueue.empty()) {
+            return true;
+        }
+        for (size_t i = 0; i < _affineTaskQueues.size(); ++i) {
+            if (_streamBusy[i] && !_affineTaskQueues[i].empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Must be called under _mutex
+    void WakeIdleStream() {
+        const auto idle = std::find(_streamIdle.begin(), _streamIdle.end(), true);
+        if (idle != _streamIdle.end()) {
+            WakeStream(static_cast<size_t>(std::distance(_streamIdle.begin(), idle)));
+        }
+    }
+
+    QueuedTask MakeQueuedTask(Task task, ov::hint::Priority priority, std::chrono::steady_clock::time_point deadline) {
+        OPENVINO_ASSERT(static_cast<int>(priority) >= 0 && static_cast<int>(priority) < 3,
+                        "Unsupported task priority: ",
+                        priority);
+        return {std::move(task), priority, deadline, _nextSeq++};
+    }
+
+    void Enqueue(Task task,
+                 int streamId,
+                 ov::hint::Priority priority = ov::hint::Priority::MEDIUM,
+                 std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto target = static_cast<size_t>(streamId) % _affineTaskQueues.size();
+        auto& queue = _affineTaskQueues[target];
+        auto queued = MakeQueuedTask(std::move(task), priority, deadline);
+        _queuedTasks[static_cast<int>(priority)]++;
+        queue.insert(std::upper_bound(queue.begin(), queue.end(), queued, RunsBefore), std::move(queued));
+        // the preferred stream runs the task if it is idle, otherwise one idle stream may steal it
+        if (_streamIdle[target]) {
+            WakeStream(target);
+        } else if (_streamBusy[target]) {
+            WakeIdleStream();
+        }
+    }
+
+    void Enqueue(Task task,
+                 ov::hint::Priority priority = ov::hint::Priority::MEDIUM,
+                 std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _taskQueue.push_back(MakeQueuedTask(std::move(task), priority, deadline));
+        _queuedTasks[static_cast<int>(priority)]++;
+        std::push_heap(_taskQueue.begin(), _taskQueue.end(), RunsAfter);
+        WakeIdleStream();
+    }
+
+    bool YieldToHigherPriority() {
+        // the fast path is a few atomic loads, so it can be called between the nodes of a graph
+        if (t_worker.impl != this || !HasQueuedAbove(t_worker.priority)) {
+            return false;
+        }
+        bool yielded = false;
+        for (QueuedTask task;;) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!PopTaskAbove(t_worker.stream, t_worker.priority, task)) {
+                    break;
+                }
+            }
+            // the caller is already inside the stream arena, so the task is run directly
+            const auto priority = t_worker.priority;
+            t_worker.priority = task.priority;
+            try {
+                task.task();
+            } catch (...) {
+                t_worker.priority = priority;
+                throw;
+            }
+            t_worker.priority = priority;
+            task.task = {};
+            yielded = true;
+        }
+        return yielded;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -453,8 +658,13 @@ struct CPUStreamsExecutor::Impl {
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
     std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<std::condition_variable> _streamCondVars;
+    std::vector<QueuedTask> _taskQueue;  // binary heap ordered by RunsBefore
+    std::vector<std::deque<QueuedTask>> _affineTaskQueues;
+    std::array<std::atomic<size_t>, 3> _queuedTasks{};  // number of queued tasks per priority class
+    uint64_t _nextSeq = 0;
+    std::vector<bool> _streamBusy;
+    std::vector<bool> _streamIdle;  // waiting for a task and not woken up yet
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -515,8 +725,10 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     {
         std::lock_guard<std::mutex> lock(_impl->_mutex);
         _impl->_isStopped = true;
+        for (auto& condVar : _impl->_streamCondVars) {
+            condVar.notify_one();
+        }
     }
-    _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -536,5 +748,30 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_on_stream(Task task, int stream_index) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), std::max(0, stream_index));
+    }
+}
+
+void CPUStreamsExecutor::run_with_priority(Task task,
+                                           ov::hint::Priority priority,
+                                           std::chrono::steady_clock::time_point deadline,
+                                           int stream_index) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else if (stream_index < 0) {
+        _impl->Enqueue(std::move(task), priority, deadline);
+    } else {
+        _impl->Enqueue(std::move(task), stream_index, priority, deadline);
+    }
+}
+
+bool CPUStreamsExecutor::yield_to_higher_priority() {
+    return _impl->YieldToHigherPriority();
+}
+
 }  // namespace threading
 }  // namespace ov
@@ -15,6 +15,7 @@
 #    endif
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,6 +30,8 @@ public:
     std::shared_ptr<ov::threading::ITaskExecutor> get_executor(const std::string& id) override;
     std::shared_ptr<ov::threading::IStreamsExecutor> get_idle_cpu_streams_executor(
         const ov::threading::IStreamsExecutor::Config& config) override;
+    std::shared_ptr<ov::threading::IStreamsExecutor> get_shared_cpu_streams_executor(
+        const ov::threading::IStreamsExecutor::Config& config) override;
     size_t get_executors_number() const override;
     size_t get_idle_cpu_streams_executors_number() const override;
     void clear(const std::string& id = {}) override;
@@ -42,6 +45,10 @@ private:
     std::unordered_map<std::string, std::shared_ptr<ov::threading::ITaskExecutor>> executors;
     std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::shared_ptr<ov::threading::IStreamsExecutor>>>
         cpuStreamsExecutors;
+    // the shared executors are owned by their users, so an executor is destroyed and releases its cores once the
+    // last user is gone
+    std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::weak_ptr<ov::threading::IStreamsExecutor>>>
+        sharedCpuStreamsExecutors;
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
@@ -142,6 +149,33 @@ std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_idle_c
     return newExec;
 }
 
+std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_shared_cpu_streams_executor(
+    const ov::threading::IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    sharedCpuStreamsExecutors.erase(std::remove_if(sharedCpuStreamsExecutors.begin(),
+                                                   sharedCpuStreamsExecutors.end(),
+                                                   [](const auto& it) {
+                                                       return it.second.expired();
+                                                   }),
+                                    sharedCpuStreamsExecutors.end());
+    for (auto& it : sharedCpuStreamsExecutors) {
+        // the executor runs on the cores reserved by the config it was created with, so a config with other
+        // reserved cores gets its own executor
+        if (it.first == config && it.first.get_stream_processor_ids() == config.get_stream_processor_ids()) {
+            if (auto executor = it.second.lock())
+                return executor;
+        }
+    }
+    std::shared_ptr<ov::threading::IStreamsExecutor> newExec(new ov::threading::CPUStreamsExecutor(config),
+                                                             [](ov::threading::CPUStreamsExecutor* executor) {
+                                                                 executor->cpu_reset();
+                                                                 delete executor;
+                                                             });
+    tbbThreadsCreated = true;
+    sharedCpuStreamsExecutors.emplace_back(config, newExec);
+    return newExec;
+}
+
 size_t ExecutorManagerImpl::get_executors_number() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -158,15 +192,17 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCpuStreamsExecutors.clear();
     } else {
         executors.erase(id);
-        cpuStreamsExecutors.erase(std::remove_if(cpuStreamsExecutors.begin(),
-                                                 cpuStreamsExecutors.end(),
-                                                 [&](std::pair<ov::threading::IStreamsExecutor::Config,
-                                                               std::shared_ptr<ov::threading::IStreamsExecutor>>& it) {
-                                                     return it.first.get_name() == id;
-                                                 }),
+        auto has_id = [&](const auto& it) {
+            return it.first.get_name() == id;
+        };
+        cpuStreamsExecutors.erase(std::remove_if(cpuStreamsExecutors.begin(), cpuStreamsExecutors.end(), has_id),
                                   cpuStreamsExecutors.end());
+        sharedCpuStreamsExecutors.erase(
+            std::remove_if(sharedCpuStreamsExecutors.begin(), sharedCpuStreamsExecutors.end(), has_id),
+            sharedCpuStreamsExecutors.end());
     }
 }
 
@@ -22,6 +22,25 @@ namespace threading {
 
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run_on_stream(Task task, int) {
+    run(std::move(task));
+}
+
+void IStreamsExecutor::run_with_priority(Task task,
+                                         ov::hint::Priority,
+                                         std::chrono::steady_clock::time_point,
+                                         int stream_index) {
+    if (stream_index < 0) {
+        run(std::move(task));
+    } else {
+        run_on_stream(std::move(task), stream_index);
+    }
+}
+
+bool IStreamsExecutor::yield_to_higher_priority() {
+    return false;
+}
+
 void IStreamsExecutor::Config::set_property(const std::string& key, const ov::Any& value) {
     set_property({{key, value}});
 }
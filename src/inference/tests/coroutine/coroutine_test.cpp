@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/coroutine.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp"
+
+#ifdef OV_RUNTIME_HAS_COROUTINE
+
+using namespace ::testing;
+
+namespace {
+
+struct InferRequest_Impl {
+    typedef std::shared_ptr<ov::IAsyncInferRequest> ov::InferRequest::*type;
+    friend type get(InferRequest_Impl);
+};
+
+template <typename Tag, typename Tag::type M>
+struct Rob {
+    friend typename Tag::type get(Tag) {
+        return M;
+    }
+};
+
+template struct Rob<InferRequest_Impl, &ov::InferRequest::_impl>;
+
+struct FireAndForget {
+    struct promise_type {
+        FireAndForget get_return_object() {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+// Waits for the request after each inference, which never returns if the coroutine is resumed from the callback
+FireAndForget infer_twice(ov::InferRequest& request, std::promise<void>& done) {
+    try {
+        co_await ov::async_infer(request);
+        request.wait();
+        co_await ov::async_infer(request);
+        request.wait();
+        done.set_value();
+    } catch (...) {
+        done.set_exception(std::current_exception());
+    }
+}
+
+}  // namespace
+
+class InferRequestAwaiterTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_impl = std::make_shared<ov::MockIAsyncInferRequest>();
+        m_request.*get(InferRequest_Impl()) = m_impl;
+        EXPECT_CALL(*m_impl, set_callback(_)).WillRepeatedly([this](std::function<void(std::exception_ptr)> callback) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_callback = std::move(callback);
+        });
+        EXPECT_CALL(*m_impl, wait()).WillRepeatedly([this] {
+            std::shared_future<void> finished;
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                finished = m_finished;
+            }
+            finished.get();
+        });
+    }
+
+    void TearDown() override {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            threads = std::move(m_threads);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Like the plugins, calls the completion callback before the request is finished
+    void expect_start_async(std::exception_ptr exception) {
+        EXPECT_CALL(*m_impl, start_async()).WillRepeatedly([this, exception] {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            auto finished = std::make_shared<std::promise<void>>();
+            m_finished = finished->get_future().share();
+            m_threads.emplace_back([this, exception, finished] {
+                std::function<void(std::exception_ptr)> callback;
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    callback = m_callback;
+                }
+                callback(exception);
+                finished->set_value();
+            });
+        });
+    }
+
+    std::shared_ptr<ov::MockIAsyncInferRequest> m_impl;
+    ov::InferRequest m_request;
+    std::mutex m_mutex;
+    std::function<void(std::exception_ptr)> m_callback;
+    std::shared_future<void> m_finished;
+    std::vector<std::thread> m_threads;
+};
+
+TEST_F(InferRequestAwaiterTests, coroutineCanWaitForFinishedRequest) {
+    expect_start_async(nullptr);
+    std::promise<void> done;
+    auto future = done.get_future();
+    infer_twice(m_request, done);
+    OV_ASSERT_NO_THROW(future.get());
+}
+
+TEST_F(InferRequestAwaiterTests, inferenceExceptionIsRethrownInCoroutine) {
+    expect_start_async(std::make_exception_ptr(std::runtime_error("compare")));
+    std::promise<void> done;
+    auto future = done.get_future();
+    infer_twice(m_request, done);
+    OV_EXPECT_THROW_HAS_SUBSTRING(future.get(), std::runtime_error, "compare");
+}
+
+#endif  // OV_RUNTIME_HAS_COROUTINE
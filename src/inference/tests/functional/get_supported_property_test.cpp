@@ -148,6 +148,17 @@ TEST(PropertyTest, SetTBBForceTerminatePropertyCoreNoThrow) {
     EXPECT_TRUE(value);
 }
 
+TEST(PropertyTest, SetConstantFoldingCacheSizePropertyCoreNoThrow) {
+    ov::Core core;
+
+    uint64_t value = 1;
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::constant_folding_cache_size.name()).as<uint64_t>());
+    EXPECT_EQ(value, 0);
+    OV_ASSERT_NO_THROW(core.set_property(ov::constant_folding_cache_size(64 * 1024 * 1024)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::constant_folding_cache_size.name()).as<uint64_t>());
+    EXPECT_EQ(value, 64 * 1024 * 1024);
+}
+
 TEST(PropertyTest, GetUnsupportedPropertyCoreThrow) {
     ov::Core core;
 
@@ -6,6 +6,7 @@
 
 #include <openvino/core/except.hpp>
 #include <openvino/runtime/compiled_model.hpp>
+#include <openvino/runtime/completion_queue.hpp>
 #include <openvino/runtime/infer_request.hpp>
 #include <openvino/runtime/remote_tensor.hpp>
 
@@ -37,6 +38,13 @@ TEST(InferRequestOVTests, throwsOnUninitializedStartAsync) {
     ASSERT_THROW(req.start_async(), ov::Exception);
 }
 
+TEST(InferRequestOVTests, throwsOnUninitializedStartAsyncInCompletionQueue) {
+    ov::InferRequest req;
+    ov::CompletionQueue queue;
+    ASSERT_THROW(queue.start_async(req), ov::Exception);
+    ASSERT_EQ(0, queue.pending());
+}
+
 TEST(InferRequestOVTests, throwsOnUninitializedWait) {
     ov::InferRequest req;
     ASSERT_THROW(req.wait(), ov::Exception);
@@ -4,12 +4,14 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <future>
 #include <thread>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
 using namespace ::testing;
@@ -263,3 +265,150 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+class StreamAffinityTests : public ::testing::Test {
+protected:
+    template <typename F>
+    static std::future<void> async_on_stream(const std::shared_ptr<CPUStreamsExecutor>& executor,
+                                             int stream_index,
+                                             F&& f) {
+        auto p = std::make_shared<std::packaged_task<void()>>(f);
+        auto future = p->get_future();
+        executor->run_on_stream(
+            [p] {
+                (*p)();
+            },
+            stream_index);
+        return future;
+    }
+};
+
+TEST_F(StreamAffinityTests, tasksRunOnPreferredStream) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 4, 1});
+    for (int stream_index = 0; stream_index < 4; stream_index++) {
+        std::thread::id first_thread;
+        async_on_stream(executor, stream_index, [&] {
+            first_thread = std::this_thread::get_id();
+        }).wait();
+        for (int i = 0; i < 10; i++) {
+            std::thread::id thread;
+            async_on_stream(executor, stream_index, [&] {
+                thread = std::this_thread::get_id();
+            }).wait();
+            ASSERT_EQ(first_thread, thread);
+        }
+    }
+}
+
+TEST_F(StreamAffinityTests, taskIsStolenFromBusyStream) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    std::promise<void> release;
+    auto blocked = release.get_future().share();
+    std::promise<void> started;
+    auto busy = async_on_stream(executor, 0, [&] {
+        started.set_value();
+        blocked.wait();
+    });
+    started.get_future().wait();
+    // the preferred stream is busy, so the idle stream runs the task
+    auto stolen = async_on_stream(executor, 0, [] {});
+    ASSERT_EQ(std::future_status::ready, stolen.wait_for(std::chrono::seconds(10)));
+    release.set_value();
+    busy.wait();
+}
+
+class TaskPriorityTests : public ::testing::Test {
+protected:
+    template <typename F>
+    static std::future<void> async_with_priority(const std::shared_ptr<CPUStreamsExecutor>& executor,
+                                                 ov::hint::Priority priority,
+                                                 std::chrono::steady_clock::time_point deadline,
+                                                 F&& f) {
+        auto p = std::make_shared<std::packaged_task<void()>>(f);
+        auto future = p->get_future();
+        executor->run_with_priority(
+            [p] {
+                (*p)();
+            },
+            priority,
+            deadline,
+            -1);
+        return future;
+    }
+};
+
+TEST_F(TaskPriorityTests, tasksStartByPriorityThenDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    const auto now = std::chrono::steady_clock::now();
+    std::promise<void> release;
+    auto blocked = release.get_future().share();
+    std::promise<void> started;
+    std::vector<std::future<void>> futures;
+    futures.push_back(async_with_priority(executor, ov::hint::Priority::MEDIUM, now, [&] {
+        started.set_value();
+        blocked.wait();
+    }));
+    started.get_future().wait();
+
+    // the only stream is busy, so all the tasks below are queued before any of them starts
+    std::vector<int> order;
+    auto add_task = [&](ov::hint::Priority priority, std::chrono::seconds deadline, int id) {
+        futures.push_back(async_with_priority(executor, priority, now + deadline, [&order, id] {
+            order.push_back(id);
+        }));
+    };
+    add_task(ov::hint::Priority::LOW, std::chrono::seconds(0), 3);
+    add_task(ov::hint::Priority::MEDIUM, std::chrono::seconds(2), 2);
+    add_task(ov::hint::Priority::MEDIUM, std::chrono::seconds(1), 1);
+    add_task(ov::hint::Priority::HIGH, std::chrono::seconds(3), 0);
+    release.set_value();
+    for (auto& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ(std::vector<int>({0, 1, 2, 3}), order);
+}
+
+TEST_F(TaskPriorityTests, lowPriorityTaskYieldsToHigherPriority) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    const auto now = std::chrono::steady_clock::now();
+    std::atomic_bool high_done{false};
+    std::promise<void> started;
+    std::thread::id low_thread, high_thread;
+    auto low = async_with_priority(executor, ov::hint::Priority::LOW, now, [&] {
+        low_thread = std::this_thread::get_id();
+        started.set_value();
+        // the preemption point of a long task, the queued task of the higher priority runs inside of it
+        while (!high_done) {
+            executor->yield_to_higher_priority();
+        }
+        // nothing of a higher priority is left
+        ASSERT_FALSE(executor->yield_to_higher_priority());
+    });
+    started.get_future().wait();
+    auto high = async_with_priority(executor, ov::hint::Priority::HIGH, now, [&] {
+        high_thread = std::this_thread::get_id();
+        high_done = true;
+    });
+    ASSERT_EQ(std::future_status::ready, high.wait_for(std::chrono::seconds(10)));
+    low.get();
+    ASSERT_EQ(low_thread, high_thread);
+}
+
+TEST_F(TaskPriorityTests, yieldOutsideOfStreamDoesNothing) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    ASSERT_FALSE(executor->yield_to_higher_priority());
+}
+
+TEST(SharedStreamsExecutorTests, executorIsSharedUntilLastUserIsGone) {
+    const auto manager = executor_manager();
+    const IStreamsExecutor::Config config{"TestSharedCPUStreamsExecutor", 1, 1};
+    auto first = manager->get_shared_cpu_streams_executor(config);
+    auto second = manager->get_shared_cpu_streams_executor(config);
+    ASSERT_EQ(first, second);
+
+    std::weak_ptr<IStreamsExecutor> released = first;
+    first.reset();
+    ASSERT_FALSE(released.expired());
+    second.reset();
+    ASSERT_TRUE(released.expired());
+}
@@ -5,8 +5,10 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "openvino/runtime/auto/properties.hpp"
@@ -60,6 +62,42 @@ public:
     ov::threading::Task immediate_task;
 };
 
+// Load of a hardware device measured by the worker infer requests, used by SHORTEST_EXPECTED_DELAY schedule policy
+struct DeviceLoadStats {
+    // weight of the latest sample in the latency moving average
+    static constexpr double latency_ewma_alpha = 0.2;
+
+    void on_start() {
+        m_in_flight.fetch_add(1);
+    }
+    void on_complete(const Time& start_time) {
+        const double latency =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latency_ewma_ms = m_completed == 0
+                                ? latency
+                                : latency_ewma_alpha * latency + (1.0 - latency_ewma_alpha) * m_latency_ewma_ms;
+        m_completed++;
+        m_in_flight.fetch_sub(1);
+    }
+    // expected time to complete one more request on the device, 0 until the first request is completed
+    double get_expected_delay() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (m_in_flight.load() + 1) * m_latency_ewma_ms / std::max<size_t>(m_parallelism, 1);
+    }
+    ov::AnyMap get_statistics() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return {{"IN_FLIGHT", m_in_flight.load()}, {"COMPLETED", m_completed}, {"LATENCY_EWMA_MS", m_latency_ewma_ms}};
+    }
+
+    // number of worker infer requests of the device, i.e. number of requests the device runs in parallel
+    size_t                        m_parallelism = 1;
+    std::atomic<size_t>           m_in_flight = {0};
+    size_t                        m_completed = 0;
+    double                        m_latency_ewma_ms = 0.0;
+    mutable std::mutex            m_mutex;
+};
+
 struct WorkerInferRequest {
     SoAsyncInferRequest           m_inferrequest;
     ov::threading::Task           m_task;
@@ -68,6 +106,8 @@ struct WorkerInferRequest {
     std::list<Time>               m_end_times;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
+    DeviceLoadStats*              m_load_stats = nullptr;
+    Time                          m_dispatch_time;
 };
 
 struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
@@ -77,6 +117,10 @@ struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         (*m_workptrptr)->m_task = std::move(task);
         (*m_workptrptr)->m_fallback_exec = m_fallback_exec;
+        if ((*m_workptrptr)->m_load_stats) {
+            (*m_workptrptr)->m_dispatch_time = std::chrono::steady_clock::now();
+            (*m_workptrptr)->m_load_stats->on_start();
+        }
         (*m_workptrptr)->m_inferrequest->start_async();
     };
     WorkerInferRequest** m_workptrptr = nullptr;
@@ -220,6 +264,8 @@ public:
     ov::Any                                        m_schedule_policy = ov::intel_auto::SchedulePolicy::DEFAULT;
     std::mutex                                     m_mutex;
     std::mutex                                     m_fallback_mutex;
+    // filled before the workers are generated, read-only afterwards
+    DeviceMap<DeviceLoadStats>                     m_device_load_stats;
     SoCompiledModel                                m_hw_compiled_model;
     std::string                                    m_model_precision;
     // hold the resource of static variable to avoid the unexpected destruction.
@@ -4,6 +4,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "cumulative_schedule.hpp"
+
+#include <algorithm>
+
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
 #include "openvino/util/file_util.hpp"
@@ -26,6 +29,21 @@ std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInform
         m_n_ctput_schedule_next_device++;
     } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY) {
         selected_device_name = devices[current_device_index].device_name;
+    } else if (schedule_policy == ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY) {
+        // rank devices by the expected delay, ties (e.g. devices without completed requests yet) keep priority order.
+        // current_device_index selects the next candidate when the better ones have no idle infer request
+        std::vector<std::pair<double, std::size_t>> expected_delays;
+        expected_delays.reserve(devices.size());
+        for (std::size_t i = 0; i < devices.size(); i++) {
+            const auto stats = m_context->m_device_load_stats.find(devices[i].device_name);
+            const double delay =
+                stats != m_context->m_device_load_stats.end() ? stats->second.get_expected_delay() : 0.0;
+            expected_delays.emplace_back(delay, i);
+        }
+        std::stable_sort(expected_delays.begin(), expected_delays.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        selected_device_name = devices[expected_delays[current_device_index].second].device_name;
     }
     return selected_device_name;
 }
@@ -146,6 +164,7 @@ void CumuSchedule::init() {
         // initialize containers before run async task, if not initialized, it will hang during infer
         m_idle_worker_requests[device.device_name];
         m_worker_requests[device.device_name];
+        m_context->m_device_load_stats[device.device_name];
         m_infer_pipeline_tasks_device_specific[device.device_name] = nullptr;
     }
     // load devices other than CPU first
@@ -96,15 +96,26 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
     m_infer_pipeline_tasks_device_specific[device] = std::unique_ptr<TaskQueue>(new TaskQueue);
     auto* idle_workerrequests_ptr = &(idle_worker_requests);
     idle_worker_requests.set_capacity(num_requests);
+    // load is tracked only for the devices registered by the schedule
+    auto load_stats_it = m_context->m_device_load_stats.find(device);
+    DeviceLoadStats* load_stats =
+        load_stats_it != m_context->m_device_load_stats.end() ? &load_stats_it->second : nullptr;
+    if (load_stats) {
+        load_stats->m_parallelism = num_requests;
+    }
     int num = 0;
     for (auto&& worker_request : worker_requests) {
         worker_request.m_inferrequest = {compiled_model->create_infer_request(), compiled_model._so};
         auto* worker_request_ptr = &worker_request;
         worker_request_ptr->m_index = num++;
+        worker_request_ptr->m_load_stats = load_stats;
         OPENVINO_ASSERT(idle_worker_requests.try_push(std::make_pair(worker_request_ptr->m_index, worker_request_ptr)) == true);
         worker_request.m_inferrequest->set_callback(
             [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
+                if (worker_request_ptr->m_load_stats) {
+                    worker_request_ptr->m_load_stats->on_complete(worker_request_ptr->m_dispatch_time);
+                }
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
                 {
                     auto stop_retry_and_continue = [worker_request_ptr]() {
@@ -70,6 +70,31 @@ TEST_P(InferSchedulePolicyTest, can_run_sync_requests_with_different_schedule_po
     }
 }
 
+TEST_P(InferSchedulePolicyTest, can_get_device_load_statistics) {
+    ov::CompiledModel compiled_model;
+    property.emplace(ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT));
+    OV_ASSERT_NO_THROW(compiled_model = core.compile_model(model_cannot_batch, "AUTO", property));
+    std::vector<ov::InferRequest> inferReqsQueue;
+    for (int i = 0; i < niters; i++) {
+        inferReqsQueue.push_back(compiled_model.create_infer_request());
+    }
+    for (auto& req : inferReqsQueue) {
+        OV_ASSERT_NO_THROW(req.start_async());
+    }
+    for (auto& req : inferReqsQueue) {
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    ov::AnyMap statistics;
+    OV_ASSERT_NO_THROW(statistics = compiled_model.get_property(ov::intel_auto::device_load_statistics));
+    size_t completed = 0;
+    for (auto& device : statistics) {
+        auto device_statistics = device.second.as<ov::AnyMap>();
+        EXPECT_EQ(device_statistics.at("IN_FLIGHT").as<size_t>(), 0);
+        completed += device_statistics.at("COMPLETED").as<size_t>();
+    }
+    EXPECT_EQ(completed, static_cast<size_t>(niters));
+}
+
 auto properties = std::vector<ov::AnyMap>{
     {ov::device::priorities("MOCK_GPU"), ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)},
     {ov::device::priorities("MOCK_GPU"),
@@ -82,7 +107,11 @@ auto properties = std::vector<ov::AnyMap>{
     {ov::device::priorities("MOCK_GPU", "MOCK_CPU"),
      ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)},
     {ov::device::priorities("MOCK_CPU", "MOCK_GPU"),
-     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)}};
+     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)},
+    {ov::device::priorities("MOCK_GPU", "MOCK_CPU"),
+     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY)},
+    {ov::device::priorities("MOCK_CPU", "MOCK_GPU"),
+     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY)}};
 auto niters = std::vector<int>{10, 20, 30};
 
 INSTANTIATE_TEST_SUITE_P(AutoFuncTests,
@@ -131,9 +131,68 @@ const std::vector<ConfigParams> configs = {
     ConfigParams{metaDevices,
                  ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY,
                  {{"DEVICE_0", 3}, {"DEVICE_1", 2}, {"DEVICE_2", 1}},
-                 {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}}};
+                 {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}},
+    // without measured latency all devices have the same expected delay and the device priority is kept
+    ConfigParams{metaDevices,
+                 ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY,
+                 {{"DEVICE_0", 1}, {"DEVICE_1", 3}, {"DEVICE_2", 2}},
+                 {"DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_1", "DEVICE_2", "DEVICE_2"}}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests,
                          MockCumuSchedule,
                          ::testing::ValuesIn(configs),
-                         MockCumuSchedule::getTestCaseName);
\ No newline at end of file
+                         MockCumuSchedule::getTestCaseName);
+
+class MockCumuScheduleExpectedDelay : public ov::auto_plugin::CumuSchedule, public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_context = std::make_shared<ov::auto_plugin::ScheduleContext>();
+        m_context->m_schedule_policy = ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY;
+        for (const auto& device : metaDevices) {
+            m_context->m_device_load_stats[device.device_name];
+        }
+    }
+
+    void TearDown() override {
+        m_context.reset();
+    }
+
+    void complete_request(const std::string& device, std::chrono::milliseconds latency, size_t parallelism = 1) {
+        auto& stats = m_context->m_device_load_stats[device];
+        stats.m_parallelism = parallelism;
+        stats.on_start();
+        stats.on_complete(std::chrono::steady_clock::now() - latency);
+    }
+};
+
+TEST_F(MockCumuScheduleExpectedDelay, scheduleInferRequestToDeviceWithShortestExpectedDelay) {
+    complete_request("DEVICE_0", std::chrono::milliseconds(100));
+    complete_request("DEVICE_1", std::chrono::milliseconds(10));
+    complete_request("DEVICE_2", std::chrono::milliseconds(40));
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 0), "DEVICE_1");
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 1), "DEVICE_2");
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 2), "DEVICE_0");
+
+    // running requests increase the expected delay of DEVICE_1 above DEVICE_2
+    for (int i = 0; i < 4; i++) {
+        m_context->m_device_load_stats["DEVICE_1"].on_start();
+    }
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 0), "DEVICE_2");
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 1), "DEVICE_1");
+}
+
+TEST_F(MockCumuScheduleExpectedDelay, scheduleInferRequestConsidersDeviceParallelism) {
+    complete_request("DEVICE_0", std::chrono::milliseconds(80), 8);
+    complete_request("DEVICE_1", std::chrono::milliseconds(20), 1);
+    complete_request("DEVICE_2", std::chrono::milliseconds(40), 1);
+    EXPECT_EQ(schedule_to_next_device(metaDevices, 0), "DEVICE_0");
+}
+
+TEST_F(MockCumuScheduleExpectedDelay, deviceLoadStatisticsAreReported) {
+    complete_request("DEVICE_0", std::chrono::milliseconds(10));
+    m_context->m_device_load_stats["DEVICE_0"].on_start();
+    auto statistics = m_context->m_device_load_stats["DEVICE_0"].get_statistics();
+    EXPECT_EQ(statistics.at("IN_FLIGHT").as<size_t>(), 1);
+    EXPECT_EQ(statistics.at("COMPLETED").as<size_t>(), 1);
+    EXPECT_GE(statistics.at("LATENCY_EWMA_MS").as<double>(), 10.0);
+}
\ No newline at end of file
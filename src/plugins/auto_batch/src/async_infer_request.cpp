@@ -68,9 +68,14 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
+                if (workerInferRequest->_use_adaptive_timeout)
+                    workerInferRequest->_adaptive_timeout.on_request_arrived(sz == 1);
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (sz == 1 && workerInferRequest->_use_adaptive_timeout) {
+                    // restart waiting with the timeout adapted to the expected arrivals of the rest of the batch
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -86,6 +91,9 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                      this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
+                 } else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED ==
+                            this->m_sync_request->m_batched_request_status) {
+                     this->m_sync_request->copy_outputs_from_partial_batch();
                  }
              }}};
     }
@@ -112,6 +120,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -5,10 +5,51 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <cmath>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// weight of the latest sample in the moving averages
+constexpr double moving_average_weight = 0.125;
+
+double update_moving_average(double average, double sample) {
+    return average == 0 ? sample : average + moving_average_weight * (sample - average);
+}
+}  // namespace
+
+void AdaptiveTimeout::on_request_arrived(bool first_in_batch) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the interval before the first request of the batch includes the idle time, so it says nothing about the rate
+    if (!first_in_batch) {
+        const std::chrono::duration<double, std::milli> interval = now - m_last_arrival;
+        m_arrival_interval = update_moving_average(m_arrival_interval, interval.count());
+    }
+    m_last_arrival = now;
+}
+
+void AdaptiveTimeout::on_batch_executed(std::chrono::steady_clock::duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_batch_latency =
+        update_moving_average(m_batch_latency, std::chrono::duration<double, std::milli>(latency).count());
+}
+
+uint32_t AdaptiveTimeout::get(uint32_t time_out, int batch_size, int collected) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_arrival_interval == 0)
+        return time_out;
+    // expected time to collect the rest of the batch, doubled to tolerate the jitter of arrivals
+    double expected = 2 * m_arrival_interval * (batch_size - collected);
+    // waiting for longer than the batched execution takes doesn't pay off:
+    // it is faster to execute the collected requests right away and to batch the next ones meanwhile
+    if (m_batch_latency > 0)
+        expected = std::min(expected, m_batch_latency);
+    return static_cast<uint32_t>(std::min<double>(time_out, std::max(1.0, std::ceil(expected))));
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +58,23 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_partial_batch(compiled_models_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto adaptive_time_out = config.find(ov::autobatch_plugin::adaptive_timeout.name());
+    if (adaptive_time_out != config.end())
+        m_adaptive_timeout = adaptive_time_out->second.as<bool>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,10 +111,17 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_use_adaptive_timeout = m_adaptive_timeout;
+        for (const auto& partial : m_compiled_models_partial_batch) {
+            ov::SoPtr<ov::IAsyncInferRequest> request = {partial.second->create_infer_request(), partial.second._so};
+            workerRequestPtr->_partial_batch_requests[static_cast<int>(partial.first)] = request;
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->_adaptive_timeout.on_batch_executed(std::chrono::steady_clock::now() -
+                                                                      workerRequestPtr->_start_time);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +137,13 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    std::uint32_t time_out = m_time_out;
+                    // the queue can only grow in parallel, so the size is a lower bound of the collected requests
+                    const int collected = static_cast<int>(workerRequestPtr->_tasks.size());
+                    if (workerRequestPtr->_use_adaptive_timeout && collected)
+                        time_out =
+                            workerRequestPtr->_adaptive_timeout.get(time_out, workerRequestPtr->_batch_size, collected);
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(time_out));
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -104,7 +163,37 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_start_time = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
+                    } else if ((status == std::cv_status::timeout) && sz > 1 &&
+                               workerRequestPtr->_partial_batch_requests.lower_bound(sz) !=
+                                   workerRequestPtr->_partial_batch_requests.end()) {
+                        // timeout to collect the batch is over, execute the requests with the smallest batch that
+                        // fits all of them (the rest of the slots hold stale data, and the results are ignored)
+                        auto partial = workerRequestPtr->_partial_batch_requests.lower_bound(sz);
+                        auto& partial_request = partial->second;
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(
+                            sz);
+                        for (int n = 0; n < sz; n++) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
+                            tasks[n].first->m_sync_request->copy_inputs_to_partial_batch(partial_request,
+                                                                                         n,
+                                                                                         partial->first);
+                            tasks[n].first->m_sync_request->m_batched_request_status =
+                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                        }
+                        std::promise<void> all_completed;
+                        auto all_completed_future = all_completed.get_future();
+                        partial_request->set_callback([&tasks, &all_completed](std::exception_ptr p) {
+                            for (auto& t : tasks) {
+                                if (p)
+                                    t.first->m_sync_request->m_exception_ptr = p;
+                                t.second();
+                            }
+                            all_completed.set_value();
+                        });
+                        partial_request->start_async();
+                        all_completed_future.get();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -212,7 +301,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::autobatch_plugin::batch_ladder.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::autobatch_plugin::adaptive_timeout.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
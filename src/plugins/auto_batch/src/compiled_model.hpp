@@ -5,19 +5,41 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
+#include <mutex>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
 #include "plugin.hpp"
+#include "properties.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
 
 class AsyncInferRequest;
 
+// Tracks the requests arrival rate and the batched execution latency (exponential moving averages) to estimate
+// for how long it is worth waiting for the rest of the batch
+class AdaptiveTimeout {
+public:
+    void on_request_arrived(bool first_in_batch);
+
+    void on_batch_executed(std::chrono::steady_clock::duration latency);
+
+    // returns the timeout (in ms) to collect the batch of the given size, never exceeds the user-defined time_out
+    uint32_t get(uint32_t time_out, int batch_size, int collected) const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_last_arrival;
+    double m_arrival_interval = 0;  // in ms
+    double m_batch_latency = 0;     // in ms
+};
+
 class CompiledModel : public ov::ICompiledModel {
 public:
     struct WorkerInferRequest {
@@ -31,6 +53,11 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // requests of the smaller batch sizes (batch ladder) to execute partially collected batches, by batch size
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _partial_batch_requests;
+        std::chrono::steady_clock::time_point _start_time;
+        AdaptiveTimeout _adaptive_timeout;
+        bool _use_adaptive_timeout = false;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +68,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -73,12 +101,15 @@ protected:
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    bool m_adaptive_timeout = false;
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    // models compiled for the batch sizes below the device batch size, by batch size
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_partial_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "properties.hpp"
 #include "transformations/common_optimizations/dimension_tracking.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/utils/utils.hpp"
@@ -22,7 +23,9 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
-    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
+    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::autobatch_plugin::batch_ladder.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::autobatch_plugin::adaptive_timeout.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
     for (auto&& kvp : user_config) {
@@ -119,6 +122,8 @@ Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
     m_plugin_config.insert(ov::enable_profiling(false));
+    m_plugin_config.insert(ov::autobatch_plugin::batch_ladder(false));
+    m_plugin_config.insert(ov::autobatch_plugin::adaptive_timeout(false));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -268,28 +273,44 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_model_with_batch = [&](uint32_t batch_size) -> ov::SoPtr<ov::ICompiledModel> {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_model_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    // the batch ladder: power-of-two batches below the device batch size to execute partially collected batches
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_partial_batch;
+    const auto batch_ladder = full_properties.find(ov::autobatch_plugin::batch_ladder.name());
+    if (compiled_model_with_batch && batch_ladder != full_properties.end() && batch_ladder->second.as<bool>()) {
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                compiled_models_partial_batch[batch_size] = compile_model_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // the collected requests which don't fit the smaller batches are executed with the larger ones
+            }
+        }
+        // the full batch closes the ladder, the requests beyond the last smaller batch are executed with it
+        compiled_models_partial_batch[meta_device.device_batch_size] = compiled_model_with_batch;
+    }
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -311,7 +332,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
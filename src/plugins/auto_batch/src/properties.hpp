@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Compiles additional models for the power-of-two batch sizes below the device batch size, so requests
+ * collected by the moment of the timeout are executed as a single partial batch rather than one by one
+ */
+static constexpr Property<bool, PropertyMutability::RW> batch_ladder{"AUTO_BATCH_LADDER"};
+
+/**
+ * @brief Shortens the batch collection timeout based on the observed requests arrival rate and the latency of the
+ * batched execution. The value of ov::auto_batch_timeout is used as the upper bound
+ */
+static constexpr Property<bool, PropertyMutability::RW> adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
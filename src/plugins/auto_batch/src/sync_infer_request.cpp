@@ -112,21 +112,53 @@ void SyncInferRequest::copy_inputs_if_needed() {
     }
 }
 
+void SyncInferRequest::copy_inputs_to_partial_batch(const ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                    size_t batch_id,
+                                                    size_t batch_num) {
+    m_partial_batch_request = req;
+    m_partial_batch_id = batch_id;
+    m_partial_batch_size = batch_num;
+    for (const auto& it : get_inputs()) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto dst_tensor = req->get_tensor(it);
+        copy_tensor_if_needed(get_tensor(it), dst_tensor, true, batch_id, batch_num);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_partial_batch() {
+    for (const auto& it : get_outputs()) {
+        auto dst_tensor = get_tensor(it);
+        copy_tensor_if_needed(m_partial_batch_request->get_tensor(it),
+                              dst_tensor,
+                              false,
+                              m_partial_batch_id,
+                              m_partial_batch_size);
+    }
+}
+
 void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
                                              ov::SoPtr<ov::ITensor>& dst,
                                              const bool bInput) {
+    copy_tensor_if_needed(src, dst, bInput, m_batch_id, m_batch_size);
+}
+
+void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                             ov::SoPtr<ov::ITensor>& dst,
+                                             const bool bInput,
+                                             size_t batch_id,
+                                             size_t batch_num) {
     auto ptrDst = static_cast<char*>(dst->data());
     auto ptrSrc = static_cast<char*>(src->data());
     ptrdiff_t szDst = dst->get_byte_size();
     ptrdiff_t szSrc = src->get_byte_size();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_num : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_num : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
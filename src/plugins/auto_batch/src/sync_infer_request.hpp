@@ -27,6 +27,11 @@ public:
 
     void copy_outputs_if_needed();
 
+    // Batch-Device impl specific: copies the data to/from the given slot of the partial batch request
+    void copy_inputs_to_partial_batch(const ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_num);
+
+    void copy_outputs_from_partial_batch();
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,14 +45,26 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // the request of the batch ladder (and the slot in it) the last partial batch was executed with
+    ov::SoPtr<ov::IAsyncInferRequest> m_partial_batch_request;
+    size_t m_partial_batch_id = 0;
+    size_t m_partial_batch_size = 0;
+
     size_t get_batch_size() const;
 
 protected:
     void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
 
+    static void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                      ov::SoPtr<ov::ITensor>& dst,
+                                      const bool bInput,
+                                      size_t batch_id,
+                                      size_t batch_num);
+
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
 
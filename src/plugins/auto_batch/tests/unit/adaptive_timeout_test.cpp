@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+
+#include "mock_common.hpp"
+
+TEST(AutoBatchAdaptiveTimeoutTest, UserTimeoutWithoutStatistics) {
+    AdaptiveTimeout adaptive_timeout;
+    EXPECT_EQ(adaptive_timeout.get(200, 8, 1), 200u);
+
+    // the interval before the first request of the batch is not taken into account
+    adaptive_timeout.on_request_arrived(true);
+    EXPECT_EQ(adaptive_timeout.get(200, 8, 1), 200u);
+}
+
+TEST(AutoBatchAdaptiveTimeoutTest, TimeoutIsBoundedByBatchLatency) {
+    AdaptiveTimeout adaptive_timeout;
+    adaptive_timeout.on_request_arrived(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    adaptive_timeout.on_request_arrived(false);
+    adaptive_timeout.on_batch_executed(std::chrono::milliseconds(5));
+
+    const auto time_out = adaptive_timeout.get(1000, 64, 2);
+    EXPECT_GE(time_out, 1u);
+    EXPECT_LE(time_out, 5u);
+}
+
+TEST(AutoBatchAdaptiveTimeoutTest, TimeoutNeverExceedsUserTimeout) {
+    AdaptiveTimeout adaptive_timeout;
+    adaptive_timeout.on_request_arrived(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    adaptive_timeout.on_request_arrived(false);
+
+    EXPECT_EQ(adaptive_timeout.get(1, 64, 2), 1u);
+    EXPECT_LE(adaptive_timeout.get(1000, 64, 2), 1000u);
+}
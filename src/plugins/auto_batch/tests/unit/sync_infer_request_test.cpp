@@ -203,6 +203,26 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyPartialBatchTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  m_batch_size - 1,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    ov::SoPtr<ov::IAsyncInferRequest> partial_request = {m_async_infer_request_with_batch, {}};
+    EXPECT_NO_THROW(req->copy_inputs_to_partial_batch(partial_request, 0, m_batch_size));
+    EXPECT_EQ(req->m_partial_batch_id, 0u);
+    EXPECT_EQ(req->m_partial_batch_size, m_batch_size);
+    EXPECT_NO_THROW(req->copy_outputs_from_partial_batch());
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
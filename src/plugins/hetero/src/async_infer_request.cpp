@@ -4,6 +4,10 @@
 
 #include "async_infer_request.hpp"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+
 struct RequestExecutor : ov::threading::ITaskExecutor {
     explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
@@ -21,12 +25,112 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+// Runs the subrequests of all micro-batches as a wavefront: a submodel of a micro-batch starts once the previous
+// submodel of the same micro-batch and the same submodel of the previous micro-batch are completed
+struct MicroBatchExecutor : ov::threading::ITaskExecutor {
+    using Requests = std::vector<std::vector<ov::SoPtr<ov::IAsyncInferRequest>>>;
+
+    MicroBatchExecutor(Requests& requests, std::function<void()> prepare)
+        : m_requests(requests),
+          m_prepare(std::move(prepare)),
+          m_num_micro_batches(requests.size()),
+          m_num_stages(requests.front().size()),
+          m_pending(new std::atomic<int>[m_num_micro_batches * m_num_stages]) {
+        for (size_t i = 0; i < m_num_micro_batches; i++) {
+            for (size_t k = 0; k < m_num_stages; k++) {
+                m_requests[i][k]->set_callback([this, i, k](std::exception_ptr exception_ptr) {
+                    if (exception_ptr)
+                        set_exception(exception_ptr);
+                    on_completed(i, k);
+                });
+            }
+        }
+    }
+
+    void run(ov::threading::Task task) override {
+        m_task = std::move(task);
+        m_exception_ptr = nullptr;
+        m_failed = false;
+        m_remaining = static_cast<int>(m_num_micro_batches * m_num_stages);
+        for (size_t i = 0; i < m_num_micro_batches; i++) {
+            for (size_t k = 0; k < m_num_stages; k++) {
+                m_pending[i * m_num_stages + k] = (i > 0) + (k > 0);
+            }
+        }
+        try {
+            m_prepare();
+        } catch (...) {
+            m_exception_ptr = std::current_exception();
+            auto task = std::move(m_task);
+            task();
+            return;
+        }
+        start(0, 0);
+    }
+
+    void start(size_t i, size_t k) {
+        // after a failure the rest of the subrequests are skipped
+        if (m_failed) {
+            on_completed(i, k);
+            return;
+        }
+        try {
+            m_requests[i][k]->start_async();
+        } catch (...) {
+            set_exception(std::current_exception());
+            on_completed(i, k);
+        }
+    }
+
+    void on_completed(size_t i, size_t k) {
+        if (k + 1 < m_num_stages && --m_pending[i * m_num_stages + k + 1] == 0)
+            start(i, k + 1);
+        if (i + 1 < m_num_micro_batches && --m_pending[(i + 1) * m_num_stages + k] == 0)
+            start(i + 1, k);
+        if (--m_remaining == 0) {
+            auto task = std::move(m_task);
+            task();
+        }
+    }
+
+    void set_exception(std::exception_ptr exception_ptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_exception_ptr)
+            m_exception_ptr = std::move(exception_ptr);
+        m_failed = true;
+    }
+
+    Requests& m_requests;
+    std::function<void()> m_prepare;
+    const size_t m_num_micro_batches;
+    const size_t m_num_stages;
+    std::unique_ptr<std::atomic<int>[]> m_pending;
+    std::atomic<int> m_remaining = {0};
+    std::atomic_bool m_failed = {false};
+    std::mutex m_mutex;
+    std::exception_ptr m_exception_ptr;
+    ov::threading::Task m_task;
+};
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
+    if (m_infer_request->m_num_micro_batches > 1) {
+        auto infer_request = m_infer_request;
+        auto micro_batch_executor =
+            std::make_shared<MicroBatchExecutor>(m_infer_request->m_micro_batch_subrequests, [infer_request] {
+                infer_request->bind_micro_batch_tensors();
+            });
+        m_pipeline.emplace_back(micro_batch_executor, [micro_batch_executor] {
+            if (nullptr != micro_batch_executor->m_exception_ptr) {
+                std::rethrow_exception(micro_batch_executor->m_exception_ptr);
+            }
+        });
+        return;
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
@@ -43,7 +147,9 @@ ov::hetero::AsyncInferRequest::~AsyncInferRequest() {
 
 void ov::hetero::AsyncInferRequest::cancel() {
     ov::IAsyncInferRequest::cancel();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        request->cancel();
+    for (auto&& subrequests : m_infer_request->m_micro_batch_subrequests) {
+        for (auto&& request : subrequests) {
+            request->cancel();
+        }
     }
 }
\ No newline at end of file
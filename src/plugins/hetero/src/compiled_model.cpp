@@ -10,6 +10,8 @@
 #include "graph_debug_dump.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
@@ -18,6 +20,28 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "properties.hpp"
+#include "transformations/common_optimizations/dimension_tracking.hpp"
+
+namespace {
+// Creates the node of the input or output which holds all micro-batches of the submodel port
+std::shared_ptr<ov::Node> make_batch_node(const ov::Output<const ov::Node>& port,
+                                          size_t num_micro_batches,
+                                          bool is_input) {
+    auto shape = port.get_partial_shape();
+    shape[0] = shape[0].get_length() * static_cast<int64_t>(num_micro_batches);
+    auto param = std::make_shared<ov::op::v0::Parameter>(port.get_element_type(), shape);
+    param->output(0).get_tensor().set_names(port.get_names());
+    if (is_input) {
+        param->set_friendly_name(port.get_node()->get_friendly_name());
+        return param;
+    }
+    const auto& producer = port.get_node()->input_value(0);
+    param->set_friendly_name(producer.get_node()->get_friendly_name());
+    auto result = std::make_shared<ov::op::v0::Result>(param);
+    result->set_friendly_name(port.get_node()->get_friendly_name());
+    return result;
+}
+}  // namespace
 
 ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                          const std::vector<ov::hetero::SubmodelInfo>& submodels,
@@ -39,8 +63,79 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
     }
 }
 
+bool ov::hetero::CompiledModel::reshape_to_micro_batches(const std::vector<ov::hetero::SubmodelInfo>& submodels) const {
+    const int64_t num_micro_batches = m_cfg.num_micro_batches;
+    // the batch must be the outermost dimension of all inputs and outputs, which is proven by tracking the batch
+    // through every operation of the submodels, a dimension whose value only happens to match is not enough
+    int64_t batch = -1;
+    auto is_batched = [&](const ov::PartialShape& shape) {
+        if (shape.is_dynamic() || shape.size() == 0 || !shape[0].has_symbol())
+            return false;
+        for (size_t i = 1; i < shape.size(); i++) {
+            if (shape[i].has_symbol())
+                return false;
+        }
+        if (batch == -1)
+            batch = shape[0].get_length();
+        return shape[0].get_length() == batch;
+    };
+    for (const auto& [device, sub_model] : submodels) {
+        // states are shared between the batch items
+        if (!sub_model->get_variables().empty())
+            return false;
+        // the batch dimension keeps its symbol only if it is propagated through all the nodes
+        auto cloned_model = sub_model->clone();
+        ov::pass::Manager manager("Plugin:Hetero:FindBatch");
+        manager.register_pass<ov::pass::FindBatch>(false, true);
+        manager.run_passes(cloned_model);
+        for (const auto& input : cloned_model->inputs()) {
+            if (!is_batched(input.get_partial_shape()))
+                return false;
+        }
+        for (const auto& output : cloned_model->outputs()) {
+            if (!is_batched(output.get_partial_shape()))
+                return false;
+        }
+    }
+    if (batch <= num_micro_batches || batch % num_micro_batches != 0)
+        return false;
+
+    const auto micro_batch = batch / num_micro_batches;
+    auto reshape = [](const std::shared_ptr<ov::Model>& model, int64_t batch) {
+        std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+        for (const auto& input : model->inputs()) {
+            auto shape = input.get_partial_shape();
+            shape[0] = batch;
+            new_shapes.emplace(input, shape);
+        }
+        model->reshape(new_shapes);
+    };
+    size_t reshaped = 0;
+    try {
+        for (; reshaped < submodels.size(); reshaped++) {
+            const auto& sub_model = submodels[reshaped].second;
+            reshape(sub_model, micro_batch);
+            for (const auto& output : sub_model->outputs()) {
+                OPENVINO_ASSERT(output.get_partial_shape()[0] == micro_batch, "Output is not batched by 0th dimension");
+            }
+        }
+    } catch (const ov::Exception&) {
+        // restore the original batch, including the submodel which failed
+        for (size_t i = 0; i <= reshaped && i < submodels.size(); i++) {
+            reshape(submodels[i].second, batch);
+        }
+        return false;
+    }
+    return true;
+}
+
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    if (m_cfg.num_micro_batches > 1 && (submodels.size() < 2 || !reshape_to_micro_batches(submodels))) {
+        // there is nothing to overlap or the model can't be split into micro-batches
+        m_cfg.num_micro_batches = 1;
+    }
+    // micro-batches of different submodels run in parallel, so the submodels must not share the executor
+    const bool add_exclusive = submodels.size() > 1 && m_cfg.num_micro_batches == 1;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -236,6 +331,7 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::num_micro_batches.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -301,7 +397,14 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                         "Submodel " + std::to_string(submodel_idx) + " has " +
                             std::to_string(compiled_submodel->inputs().size()) +
                             " inputs. Index is out of range: " + std::to_string(input_idx));
-        m_compiled_inputs.emplace_back(compiled_submodel->inputs()[input_idx]);
+        if (m_cfg.num_micro_batches > 1) {
+            m_batch_nodes.push_back(make_batch_node(compiled_submodel->inputs()[input_idx],
+                                                    m_cfg.num_micro_batches,
+                                                    true));
+            m_compiled_inputs.emplace_back(m_batch_nodes.back()->output(0));
+        } else {
+            m_compiled_inputs.emplace_back(compiled_submodel->inputs()[input_idx]);
+        }
     }
     m_compiled_outputs.reserve(m_mapping_info._outputs_to_submodels_outputs.size());
     for (const auto& it : m_mapping_info._outputs_to_submodels_outputs) {
@@ -315,7 +418,14 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                         "Submodel " + std::to_string(submodel_idx) + " has " +
                             std::to_string(compiled_submodel->outputs().size()) +
                             " outputs. Index is out of range: " + std::to_string(output_idx));
-        m_compiled_outputs.emplace_back(compiled_submodel->outputs()[output_idx]);
+        if (m_cfg.num_micro_batches > 1) {
+            m_batch_nodes.push_back(make_batch_node(compiled_submodel->outputs()[output_idx],
+                                                    m_cfg.num_micro_batches,
+                                                    false));
+            m_compiled_outputs.emplace_back(m_batch_nodes.back()->output(0));
+        } else {
+            m_compiled_outputs.emplace_back(compiled_submodel->outputs()[output_idx]);
+        }
     }
 }
 
@@ -56,11 +56,15 @@ private:
 
     void set_inputs_and_outputs();
 
+    bool reshape_to_micro_batches(const std::vector<ov::hetero::SubmodelInfo>& submodels) const;
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
     std::vector<ov::Output<const ov::Node>> m_compiled_inputs;
     std::vector<ov::Output<const ov::Node>> m_compiled_outputs;
+    // nodes of the inputs/outputs with the whole batch when the submodels are compiled for micro-batches
+    std::vector<std::shared_ptr<ov::Node>> m_batch_nodes;
     SubgraphsMappingInfo m_mapping_info;
 
     struct CompiledModelDesc {
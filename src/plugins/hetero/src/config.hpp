@@ -38,6 +38,8 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t num_micro_batches = 1;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
@@ -17,5 +17,11 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of micro-batches the batch is split into to overlap execution of submodels of a single request.
+ * The batch is the outermost dimension of all inputs and outputs of the model. Value 1 disables the pipelining
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> num_micro_batches{"HETERO_NUM_MICRO_BATCHES"};
 }  // namespace hetero
 }  // namespace ov
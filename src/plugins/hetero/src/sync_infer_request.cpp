@@ -17,12 +17,75 @@
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
 
+namespace {
+// The tensor can be bound to the port as is: it is a host tensor of the port type and shape
+bool is_shareable(const ov::SoPtr<ov::ITensor>& tensor, const ov::Output<const ov::Node>& port) {
+    // remote tensors belong to the device of their subrequest and can't be used by the other one in general
+    return tensor && !std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) && tensor->is_continuous() &&
+           tensor->get_element_type() == port.get_element_type() && port.get_partial_shape().is_static() &&
+           tensor->get_shape() == port.get_shape();
+}
+}  // namespace
+
+ov::SoPtr<ov::ITensor> ov::hetero::bind_handoff_tensor(const ov::SoPtr<ov::IAsyncInferRequest>& producer,
+                                                       const ov::Output<const ov::Node>& output_port,
+                                                       const ov::SoPtr<ov::IAsyncInferRequest>& consumer,
+                                                       const ov::Output<const ov::Node>& input_port) {
+    auto output_tensor = producer->get_tensor(output_port);
+    if (!output_tensor._so) {
+        output_tensor._so = producer._so;
+    }
+    if (is_shareable(output_tensor, input_port)) {
+        consumer->set_tensor(input_port, output_tensor);
+        return output_tensor;
+    }
+    auto input_tensor = consumer->get_tensor(input_port);
+    if (!input_tensor._so) {
+        input_tensor._so = consumer._so;
+    }
+    if (is_shareable(input_tensor, output_port)) {
+        producer->set_tensor(output_port, input_tensor);
+        return input_tensor;
+    }
+    ov::SoPtr<ov::ITensor> tensor = {ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                                     nullptr};
+    producer->set_tensor(output_port, tensor);
+    consumer->set_tensor(input_port, tensor);
+    return tensor;
+}
+
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
-    : ov::ISyncInferRequest(compiled_model) {
-    for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
-        auto& comp_model = comp_model_desc.compiled_model;
-        m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+    : ov::ISyncInferRequest(compiled_model),
+      m_num_micro_batches(compiled_model->m_cfg.num_micro_batches) {
+    // every micro-batch has its own chain of subrequests connected by the handoff tensors
+    m_micro_batch_subrequests.resize(m_num_micro_batches);
+    for (auto& subrequests : m_micro_batch_subrequests) {
+        for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+            auto& comp_model = comp_model_desc.compiled_model;
+            subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+        }
+
+        std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> handoff_tensors;
+        for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
+            const auto& submodel_idx_in = kvp.first.first;
+            const auto& port_idx_in = kvp.first.second;
+            const auto& submodel_idx_out = kvp.second.first;
+            const auto& port_idx_out = kvp.second.second;
+
+            const auto& output_port = subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
+            const auto& input_port = subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
+            auto handoff = handoff_tensors.find(output_port);
+            if (handoff == handoff_tensors.end()) {
+                handoff_tensors[output_port] = bind_handoff_tensor(subrequests[submodel_idx_out],
+                                                                   output_port,
+                                                                   subrequests[submodel_idx_in],
+                                                                   input_port);
+            } else {
+                subrequests[submodel_idx_in]->set_tensor(input_port, handoff->second);
+            }
+        }
     }
+    m_subrequests = m_micro_batch_subrequests.front();
 
     for (size_t i = 0; i < compiled_model->inputs().size(); i++) {
         const auto& port = compiled_model->inputs()[i];
@@ -35,23 +98,20 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
-    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
-    for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
-        const auto& submodel_idx_in = kvp.first.first;
-        const auto& port_idx_in = kvp.first.second;
-        const auto& submodel_idx_out = kvp.second.first;
-        const auto& port_idx_out = kvp.second.second;
-
-        const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
-        if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+    if (m_num_micro_batches > 1) {
+        // tensors of the whole batch, the subrequests are given views of their micro-batches before inference
+        auto allocate = [this](const ov::Output<const ov::Node>& port) {
+            allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+                tensor = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+            });
+        };
+        for (const auto& input : get_inputs()) {
+            allocate(input);
         }
-        m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
-        m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
+        for (const auto& output : get_outputs()) {
+            allocate(output);
+        }
+        m_bound_tensors.resize(get_inputs().size() + get_outputs().size());
     }
 }
 
@@ -70,6 +130,9 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
 }
 
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (m_num_micro_batches > 1) {
+        return ov::ISyncInferRequest::get_tensor(port);
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -80,6 +143,12 @@ ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<con
 
 void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
                                           const ov::SoPtr<ov::ITensor>& tensor) {
+    if (m_num_micro_batches > 1) {
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "Remote tensors are not supported when the batch is split into micro-batches");
+        ov::ISyncInferRequest::set_tensor(port, tensor);
+        return;
+    }
     if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
         auto device_name = get_request(port)->get_compiled_model()->get_context()->get_device_name();
         get_request(port)->set_tensor(port, remote->get_tensor_by_name(device_name));
@@ -90,6 +159,9 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (m_num_micro_batches > 1) {
+        return ov::ISyncInferRequest::get_tensors(port);
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -102,10 +174,17 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    if (m_num_micro_batches > 1) {
+        return ov::ISyncInferRequest::set_tensors(port, tensors);
+    }
     return get_request(port)->set_tensors(port, tensors);
 }
 
 void ov::hetero::InferRequest::check_tensors() const {
+    if (m_num_micro_batches > 1) {
+        ov::ISyncInferRequest::check_tensors();
+        return;
+    }
     // Ignore `check_tensor` of inputs and outputs of Hetero Compiled Model because
     // `m_tensors` are not allocated
     return;
@@ -124,10 +203,54 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
     return variable_states;
 }
 
+void ov::hetero::InferRequest::bind_micro_batch_tensors() {
+    convert_batched_tensors();
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    const auto& mapping_info = compiled_model->m_mapping_info;
+    size_t bound_idx = 0;
+    auto bind = [&](const ov::Output<const ov::Node>& port,
+                    const ov::hetero::NodeInfo& submodel_port,
+                    bool is_input) {
+        const auto tensor = ov::ISyncInferRequest::get_tensor(port);
+        // the views are created again only when the tensor is replaced
+        auto& bound_tensor = m_bound_tensors[bound_idx++];
+        if (bound_tensor._ptr == tensor._ptr)
+            return;
+        OPENVINO_ASSERT(tensor->is_continuous(),
+                        "Tensor of the port ",
+                        port,
+                        " must be continuous to be split into micro-batches");
+        const auto& [submodel_idx, port_idx] = submodel_port;
+        const auto byte_size = tensor->get_byte_size() / m_num_micro_batches;
+        auto shape = tensor->get_shape();
+        shape[0] /= m_num_micro_batches;
+        for (size_t i = 0; i < m_num_micro_batches; i++) {
+            auto& request = m_micro_batch_subrequests[i][submodel_idx];
+            const auto& request_model = request->get_compiled_model();
+            const auto& request_port =
+                is_input ? request_model->inputs()[port_idx] : request_model->outputs()[port_idx];
+            auto data = static_cast<uint8_t*>(tensor->data()) + i * byte_size;
+            request->set_tensor(request_port, {ov::make_tensor(tensor->get_element_type(), shape, data), tensor._so});
+        }
+        bound_tensor = tensor;
+    };
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        bind(get_inputs()[i], mapping_info._inputs_to_submodels_inputs[i], true);
+    }
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        bind(get_outputs()[i], mapping_info._outputs_to_submodels_outputs[i], false);
+    }
+}
+
 void ov::hetero::InferRequest::infer() {
-    for (auto&& request : m_subrequests) {
-        OPENVINO_ASSERT(request);
-        request->infer();
+    if (m_num_micro_batches > 1) {
+        bind_micro_batch_tensors();
+    }
+    for (auto&& subrequests : m_micro_batch_subrequests) {
+        for (auto&& request : subrequests) {
+            OPENVINO_ASSERT(request);
+            request->infer();
+        }
     }
 }
 
@@ -50,9 +50,26 @@ private:
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    // Sets views of the micro-batches of the input/output tensors to the subrequests
+    void bind_micro_batch_tensors();
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // subrequests of every micro-batch, the first one is m_subrequests
+    std::vector<std::vector<ov::SoPtr<ov::IAsyncInferRequest>>> m_micro_batch_subrequests;
+    size_t m_num_micro_batches = 1;
+    std::vector<ov::SoPtr<ov::ITensor>> m_bound_tensors;
 };
 
+// Binds a single tensor as the output of the producer subrequest and the input of the consumer one, so the producer
+// writes the data straight to the memory the consumer reads. The output tensor of the producer is used when the
+// consumer can read it, then the input tensor of the consumer, and a new host tensor otherwise. Returns the bound
+// tensor
+ov::SoPtr<ov::ITensor> bind_handoff_tensor(const ov::SoPtr<ov::IAsyncInferRequest>& producer,
+                                           const ov::Output<const ov::Node>& output_port,
+                                           const ov::SoPtr<ov::IAsyncInferRequest>& consumer,
+                                           const ov::Output<const ov::Node>& input_port);
+
 }  // namespace hetero
 }  // namespace ov
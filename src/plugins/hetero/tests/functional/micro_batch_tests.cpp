@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "properties.hpp"
+
+namespace ov {
+namespace hetero {
+namespace tests {
+
+TEST_F(HeteroTests, infer_with_micro_batches) {
+    auto model = create_model_with_subtract();
+    model->reshape(ov::PartialShape{4, 3, 2, 2});
+    const ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::num_micro_batches(2)};
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(2, compiled_model.get_property(ov::hetero::num_micro_batches));
+    EXPECT_EQ(model->input().get_shape(), compiled_model.input().get_shape());
+    EXPECT_EQ(model->output().get_shape(), compiled_model.output().get_shape());
+
+    auto infer_request = compiled_model.create_infer_request();
+    for (size_t i = 0; i < 2; i++) {
+        // the second iteration checks that the micro-batches follow the replaced tensors
+        auto input_tensor =
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+        infer_request.set_input_tensor(input_tensor);
+        infer_request.start_async();
+        infer_request.wait();
+        auto output_tensor = infer_request.get_output_tensor();
+        EXPECT_EQ(input_tensor.get_shape(), output_tensor.get_shape());
+        EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+    }
+}
+
+TEST_F(HeteroTests, micro_batches_fallback_for_not_divisible_batch) {
+    auto model = create_model_with_subtract();
+    model->reshape(ov::PartialShape{3, 3, 2, 2});
+    const ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::num_micro_batches(2)};
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(1, compiled_model.get_property(ov::hetero::num_micro_batches));
+    EXPECT_EQ(model->input().get_shape(), compiled_model.input().get_shape());
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    auto output_tensor = infer_request.get_output_tensor();
+    EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+}
+
+TEST_F(HeteroTests, micro_batches_fallback_for_not_batched_outermost_dimension) {
+    // the outermost dimension indexes the constant values, so it is not the batch although all the shapes start
+    // with the same value
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{4, 3, 2, 2});
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{4, 1, 1, 1}, {1, 2, 3, 4});
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset11::Result>(subtract)},
+                                             ov::ParameterVector{param});
+    const ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::num_micro_batches(2)};
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_EQ(1, compiled_model.get_property(ov::hetero::num_micro_batches));
+
+    auto infer_request = compiled_model.create_infer_request();
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    auto output_tensor = infer_request.get_output_tensor();
+    EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+}
+
+}  // namespace tests
+}  // namespace hetero
+}  // namespace ov
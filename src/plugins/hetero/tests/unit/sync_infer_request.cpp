@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sync_infer_request.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp"
+
+using namespace ::testing;
+
+namespace {
+class HandoffTensorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // the output of the producer submodel and the input of the consumer one
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 2, 2});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        m_output_port = result->output(0);
+        m_input_port = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 2, 2})->output(0);
+
+        m_producer = std::make_shared<ov::MockIAsyncInferRequest>();
+        m_consumer = std::make_shared<ov::MockIAsyncInferRequest>();
+    }
+
+    ov::SoPtr<ov::ITensor> bind() {
+        return ov::hetero::bind_handoff_tensor({m_producer, nullptr},
+                                               m_output_port,
+                                               {m_consumer, nullptr},
+                                               m_input_port);
+    }
+
+    static ov::SoPtr<ov::ITensor> make_tensor(const ov::element::Type& type, const ov::Shape& shape) {
+        return {ov::make_tensor(type, shape), nullptr};
+    }
+
+    ov::Output<const ov::Node> m_output_port;
+    ov::Output<const ov::Node> m_input_port;
+    std::shared_ptr<ov::MockIAsyncInferRequest> m_producer;
+    std::shared_ptr<ov::MockIAsyncInferRequest> m_consumer;
+};
+}  // namespace
+
+TEST_F(HandoffTensorTest, ConsumerReadsOutputTensorOfProducer) {
+    const auto output_tensor = make_tensor(ov::element::f32, {1, 3, 2, 2});
+    ov::SoPtr<ov::ITensor> input_tensor;
+    EXPECT_CALL(*m_producer, get_tensor(_)).WillRepeatedly(Return(output_tensor));
+    EXPECT_CALL(*m_producer, set_tensor(_, _)).Times(0);
+    EXPECT_CALL(*m_consumer, get_tensor(_)).Times(0);
+    EXPECT_CALL(*m_consumer, set_tensor(_, _)).WillOnce(SaveArg<1>(&input_tensor));
+
+    const auto tensor = bind();
+    EXPECT_EQ(tensor._ptr, output_tensor._ptr);
+    EXPECT_EQ(input_tensor._ptr, output_tensor._ptr);
+    EXPECT_EQ(input_tensor->data(), output_tensor->data());
+}
+
+TEST_F(HandoffTensorTest, ProducerWritesInputTensorOfConsumer) {
+    // the producer tensor is not allocated for the static shape yet
+    const auto output_tensor = make_tensor(ov::element::f32, {0});
+    const auto input_tensor = make_tensor(ov::element::f32, {1, 3, 2, 2});
+    ov::SoPtr<ov::ITensor> bound_output_tensor;
+    EXPECT_CALL(*m_producer, get_tensor(_)).WillRepeatedly(Return(output_tensor));
+    EXPECT_CALL(*m_producer, set_tensor(_, _)).WillOnce(SaveArg<1>(&bound_output_tensor));
+    EXPECT_CALL(*m_consumer, get_tensor(_)).WillRepeatedly(Return(input_tensor));
+    EXPECT_CALL(*m_consumer, set_tensor(_, _)).Times(0);
+
+    const auto tensor = bind();
+    EXPECT_EQ(tensor._ptr, input_tensor._ptr);
+    EXPECT_EQ(bound_output_tensor._ptr, input_tensor._ptr);
+}
+
+TEST_F(HandoffTensorTest, NewTensorIsBoundToBoth) {
+    // neither tensor matches the type of the ports
+    const auto output_tensor = make_tensor(ov::element::f16, {1, 3, 2, 2});
+    const auto input_tensor = make_tensor(ov::element::f16, {1, 3, 2, 2});
+    ov::SoPtr<ov::ITensor> bound_output_tensor;
+    ov::SoPtr<ov::ITensor> bound_input_tensor;
+    EXPECT_CALL(*m_producer, get_tensor(_)).WillRepeatedly(Return(output_tensor));
+    EXPECT_CALL(*m_producer, set_tensor(_, _)).WillOnce(SaveArg<1>(&bound_output_tensor));
+    EXPECT_CALL(*m_consumer, get_tensor(_)).WillRepeatedly(Return(input_tensor));
+    EXPECT_CALL(*m_consumer, set_tensor(_, _)).WillOnce(SaveArg<1>(&bound_input_tensor));
+
+    const auto tensor = bind();
+    EXPECT_NE(tensor._ptr, output_tensor._ptr);
+    EXPECT_NE(tensor._ptr, input_tensor._ptr);
+    EXPECT_EQ(bound_output_tensor._ptr, tensor._ptr);
+    EXPECT_EQ(bound_input_tensor._ptr, tensor._ptr);
+}
@@ -21,6 +21,8 @@ struct AllocationContext {
     std::vector<std::shared_ptr<Edge>> edges;
     GlobalExecutionIndex execIndex;
     std::vector<size_t> syncPoints;
+    // sorted global execution index ranges [first, last] of the nodes which may be executed in parallel
+    std::vector<std::pair<int, int>> parallelRanges;
 };
 
 }  // namespace ov::intel_cpu
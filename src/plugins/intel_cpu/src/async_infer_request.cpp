@@ -45,6 +45,12 @@ void ov::intel_cpu::AsyncInferRequest::throw_if_canceled() const {
     check_cancelled_state();
 }
 
+void ov::intel_cpu::AsyncInferRequest::yield_to_higher_priority() const {
+    if (m_preemptible_executor) {
+        m_preemptible_executor->yield_to_higher_priority();
+    }
+}
+
 void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
     const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests) {
     m_sub_infer_requests = requests;
@@ -38,10 +38,23 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Sets the shared streams executor whose tasks of a higher priority may preempt the request
+     */
+    void set_preemptible_executor(std::shared_ptr<ov::threading::IStreamsExecutor> executor) {
+        m_preemptible_executor = std::move(executor);
+    }
+
+    /**
+     * @brief Runs the queued tasks of a higher priority on the current stream, if the request can be preempted
+     */
+    void yield_to_higher_priority() const;
+
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_sub_infer_requests;
     bool m_has_sub_infers = false;
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_preemptible_executor;
     std::function<void()> m_infer_func;
 };
 
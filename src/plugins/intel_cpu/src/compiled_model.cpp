@@ -5,17 +5,21 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <exception>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <shared_mutex>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
+#include "cpu_streams_calculation.hpp"
+#include "elastic_streams_executor.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
@@ -59,13 +63,37 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+// Runs the tasks of an infer request with the priority and the latency budget of the model, on the preferred stream of
+// the request if any
+struct RequestScheduleExecutor : public ov::threading::ITaskExecutor {
+    RequestScheduleExecutor(std::shared_ptr<IStreamsExecutor> executor,
+                            ov::hint::Priority priority,
+                            std::chrono::milliseconds latency_budget,
+                            int stream_index)
+        : _executor(std::move(executor)),
+          _priority(priority),
+          _latency_budget(latency_budget),
+          _stream_index(stream_index) {}
+    void run(ov::threading::Task task) override {
+        _executor->run_with_priority(std::move(task),
+                                     _priority,
+                                     std::chrono::steady_clock::now() + _latency_budget,
+                                     _stream_index);
+    }
+    std::shared_ptr<IStreamsExecutor> _executor;
+    ov::hint::Priority _priority;
+    std::chrono::milliseconds _latency_budget;
+    int _stream_index;
+};
+
 CompiledModel::~CompiledModel() {
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
     }
     auto streamsExecutor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_task_executor);
-    if (streamsExecutor) {
+    // a shared executor releases its cores when the last model using it is destroyed
+    if (streamsExecutor && !m_shared_task_executor) {
         streamsExecutor->cpu_reset();
     }
     CPU_DEBUG_CAP_ENABLE(dumpMemoryStats(m_cfg.debugCaps, m_name, m_graphs, m_socketWeights));
@@ -99,7 +127,18 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                              false,
                                                                              true}
                                                   : m_cfg.streamExecutorConfig;
-        m_task_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+        m_shared_task_executor = m_cfg.sharedTaskExecutor && m_cfg.numSubStreams == 0;
+        if (m_shared_task_executor) {
+            m_task_executor = m_plugin->get_executor_manager()->get_shared_cpu_streams_executor(executor_config);
+        } else if (m_cfg.numSubStreams == 0 && executor_config.get_streams() != 0 &&
+                   !all_of(1, executor_config.get_streams(), executor_config.get_threads())) {
+            // the optimized single stream infers on the calling thread, so it keeps the executor it was compiled with
+            m_elastic_executor = std::make_shared<ElasticStreamsExecutor>(
+                m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config));
+            m_task_executor = m_elastic_executor;
+        } else {
+            m_task_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+        }
     }
     if (0 != m_cfg.streamExecutorConfig.get_streams()) {
         m_callback_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
@@ -115,33 +154,14 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         set_callback_executor(m_callback_executor);
     }
 
-    m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
+    // a sync inference of the optimized single stream runs on the calling thread, bypassing the shared executor queue
+    m_optimized_single_stream =
+        !m_shared_task_executor && all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
-    int streams = std::max(1, executor_config.get_streams());
-    std::vector<Task> tasks;
-    tasks.resize(streams);
-    m_graphs.resize(streams);
+    m_active_graphs = std::max(1, executor_config.get_streams());
+    m_graphs.resize(m_active_graphs);
     if (executor_config.get_streams() != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
-#if defined(OV_CPU_WITH_ACL)
-                    static std::once_flag flag_once;
-                    std::call_once(flag_once, [&]() {
-                        std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
-                        arm_compute::Scheduler::set(std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
-                    });
-#endif
-                    CompiledModel::get_graph();
-                };
-            }
-            m_task_executor->run_and_wait(tasks);
-        } while (!all_graphs_ready());
+        init_stream_graphs();
     } else {
         CompiledModel::get_graph();
     }
@@ -173,25 +193,75 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 }
 
+void CompiledModel::init_stream_graphs() const {
+    size_t graphs_num = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock{m_graphs_mutex};
+        graphs_num = m_active_graphs;
+    }
+    auto all_graphs_ready = [&] {
+        std::shared_lock<std::shared_mutex> lock{m_graphs_mutex};
+        return std::all_of(m_graphs.begin(), m_graphs.begin() + graphs_num, [&](Graph& graph) {
+            return graph.IsReady();
+        });
+    };
+    std::vector<Task> tasks(graphs_num);
+    do {
+        for (auto&& task : tasks) {
+            task = [this] {
+#if defined(OV_CPU_WITH_ACL)
+                static std::once_flag flag_once;
+                std::call_once(flag_once, [&]() {
+                    std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
+                    arm_compute::Scheduler::set(std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
+                });
+#endif
+                CompiledModel::get_graph();
+            };
+        }
+        m_task_executor->run_and_wait(tasks);
+    } while (!all_graphs_ready());
+}
+
+std::shared_ptr<IStreamsExecutor> CompiledModel::get_streams_executor() const {
+    // the graph context needs the actual executor, e.g. to query the NUMA node of the stream
+    if (m_elastic_executor) {
+        return m_elastic_executor->get();
+    }
+    return std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+}
+
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     int streamId = 0;
     int socketId = 0;
 
-    size_t graph_idx = 0;
-    if (m_graphs.size() > 1) {
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
-        if (nullptr != streamsExecutor) {
-            streamId = streamsExecutor->get_stream_id();
-            socketId = std::max(0, streamsExecutor->get_socket_id());
+    GraphGuard* graph = nullptr;
+    {
+        // the graphs are never removed, so the reference stays valid when the lock is released
+        std::shared_lock<std::shared_mutex> lock{m_graphs_mutex};
+        size_t graph_idx = 0;
+        size_t graphs_num = m_active_graphs;
+        auto streamsExecutor = get_streams_executor();
+        if (m_elastic_executor && streamsExecutor) {
+            // a task queued before the number of streams changed keeps the graph of its stream
+            const auto streams = static_cast<size_t>(std::max(1, streamsExecutor->get_streams_num()));
+            graphs_num = std::min(m_graphs.size(), streams);
+        }
+        if (graphs_num > 1) {
+            if (nullptr != streamsExecutor) {
+                streamId = streamsExecutor->get_stream_id();
+                socketId = std::max(0, streamsExecutor->get_socket_id());
+            }
+            graph_idx = streamId % graphs_num;
         }
-        graph_idx = streamId % m_graphs.size();
+        graph = &m_graphs[graph_idx];
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(*graph);
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+        auto streamsExecutor = get_streams_executor();
         auto makeGraph = [&] {
             try {
                 GraphContext::Ptr ctx;
@@ -234,11 +304,31 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
 
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     auto internal_request = create_sync_infer_request();
+    auto task_executor = get_task_executor();
+    auto streams_executor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    const bool pin_to_stream = m_cfg.enableStreamAffinity && !m_has_sub_compiled_models && streams_executor &&
+                               streams_executor->get_streams_num() > 1;
+    if (pin_to_stream || (m_shared_task_executor && streams_executor)) {
+        const int stream_index = pin_to_stream ? m_nextPreferredStream++ % streams_executor->get_streams_num() : -1;
+        task_executor = std::make_shared<RequestScheduleExecutor>(streams_executor,
+                                                                  m_cfg.modelPriority,
+                                                                  std::chrono::milliseconds(m_cfg.latencyBudgetMs),
+                                                                  stream_index);
+    }
+    if (pin_to_stream) {
+        // the pages of I/O tensors are touched by the first inference on the preferred stream, so they are placed on
+        // its NUMA node without waiting for the inferences queued to the stream here
+        std::static_pointer_cast<SyncInferRequest>(internal_request)->enable_first_touch();
+    }
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
-                                            get_task_executor(),
+                                            task_executor,
                                             get_callback_executor(),
                                             m_optimized_single_stream);
+    // requests of the highest priority are never preempted, so they skip the preemption points
+    if (m_shared_task_executor && m_cfg.modelPriority != ov::hint::Priority::HIGH) {
+        async_infer_request->set_preemptible_executor(streams_executor);
+    }
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
@@ -284,7 +374,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::supported_properties.name()),
             RO_property(ov::model_name.name()),
             RO_property(ov::optimal_number_of_infer_requests.name()),
-            RO_property(ov::num_streams.name()),
+            ov::PropertyName(ov::num_streams.name(), ov::PropertyMutability::RW),
             RO_property(ov::inference_num_threads.name()),
             RO_property(ov::enable_profiling.name()),
             RO_property(ov::hint::inference_precision.name()),
@@ -294,6 +384,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::enable_cpu_reservation.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::hint::model_distribution_policy.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
             RO_property(ov::execution_devices.name()),
@@ -316,18 +407,23 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         std::string modelName = graph.GetName();
         return decltype(ov::model_name)::value_type(modelName);
     }
+    // the number of streams may be changed after compilation, so it is taken from the model config
+    auto executor_config = [&] {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        return m_cfg.streamExecutorConfig;
+    };
     if (name == ov::optimal_number_of_infer_requests) {
-        const auto streams = config.streamExecutorConfig.get_streams();
+        const auto streams = executor_config().get_streams();
         return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(
             streams > 0 ? streams : 1);  // ov::optimal_number_of_infer_requests has no negative values
     }
     if (name == ov::num_streams) {
-        const auto streams = config.streamExecutorConfig.get_streams();
+        const auto streams = executor_config().get_streams();
         return decltype(ov::num_streams)::value_type(
             streams);  // ov::num_streams has special negative values (AUTO = -1, NUMA = -2)
     }
     if (name == ov::inference_num_threads) {
-        const auto num_threads = config.streamExecutorConfig.get_threads();
+        const auto num_threads = executor_config().get_threads();
         return static_cast<decltype(ov::inference_num_threads)::value_type>(num_threads);
     }
     if (name == ov::enable_profiling.name()) {
@@ -355,6 +451,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const auto stream_mode = config.schedulingCoreType;
         return stream_mode;
     }
+    if (name == ov::hint::model_priority) {
+        return config.modelPriority;
+    }
     if (name == ov::hint::model_distribution_policy) {
         const auto& distribution_policy = config.modelDistributionPolicy;
         return distribution_policy;
@@ -417,7 +516,78 @@ void CompiledModel::export_model(std::ostream& modelStream) const {
     serializer << m_model;
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& property : properties) {
+        if (property.first != ov::num_streams.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           property.first,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    for (const auto& [key, value] : properties) {
+        ov::streams::Num streams;
+        try {
+            streams = value.as<ov::streams::Num>();
+        } catch (ov::Exception&) {
+            OPENVINO_THROW("Wrong value ", value.as<std::string>(), " for property key ", key);
+        }
+        set_num_streams(streams);
+    }
+}
+
+void CompiledModel::set_num_streams(int streams) {
+    OPENVINO_ASSERT(m_elastic_executor,
+                    "The number of streams can't be changed for the compiled model ",
+                    m_name,
+                    ", since it uses sub-streams, a shared or a single-threaded executor");
+    OPENVINO_ASSERT(streams > 0, "Wrong value ", streams, " for property key ", ov::num_streams.name());
+
+    std::lock_guard<std::mutex> set_streams_lock{m_set_streams_mutex};
+    Config cfg = m_cfg;
+    cfg.streams = streams;
+    cfg.streamsChanged = true;
+    get_num_streams(streams, m_model, cfg);
+    const auto& executor_config = cfg.streamExecutorConfig;
+    if (executor_config.get_streams() == get_streams_executor()->get_streams_num()) {
+        return;
+    }
+    auto executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+
+    const auto graphs_num = static_cast<size_t>(std::max(1, executor_config.get_streams()));
+    size_t prev_graphs_num = 0;
+    {
+        std::unique_lock<std::shared_mutex> lock{m_graphs_mutex};
+        prev_graphs_num = m_active_graphs;
+        while (m_graphs.size() < graphs_num) {
+            m_graphs.emplace_back();
+        }
+        m_active_graphs = graphs_num;
+    }
+    {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        m_cfg.streamExecutorConfig = executor_config;
+    }
+    // the new tasks run on the new streams, the ones queued to the previous executor finish on its streams and
+    // graphs before its cores are released
+    m_elastic_executor->reset(executor)->cpu_reset();
+    // the graphs of the new streams share the weights with the existing graphs of the same socket
+    init_stream_graphs();
+
+    // the graphs of the removed streams keep their state to be reused if the number of streams grows again, but their
+    // intermediate buffers are released, since no stream runs them anymore
+    for (size_t i = graphs_num; i < prev_graphs_num; i++) {
+        std::shared_lock<std::shared_mutex> lock{m_graphs_mutex};
+        auto& graph = m_graphs[i];
+        std::lock_guard<std::mutex> graph_lock(graph._mutex);
+        if (graph.IsReady()) {
+            graph.getGraphContext()->releaseMemory();
+        }
+    }
+}
+
 void CompiledModel::release_memory() {
+    std::shared_lock<std::shared_mutex> graphs_lock{m_graphs_mutex};
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
         std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
@@ -9,11 +9,13 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "config.h"
+#include "elastic_streams_executor.hpp"
 #include "graph.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
@@ -56,10 +58,11 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    /**
+     * @brief Only ov::num_streams can be changed on a compiled model: the streams executor is replaced and the graphs
+     * of the new streams are created, sharing the weights with the existing ones
+     */
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -71,21 +74,32 @@ private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
 
+    void set_num_streams(int streams);
+    void init_stream_graphs() const;
+    std::shared_ptr<ov::threading::IStreamsExecutor> get_streams_executor() const;
+
     const std::shared_ptr<ov::Model> m_model;
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    // Same as m_task_executor if the number of streams can be changed at runtime
+    std::shared_ptr<ElasticStreamsExecutor> m_elastic_executor = nullptr;
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
     std::shared_ptr<std::mutex> m_mutex;
     Config m_cfg;
     mutable std::atomic_int m_numRequests = {0};
+    mutable std::atomic_int m_nextPreferredStream = {0};
     std::string m_name;
 
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
+    // The graphs are only appended when the number of streams grows, the ones beyond m_active_graphs are not used
     mutable std::deque<GraphGuard> m_graphs;
+    size_t m_active_graphs = 0;
+    mutable std::shared_mutex m_graphs_mutex;
+    std::mutex m_set_streams_mutex;
     mutable SocketsWeights m_socketWeights;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
@@ -102,6 +116,7 @@ private:
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+    bool m_shared_task_executor = false;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
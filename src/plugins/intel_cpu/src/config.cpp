@@ -149,6 +149,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::scheduling_core_type.name(),
                                ". Expected only ov::hint::SchedulingCoreType::ANY_CORE/PCORE_ONLY/ECORE_ONLY");
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+            }
         } else if (key == ov::hint::model_distribution_policy.name()) {
             auto error_info = [&]() {
                 OPENVINO_THROW("Wrong value ",
@@ -475,6 +485,46 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::enable_reshape_compile_cache.name()) {
+            try {
+                enableReshapeCompileCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_reshape_compile_cache.name());
+            }
+        } else if (key == ov::intel_cpu::enable_inter_op_parallelism.name()) {
+            try {
+                enableInterOpParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_inter_op_parallelism.name());
+            }
+        } else if (key == ov::intel_cpu::enable_stream_affinity.name()) {
+            try {
+                enableStreamAffinity = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_stream_affinity.name());
+            }
+        } else if (key == ov::intel_cpu::prefill_chunk_size.name()) {
+            try {
+                prefillChunkSize = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::prefill_chunk_size.name());
+            }
+            OPENVINO_ASSERT(prefillChunkSize != 1,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::prefill_chunk_size.name(),
+                            ". Chunk must contain at least 2 tokens");
+        } else if (key == ov::intel_cpu::shared_task_executor.name()) {
+            try {
+                sharedTaskExecutor = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::shared_task_executor.name());
+            }
+        } else if (key == ov::intel_cpu::latency_budget_ms.name()) {
+            try {
+                latencyBudgetMs = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::latency_budget_ms.name());
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
@@ -87,6 +87,14 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    bool enableReshapeCompileCache = false;
+    bool enableInterOpParallelism = false;
+    bool enableStreamAffinity = false;
+    uint32_t prefillChunkSize = 0;
+    // indices of the outputs which follow the sequence of the tokens, they are concatenated by the chunked prefill
+    std::vector<size_t> prefillSequenceOutputs;
+    bool sharedTaskExecutor = false;
+    uint32_t latencyBudgetMs = 0;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -101,6 +109,7 @@ struct Config {
     bool changedCpuPinning = false;
     bool enableCpuReservation = false;
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
     ov::intel_cpu::TbbPartitioner tbbPartitioner = ov::intel_cpu::TbbPartitioner::NONE;
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy;
     bool enableTensorParallel = false;
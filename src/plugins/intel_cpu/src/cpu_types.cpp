@@ -147,6 +147,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"NV12toBGR", Type::ColorConvert},
         {"I420toRGB", Type::ColorConvert},
         {"I420toBGR", Type::ColorConvert},
+        {"YuvPreprocess", Type::YuvPreprocess},
         {"Col2Im", Type::Col2Im},
         {"MVN", Type::MVN},
         {"NormalizeL2", Type::NormalizeL2},
@@ -239,6 +240,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"MulticlassNms", Type::MulticlassNms},
         {"MulticlassNmsIEInternal", Type::MulticlassNms},
         {"Multinomial", Type::Multinomial},
+        {"LogitsSampling", Type::LogitsSampling},
         {"Reference", Type::Reference},
         {"Subgraph", Type::Subgraph},
         {"SubModel", Type::SubModel},
@@ -324,6 +326,7 @@ std::string NameFromType(const Type type) {
         CASE(Convert);
         CASE(Col2Im);
         CASE(ColorConvert);
+        CASE(YuvPreprocess);
         CASE(NormalizeL2);
         CASE(ScatterUpdate);
         CASE(ScatterElementsUpdate);
@@ -380,6 +383,7 @@ std::string NameFromType(const Type type) {
         CASE(MatrixNms);
         CASE(MulticlassNms);
         CASE(Multinomial);
+        CASE(LogitsSampling);
         CASE(Reference);
         CASE(Subgraph);
         CASE(SubModel);
@@ -63,6 +63,7 @@ enum class Type : uint8_t {
     TensorIterator,
     Convert,
     ColorConvert,
+    YuvPreprocess,
     Col2Im,
     MVN,
     NormalizeL2,
@@ -120,6 +121,7 @@ enum class Type : uint8_t {
     MatrixNms,
     MulticlassNms,
     Multinomial,
+    LogitsSampling,
     Subgraph,
     SubModel,
     PriorBox,
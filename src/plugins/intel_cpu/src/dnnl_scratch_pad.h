@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -15,27 +17,62 @@
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Scratch pad memory shared by the nodes of a graph.
+ * The scratch pad consists of slots. Nodes which may be executed in parallel (see Graph inter-op parallelism) acquire
+ * the memory from different slots. The slot is selected by the SlotGuard which is active in the current thread.
+ */
 class DnnlScratchPad {
-    MemoryBlockPtr blockPtr;
-    MemoryBlockWithReuse* baseBlockPtr = nullptr;
+    std::vector<MemoryBlockPtr> blockPtrs;
+    std::vector<MemoryBlockWithReuse*> baseBlockPtrs;
     dnnl::engine eng;
+    int numaNode;
+
+    static inline thread_local size_t currentSlot = 0;
 
 public:
-    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
-        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numa_node);
-        baseBlockPtr = baseMemoryBlock.get();
-        blockPtr = std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock));
+    class SlotGuard {
+    public:
+        explicit SlotGuard(size_t slot) : prevSlot(currentSlot) {
+            currentSlot = slot;
+        }
+        ~SlotGuard() {
+            currentSlot = prevSlot;
+        }
+        SlotGuard(const SlotGuard&) = delete;
+        SlotGuard& operator=(const SlotGuard&) = delete;
+
+    private:
+        size_t prevSlot;
+    };
+
+    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)), numaNode(numa_node) {
+        reserveSlots(1);
+    }
+
+    /**
+     * @brief Makes sure at least \p count slots exist.
+     * Must not be called concurrently with createScratchPadMem().
+     */
+    void reserveSlots(size_t count) {
+        while (blockPtrs.size() < count) {
+            auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numaNode);
+            baseBlockPtrs.push_back(baseMemoryBlock.get());
+            blockPtrs.push_back(std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock)));
+        }
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
-        return std::make_shared<Memory>(eng, md, blockPtr);
+        assert(currentSlot < blockPtrs.size());
+        return std::make_shared<Memory>(eng, md, blockPtrs[currentSlot]);
     }
 
     [[nodiscard]] size_t size() const {
-        if (baseBlockPtr) {
-            return baseBlockPtr->size();
+        size_t total = 0;
+        for (const auto* baseBlockPtr : baseBlockPtrs) {
+            total += baseBlockPtr->size();
         }
-        return 0;
+        return total;
     }
 };
 
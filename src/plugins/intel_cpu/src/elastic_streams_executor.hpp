@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+
+namespace ov::intel_cpu {
+
+// Streams executor of a compiled model which can be replaced at runtime, when the number of streams is changed.
+// Infer requests keep this executor, so the requests created before the change run on the new streams as well.
+// Tasks queued before the change finish on the previous executor and see it as the current one, so they keep the
+// streams and the graphs of the previous configuration
+class ElasticStreamsExecutor : public ov::threading::IStreamsExecutor {
+public:
+    explicit ElasticStreamsExecutor(std::shared_ptr<IStreamsExecutor> executor)
+        : m_generation(std::make_shared<Generation>(std::move(executor))) {}
+
+    // The executor running the current task, or the one new tasks are queued to if called outside of a task
+    std::shared_ptr<IStreamsExecutor> get() const {
+        if (current_task.owner == this) {
+            return current_task.generation->executor;
+        }
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_generation->executor;
+    }
+
+    // Queues the new tasks to the executor and waits until the tasks queued to the previous one are finished
+    // @return the previous executor
+    std::shared_ptr<IStreamsExecutor> reset(std::shared_ptr<IStreamsExecutor> executor) {
+        OPENVINO_ASSERT(current_task.owner != this, "The streams executor can't be replaced by its own task");
+        std::shared_ptr<Generation> previous;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            previous = std::exchange(m_generation, std::make_shared<Generation>(std::move(executor)));
+        }
+        std::unique_lock<std::mutex> lock{previous->mutex};
+        previous->drained.wait(lock, [&] {
+            return previous->pending == 0;
+        });
+        return previous->executor;
+    }
+
+    void run(ov::threading::Task task) override {
+        auto generation = acquire();
+        generation->executor->run(wrap(std::move(task), generation));
+    }
+
+    void execute(ov::threading::Task task) override {
+        auto generation = acquire();
+        generation->executor->execute(wrap(std::move(task), generation));
+    }
+
+    void run_on_stream(ov::threading::Task task, int stream_index) override {
+        auto generation = acquire();
+        generation->executor->run_on_stream(wrap(std::move(task), generation), stream_index);
+    }
+
+    void run_with_priority(ov::threading::Task task,
+                           ov::hint::Priority priority,
+                           std::chrono::steady_clock::time_point deadline,
+                           int stream_index) override {
+        auto generation = acquire();
+        generation->executor->run_with_priority(wrap(std::move(task), generation), priority, deadline, stream_index);
+    }
+
+    bool yield_to_higher_priority() override {
+        return get()->yield_to_higher_priority();
+    }
+
+    int get_stream_id() override {
+        return get()->get_stream_id();
+    }
+
+    int get_streams_num() override {
+        return get()->get_streams_num();
+    }
+
+    int get_numa_node_id() override {
+        return get()->get_numa_node_id();
+    }
+
+    int get_socket_id() override {
+        return get()->get_socket_id();
+    }
+
+    std::vector<int> get_rank() override {
+        return get()->get_rank();
+    }
+
+    void cpu_reset() override {
+        get()->cpu_reset();
+    }
+
+private:
+    // Executor with the number of its tasks which are queued or running
+    struct Generation {
+        explicit Generation(std::shared_ptr<IStreamsExecutor> executor) : executor(std::move(executor)) {}
+        std::shared_ptr<IStreamsExecutor> executor;
+        std::mutex mutex;
+        std::condition_variable drained;
+        size_t pending = 0;
+    };
+
+    // zero initialized as a thread_local
+    struct CurrentTask {
+        const ElasticStreamsExecutor* owner;
+        Generation* generation;
+    };
+
+    // The task is counted under the lock of the current executor, so no task is queued to the previous one once it
+    // is replaced
+    std::shared_ptr<Generation> acquire() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        std::lock_guard<std::mutex> generation_lock{m_generation->mutex};
+        m_generation->pending++;
+        return m_generation;
+    }
+
+    ov::threading::Task wrap(ov::threading::Task task, std::shared_ptr<Generation> generation) {
+        return [this, task = std::move(task), generation = std::move(generation)] {
+            const auto previous = std::exchange(current_task, CurrentTask{this, generation.get()});
+            auto finish = [&] {
+                current_task = previous;
+                std::lock_guard<std::mutex> lock{generation->mutex};
+                if (--generation->pending == 0) {
+                    generation->drained.notify_all();
+                }
+            };
+            try {
+                task();
+            } catch (...) {
+                finish();
+                throw;
+            }
+            finish();
+        };
+    }
+
+    static inline thread_local CurrentTask current_task;
+
+    mutable std::mutex m_mutex;
+    std::shared_ptr<Generation> m_generation;
+};
+
+}  // namespace ov::intel_cpu
@@ -100,11 +100,13 @@
 #include "snippets/op/vector_buffer.hpp"
 #include "transformations/cpu_opset/common/op/causal_mask_preprocess.hpp"
 #include "transformations/cpu_opset/common/op/leaky_relu.hpp"
+#include "transformations/cpu_opset/common/op/logits_sampling.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
 #include "transformations/cpu_opset/common/op/power_static.hpp"
 #include "transformations/cpu_opset/common/op/read_value_with_subgraph.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
 #include "transformations/cpu_opset/common/op/swish_cpu.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
 #if defined(OPENVINO_ARCH_X86_64)
 #    include "transformations/cpu_opset/x64/op/interaction.hpp"
 #    include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
@@ -184,6 +186,8 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::LogitsSamplingNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::YuvPreprocessNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::ReadValueWithSubgraph>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::GatherCompressed>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::NonMaxSuppressionIEInternal>>(),
@@ -23,6 +23,7 @@
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -34,6 +35,7 @@
 #include "allocation_context.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "dnnl_scratch_pad.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "graph_dumper.h"
@@ -84,6 +86,7 @@
 
 #if OV_THREAD_USE_TBB
 #    include <tbb/task.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -562,6 +565,8 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            // the scratch pad memory is acquired from the slot the node is executed with
+            DnnlScratchPad::SlotGuard slotGuard(GetScratchPadSlot(node));
             node->createPrimitive();
         }
 
@@ -919,6 +924,248 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     return syncNodesInds;
 }
 
+#if OV_THREAD_USE_TBB
+// Memory of the nodes in a parallel section is not reused within the section, so the section size is limited
+static constexpr size_t maxParallelSectionSize = 64;
+static constexpr size_t maxParallelBranches = 8;
+
+static bool IsParallelSectionBarrier(const NodePtr& node) {
+    // memory state nodes communicate through the states rather than through the edges
+    if (any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+        return true;
+    }
+    // the primitives of the inner graphs are bound to the scratchpad slot 0, so the nodes owning inner graphs
+    // can't run concurrently with the other sections
+    return any_of(node->getType(), Type::If, Type::TensorIterator, Type::SubModel, Type::LoRA);
+}
+
+/**
+ * Collects for each executable node the executable nodes it must be executed after:
+ * - producers of its inputs, looking through not executable nodes (i.e. inplace Reshape or Concat)
+ * - previous nodes accessing the same memory by means of inplace logic, to avoid overwriting the data being read
+ */
+static std::vector<std::vector<size_t>> CollectExecutionDependencies(const std::vector<NodePtr>& executableNodes,
+                                                                     const std::vector<EdgePtr>& graphEdges) {
+    std::unordered_map<const Node*, size_t> execIndices;
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        execIndices[executableNodes[i].get()] = i;
+    }
+
+    // executable producers of not executable nodes
+    std::unordered_map<const Node*, std::vector<size_t>> passThroughProducers;
+    std::function<void(const NodePtr&, std::vector<size_t>&)> collectProducers;
+    collectProducers = [&](const NodePtr& node, std::vector<size_t>& producers) {
+        for (const auto& weakEdge : node->getParentEdges()) {
+            const auto edge = weakEdge.lock();
+            if (!edge) {
+                continue;
+            }
+            const auto parent = edge->getParent();
+            if (auto it = execIndices.find(parent.get()); it != execIndices.end()) {
+                producers.push_back(it->second);
+                continue;
+            }
+            auto it = passThroughProducers.find(parent.get());
+            if (it == passThroughProducers.end()) {
+                std::vector<size_t> parentProducers;
+                collectProducers(parent, parentProducers);
+                it = passThroughProducers.emplace(parent.get(), std::move(parentProducers)).first;
+            }
+            producers.insert(producers.end(), it->second.begin(), it->second.end());
+        }
+    };
+
+    std::vector<std::vector<size_t>> dependencies(executableNodes.size());
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        collectProducers(executableNodes[i], dependencies[i]);
+    }
+
+    // executable nodes accessing the same memory, the flag marks the nodes writing the memory
+    std::unordered_map<Edge*, std::vector<std::pair<size_t, bool>>> sharedMemoryAccessors;
+    for (const auto& edge : graphEdges) {
+        auto baseEdge = edge;
+        while (auto sharedEdge = baseEdge->getSharedEdge(std::nothrow)) {
+            baseEdge = sharedEdge;
+        }
+        auto& accessors = sharedMemoryAccessors[baseEdge.get()];
+        if (auto it = execIndices.find(edge->getParent().get()); it != execIndices.end()) {
+            accessors.emplace_back(it->second, true);
+        }
+        if (auto it = execIndices.find(edge->getChild().get()); it != execIndices.end()) {
+            accessors.emplace_back(it->second, false);
+        }
+    }
+    for (auto& [baseEdge, accessors] : sharedMemoryAccessors) {
+        // keep the execution order: readers follow the last writer, writers follow all the previous accessors
+        std::sort(accessors.begin(), accessors.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second);
+        });
+        std::optional<size_t> lastWriter;
+        std::vector<size_t> readers;
+        for (const auto& [index, isWriter] : accessors) {
+            if (lastWriter == index || (!readers.empty() && readers.back() == index)) {
+                continue;
+            }
+            if (lastWriter) {
+                dependencies[index].push_back(*lastWriter);
+            }
+            if (isWriter) {
+                dependencies[index].insert(dependencies[index].end(), readers.begin(), readers.end());
+                readers.clear();
+                lastWriter = index;
+            } else {
+                readers.push_back(index);
+            }
+        }
+    }
+
+    for (auto& nodeDependencies : dependencies) {
+        std::sort(nodeDependencies.begin(), nodeDependencies.end());
+        nodeDependencies.erase(std::unique(nodeDependencies.begin(), nodeDependencies.end()), nodeDependencies.end());
+    }
+
+    return dependencies;
+}
+
+/**
+ * Splits executable nodes into ranges [begin, end) which contain independent branches.
+ * A range is closed as soon as all its branches are joined, so chains of nodes form single node ranges.
+ */
+static std::vector<std::pair<size_t, size_t>> FormParallelSections(
+    const std::vector<NodePtr>& executableNodes,
+    const std::vector<std::vector<size_t>>& dependencies) {
+    std::vector<bool> hasSuccessors(executableNodes.size(), false);
+    for (const auto& nodeDependencies : dependencies) {
+        for (const auto dependency : nodeDependencies) {
+            hasSuccessors[dependency] = true;
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> sections;
+    // nodes of the current section without successors in the section yet
+    std::set<size_t> openBranches;
+    size_t begin = 0;
+    auto closeSection = [&](size_t end) {
+        if (end > begin + 1) {
+            sections.emplace_back(begin, end);
+        }
+        begin = end;
+        openBranches.clear();
+    };
+
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        if (IsParallelSectionBarrier(executableNodes[i])) {
+            closeSection(i);
+            closeSection(i + 1);
+            continue;
+        }
+        if (i - begin == maxParallelSectionSize) {
+            closeSection(i);
+        }
+        for (const auto dependency : dependencies[i]) {
+            openBranches.erase(dependency);
+        }
+        if (hasSuccessors[i]) {
+            openBranches.insert(i);
+        }
+        if (openBranches.size() <= 1) {
+            closeSection(i + 1);
+        }
+    }
+    closeSection(executableNodes.size());
+
+    return sections;
+}
+
+#endif
+
+void Graph::CreateParallelSections(AllocationContext& context) {
+    m_parallelSections.clear();
+    m_scratchPadSlots.clear();
+    m_slotStreams.clear();
+#if OV_THREAD_USE_TBB
+    const size_t maxBranches = std::min<size_t>(maxParallelBranches, parallel_get_max_threads());
+    if (!getConfig().enableInterOpParallelism || status != Status::ReadyStatic || maxBranches < 2) {
+        return;
+    }
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreateParallelSections");
+
+    const auto dependencies = CollectExecutionDependencies(m_executableGraphNodes, graphEdges);
+    size_t numSlots = 1;
+
+    for (const auto& [begin, end] : FormParallelSections(m_executableGraphNodes, dependencies)) {
+        const size_t size = end - begin;
+        std::vector<std::vector<size_t>> predecessors(size);
+        for (size_t i = 0; i < size; i++) {
+            for (const auto dependency : dependencies[begin + i]) {
+                if (dependency >= begin) {
+                    predecessors[i].push_back(dependency - begin);
+                }
+            }
+        }
+
+        // Split the section into chains of dependent nodes, one slot per chain.
+        // When the number of chains reaches the limit, a node is attached to the chain which ended the earliest.
+        ParallelSection section{begin, end, {}, std::vector<std::vector<size_t>>(size), std::vector<size_t>(size)};
+        std::vector<size_t> chainTails;
+        std::vector<bool> isChainTail(size, false);
+        for (size_t i = 0; i < size; i++) {
+            auto predecessor = std::find_if(predecessors[i].begin(), predecessors[i].end(), [&](size_t p) {
+                return isChainTail[p];
+            });
+            size_t slot = 0;
+            if (predecessor != predecessors[i].end()) {
+                slot = section.slots[*predecessor];
+            } else if (chainTails.size() < maxBranches) {
+                slot = chainTails.size();
+                chainTails.push_back(i);
+            } else {
+                slot = static_cast<size_t>(
+                    std::distance(chainTails.begin(), std::min_element(chainTails.begin(), chainTails.end())));
+                predecessors[i].push_back(chainTails[slot]);
+            }
+            isChainTail[chainTails[slot]] = false;
+            chainTails[slot] = i;
+            isChainTail[i] = true;
+            section.slots[i] = slot;
+        }
+        if (chainTails.size() < 2) {
+            continue;
+        }
+
+        for (size_t i = 0; i < size; i++) {
+            section.dependencies.push_back(predecessors[i].size());
+            for (const auto predecessor : predecessors[i]) {
+                section.successors[predecessor].push_back(i);
+            }
+            if (section.slots[i] != 0) {
+                m_scratchPadSlots[m_executableGraphNodes[begin + i].get()] = section.slots[i];
+            }
+        }
+        numSlots = std::max(numSlots, chainTails.size());
+
+        context.parallelRanges.emplace_back(context.execIndex.at(m_executableGraphNodes[begin]).first,
+                                            context.execIndex.at(m_executableGraphNodes[end - 1]).second);
+        DEBUG_LOG("Parallel section: [", begin, ", ", end, ") with ", chainTails.size(), " branches");
+        m_parallelSections.push_back(std::move(section));
+    }
+
+    for (const auto& scratchPad : m_context->getScratchPads()) {
+        scratchPad->reserveSlots(numSlots);
+    }
+    for (size_t slot = 1; slot < numSlots; slot++) {
+        m_slotStreams.push_back(make_stream(getEngine(), m_context->getCpuParallel()->get_thread_pool()));
+    }
+#else
+    (void)context;
+#endif
+}
+
+size_t Graph::GetScratchPadSlot(const NodePtr& node) const {
+    auto it = m_scratchPadSlots.find(node.get());
+    return it == m_scratchPadSlots.end() ? 0 : it->second;
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1046,9 +1293,36 @@ static void ValidateEdgeClusters(const EdgeClusters& clusters, size_t remaining)
     }
 }
 
+/**
+ * Extends the lifetime of a memory region to the whole parallel range if the region starts or ends inside of it,
+ * since the nodes of the range may be executed in any order.
+ */
+static void ExtendToParallelRanges(MemoryRegion& reg, const std::vector<std::pair<int, int>>& parallelRanges) {
+    auto findRange = [&parallelRanges](int execIndex) {
+        auto it = std::upper_bound(parallelRanges.begin(),
+                                   parallelRanges.end(),
+                                   execIndex,
+                                   [](int value, const std::pair<int, int>& range) {
+                                       return value < range.first;
+                                   });
+        if (it == parallelRanges.begin() || std::prev(it)->second < execIndex) {
+            return parallelRanges.end();
+        }
+        return std::prev(it);
+    };
+
+    if (auto it = findRange(reg.start); it != parallelRanges.end()) {
+        reg.start = it->first;
+    }
+    if (auto it = findRange(reg.finish); it != parallelRanges.end()) {
+        reg.finish = it->second;
+    }
+}
+
 static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                        size_t remaining,
-                                       const GlobalExecutionIndex& globalExecIndex) {
+                                       const GlobalExecutionIndex& globalExecIndex,
+                                       const std::vector<std::pair<int, int>>& parallelRanges) {
     auto isConstOutput = [](const EdgePtr& edge) {
         return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
     };
@@ -1114,6 +1388,7 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
         }
 
         reg.size = boxSize;
+        ExtendToParallelRanges(reg, parallelRanges);
 
         if (isConst) {
             reg.type = MemoryRegion::RegionType::CONSTANT;
@@ -1169,7 +1444,8 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     Graph::OutputMemoryBlocks outputNodesMemBlocks;
     std::tie(remaining, outputNodesMemBlocks) = AllocateDynamicOutputEdges(edgeClusters, remaining, outputNodes);
 
-    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex);
+    auto memoryRegions =
+        FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex, allocationContext.parallelRanges);
 
     memoryControl->insert(memoryRegions, allocationContext.syncPoints);
     auto memoryBlocks = memoryControl->solve();
@@ -1190,6 +1466,8 @@ void Graph::Allocate() {
     const auto& edges = allocationContext.edges;
     InitEdgeStatus(edges);
 
+    CreateParallelSections(allocationContext);
+
     MemoryControl::MemorySolution solution;
     EdgeClusters edgeClusters;
     std::tie(solution, edgeClusters, m_outputNodesMemBlocks) =
@@ -1359,8 +1637,95 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
 }
 
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
-    for (const auto& node : m_executableGraphNodes) {
-        ExecuteNodeWithCatch(node, request, numaId);
+    size_t inferCounter = 0;
+    for (const auto& section : m_parallelSections) {
+        for (; inferCounter < section.begin; ++inferCounter) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[inferCounter], request, numaId);
+        }
+        InferParallelSection(section, request, numaId);
+        inferCounter = section.end;
+    }
+    for (; inferCounter < m_executableGraphNodes.size(); ++inferCounter) {
+        ExecuteNodeWithCatch(m_executableGraphNodes[inferCounter], request, numaId);
+    }
+}
+
+namespace {
+// set while a node of a parallel section is executed in the current thread
+thread_local bool executingParallelSection = false;
+
+class ParallelSectionGuard {
+public:
+    ParallelSectionGuard() : m_prev(std::exchange(executingParallelSection, true)) {}
+    ~ParallelSectionGuard() {
+        executingParallelSection = m_prev;
+    }
+    ParallelSectionGuard(const ParallelSectionGuard&) = delete;
+    ParallelSectionGuard& operator=(const ParallelSectionGuard&) = delete;
+
+private:
+    bool m_prev;
+};
+}  // namespace
+
+void Graph::InferParallelSection(const ParallelSection& section, SyncInferRequest* request, int numaId) const {
+    auto executeNode = [&](size_t idx) {
+        const auto slot = section.slots[idx];
+        ParallelSectionGuard sectionGuard;
+        DnnlScratchPad::SlotGuard slotGuard(slot);
+        ExecuteNodeWithCatch(m_executableGraphNodes[section.begin + idx],
+                             slot == 0 ? m_stream : m_slotStreams[slot - 1],
+                             request,
+                             numaId);
+    };
+
+#if OV_THREAD_USE_TBB
+    // nested sections (i.e. of an inner graph executed by a node of a parallel section) are executed sequentially
+    if (!executingParallelSection) {
+        const size_t size = section.end - section.begin;
+        auto pending = std::make_unique<std::atomic<size_t>[]>(size);
+        for (size_t i = 0; i < size; i++) {
+            pending[i].store(section.dependencies[i], std::memory_order_relaxed);
+        }
+
+        tbb::task_group taskGroup;
+        std::function<void(size_t)> executeBranch;
+        executeBranch = [&](size_t idx) {
+            // keep executing the first ready successor in the same task, the rest are spawned to be stolen
+            while (idx < size) {
+                executeNode(idx);
+                size_t next = size;
+                for (const auto successor : section.successors[idx]) {
+                    if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                        continue;
+                    }
+                    if (next == size) {
+                        next = successor;
+                    } else {
+                        taskGroup.run([&executeBranch, successor] {
+                            executeBranch(successor);
+                        });
+                    }
+                }
+                idx = next;
+            }
+        };
+
+        for (size_t i = 0; i < size; i++) {
+            if (section.dependencies[i] == 0) {
+                taskGroup.run([&executeBranch, i] {
+                    executeBranch(i);
+                });
+            }
+        }
+
+        taskGroup.wait();
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < section.end - section.begin; i++) {
+        executeNode(i);
     }
 }
 
@@ -1606,19 +1971,34 @@ public:
     OV_ITT_SCOPED_TASK_BASE(ittScope, (node)->perfCounters().execute); \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
+        // the yield may execute a request of another model in the current thread, which must not inherit the
+        // scratchpad slot and the state of a parallel section
+        if (!executingParallelSection) {
+            request->yield_to_higher_priority();
+        }
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -297,6 +297,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_parallelSections.clear();
+        m_scratchPadSlots.clear();
+        m_slotStreams.clear();
     }
     Status status{Status::NotReady};
 
@@ -328,6 +331,12 @@ protected:
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
     std::vector<size_t> CreateExecutionGraph();
+    /**
+     * Split executable nodes of a static graph into sections of independent branches executed in parallel
+     * (inter-op parallelism) and register global execution ranges of the sections in \p context,
+     * so memory is not reused between the nodes which may be executed at the same time.
+     */
+    void CreateParallelSections(AllocationContext& context);
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -338,15 +347,20 @@ protected:
      * @params numaId   Numa Id to be used for an execution
      */
     void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request,
+                              int numaId) const;
 
     /**
-     * Execute a given \p node within \p request using \p numaId
+     * Execute a given \p node on \p stream within \p request using \p numaId
      *
      * @params node     Node to execute
+     * @params stream   Stream to be used for an execution
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream, SyncInferRequest* request, int numaId) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
@@ -357,6 +371,24 @@ protected:
 private:
     using event_t = void (Graph::*)();
 
+    /**
+     * A range of executable nodes which are executed in parallel according to the data dependencies between them.
+     * Each node is assigned a slot: nodes of the same slot are always ordered by dependencies, so they share
+     * the scratch pad memory and the stream of the slot.
+     */
+    struct ParallelSection {
+        size_t begin = 0;
+        size_t end = 0;
+        // number of in-section predecessors of every node
+        std::vector<size_t> dependencies;
+        // in-section successors of every node, indices are relative to begin
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> slots;
+    };
+
+    void InferParallelSection(const ParallelSection& section, SyncInferRequest* request, int numaId) const;
+    size_t GetScratchPadSlot(const NodePtr& node) const;
+
     void EnforceInferencePrecision() const;
     void insertReorder(EdgePtr& edge, bool isOptimized, std::unordered_set<std::string>& uniqueLayerNames);
     void insertConvert(EdgePtr& edge);
@@ -371,9 +403,13 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    std::vector<ParallelSection> m_parallelSections;
+    std::unordered_map<const Node*, size_t> m_scratchPadSlots;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+    // streams of the parallel section slots starting from 1, slot 0 uses m_stream
+    std::vector<dnnl::stream> m_slotStreams;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
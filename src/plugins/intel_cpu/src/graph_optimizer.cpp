@@ -41,6 +41,7 @@
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/input.h"
@@ -51,6 +52,9 @@
 #include "nodes/reshape.h"
 #include "nodes/rnn.h"
 #include "nodes/scaled_attn.h"
+#include "nodes/softmax.h"
+#include "nodes/string_tensor_unpack.h"
+#include "nodes/topk.h"
 #include "nodes/transpose.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -98,6 +102,11 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    // Must precede the Eltwise and Convert fusings, which would merge the decompression operations otherwise
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDecompression");
+    FuseEmbeddingBagAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
 // The order of applying scales and shifts is different for ARM to get specific postops order:
 // postops order on ARM: bias, scale, fq
 // postops order on x86: scale, bias, fq
@@ -206,6 +215,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseGatherAndConvert(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseTopKAndSoftmax");
+    FuseTopKAndSoftmax(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -238,6 +251,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     DropRedundantMemoryOutput(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseStringTensorPackAndUnpack");
+    FuseStringTensorPackAndUnpack(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "RemoveDroppedEdges");
     graph.RemoveDroppedEdges();
 }
@@ -1114,6 +1131,117 @@ void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDecompression(Graph& graph) {
+    // The EmbeddingBag nodes read the rows they reduce from a compressed table directly, so the decompressed table is
+    // neither computed nor kept in memory. Supported patterns:
+    //   f16/bf16 table -> Convert -> EmbeddingBag
+    //   u8/i8/u4/i4 table -> Convert -> [Subtract(zero points)] -> Multiply(scales) -> EmbeddingBag
+    // where the zero points and the scales are given per row of the table or for the whole table
+    const auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant();
+    };
+
+    auto isSuitableEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // Reads the second input of the eltwise as a value per table row or as a single value
+    auto getRowValues = [&](const NodePtr& eltwise, const VectorDims& tableDims, std::vector<float>& values) {
+        const auto constant = eltwise->getParentEdgeAt(1)->getParent();
+        const auto& shape = eltwise->getInputShapeAtPort(1);
+        if (!isConstantInput(constant) || !shape.isStatic()) {
+            return false;
+        }
+        const auto& dims = shape.getStaticDims();
+        const bool perTensor = shape.getElementsCount() == 1;
+        const bool perRow = dims.size() == tableDims.size() && dims[0] == tableDims[0] &&
+                            std::all_of(dims.begin() + 1, dims.end(), [](size_t dim) {
+                                return dim == 1;
+                            });
+        if (!perTensor && !perRow) {
+            return false;
+        }
+        auto memory = std::static_pointer_cast<node::Input>(constant)->getMemoryPtr();
+        values.resize(perTensor ? 1 : tableDims[0]);
+        cpu_convert(memory->getData(),
+                    values.data(),
+                    memory->getDesc().getPrecision(),
+                    ov::element::f32,
+                    values.size());
+        return true;
+    };
+
+    for (const auto& node : graphNodes) {
+        if (none_of(node->getType(),
+                    Type::EmbeddingBagOffsets,
+                    Type::EmbeddingBagOffsetsSum,
+                    Type::EmbeddingBagPacked,
+                    Type::EmbeddingBagPackedSum,
+                    Type::EmbeddingSegmentsSum)) {
+            continue;
+        }
+        auto* embeddingBag = dynamic_cast<node::EmbeddingBag*>(node.get());
+        if (!embeddingBag || embeddingBag->withDecompression()) {
+            continue;
+        }
+
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        NodePtr multiply = nullptr;
+        NodePtr subtract = nullptr;
+        if (isSuitableEltwise(parent, Algorithm::EltwiseMultiply)) {
+            multiply = parent;
+            parent = multiply->getParentEdgeAt(0)->getParent();
+            if (isSuitableEltwise(parent, Algorithm::EltwiseSubtract)) {
+                subtract = parent;
+                parent = subtract->getParentEdgeAt(0)->getParent();
+            }
+        }
+
+        const auto& convert = parent;
+        if (convert->getType() != Type::Convert || !convert->isConstant() || convert->getChildEdges().size() != 1 ||
+            convert->getOriginalOutputPrecisionAtPort(0) != ov::element::f32) {
+            continue;
+        }
+        const auto table = convert->getParentEdgeAt(0)->getParent();
+        const auto tablePrecision = convert->getOriginalInputPrecisionAtPort(0);
+        if (!isConstantInput(table) || !table->getOutputShapeAtPort(0).isStatic()) {
+            continue;
+        }
+        const bool isQuantized =
+            any_of(tablePrecision, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4);
+        if (multiply ? !isQuantized : none_of(tablePrecision, ov::element::f16, ov::element::bf16)) {
+            continue;
+        }
+
+        const auto& tableDims = table->getOutputShapeAtPort(0).getStaticDims();
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+        if (multiply && !getRowValues(multiply, tableDims, scales)) {
+            continue;
+        }
+        if (subtract && !getRowValues(subtract, tableDims, zeroPoints)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndDecompression);
+
+        if (multiply) {
+            embeddingBag->fuseDecompression(std::move(scales), std::move(zeroPoints));
+            graph.RemoveEdge(multiply->getParentEdgeAt(1));
+            graph.DropNode(multiply);
+        }
+        if (subtract) {
+            graph.RemoveEdge(subtract->getParentEdgeAt(1));
+            graph.DropNode(subtract);
+        }
+        node->setOriginalInputPrecisionAtPort(0, tablePrecision);
+        graph.DropNode(convert);
+    }
+}
+
 void GraphOptimizer::FuseFullyConnectedAndSimpleOperation(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
 
@@ -1883,6 +2011,78 @@ void GraphOptimizer::FuseMVNAndSimpleOperation(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseTopKAndSoftmax(Graph& graph) {
+    // The sampling over the logits takes the softmax of the top k values, optionally scaled by the temperature:
+    //   TopK -> [Multiply/Divide(scalar constant)] -> Softmax
+    // The softmax is computed by the TopK over the values it has just written
+    const auto& graphNodes = graph.GetNodes();
+
+    auto getScale = [](const NodePtr& node, const NodePtr& topK, float& scale) {
+        if (node->getType() != Type::Eltwise ||
+            none_of(node->getAlgorithm(), Algorithm::EltwiseMultiply, Algorithm::EltwiseDivide) ||
+            node->getParentEdges().size() != 2 || node->getChildEdges().size() != 1 || !node->getFusedWith().empty() ||
+            node->getParentEdgeAt(0)->getParent() != topK) {
+            return false;
+        }
+        const auto constant = node->getParentEdgeAt(1)->getParent();
+        const auto& shape = node->getInputShapeAtPort(1);
+        if (constant->getType() != Type::Input || !constant->isConstant() || !shape.isStatic() ||
+            shape.getElementsCount() != 1) {
+            return false;
+        }
+        auto memory = std::static_pointer_cast<node::Input>(constant)->getMemoryPtr();
+        float value = 0.F;
+        cpu_convert(memory->getData(), &value, memory->getDesc().getPrecision(), ov::element::f32, 1);
+        if (node->getAlgorithm() == Algorithm::EltwiseDivide) {
+            if (value == 0.F) {
+                return false;
+            }
+            value = 1.F / value;
+        }
+        scale = value;
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        if (node->getType() != Type::TopK) {
+            continue;
+        }
+        auto* topK = dynamic_cast<node::TopK*>(node.get());
+        const auto valuesEdges = node->getChildEdgesAtPort(0);
+        if (!topK || topK->withSoftmax() || valuesEdges.size() != 1 ||
+            node->getOriginalOutputPrecisionAtPort(0) != ov::element::f32) {
+            continue;
+        }
+        const auto rank = node->getOutputShapeAtPort(0).getRank();
+        if (topK->getAxis() != static_cast<int>(rank - 1)) {
+            continue;
+        }
+
+        auto child = valuesEdges[0]->getChild();
+        NodePtr scaleNode = nullptr;
+        float scale = 1.F;
+        if (getScale(child, node, scale)) {
+            scaleNode = child;
+            child = scaleNode->getChildEdgeAt(0)->getChild();
+        }
+        const auto* softmax = dynamic_cast<node::SoftMax*>(child.get());
+        if (!softmax || child->getParentEdges().size() != 1 || softmax->getAxis() != rank - 1 ||
+            child->getOriginalOutputPrecisionAtPort(0) != ov::element::f32) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseTopKAndSoftmax);
+
+        topK->fuseSoftmax(scale);
+        if (scaleNode) {
+            graph.RemoveEdge(scaleNode->getParentEdgeAt(1));
+            graph.DropNode(scaleNode);
+        }
+        graph.DropNode(child);
+    }
+}
+
 void GraphOptimizer::FuseGatherAndConvert(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
 
@@ -3280,6 +3480,85 @@ void GraphOptimizer::MatchSdpaKvCache(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseStringTensorPackAndUnpack(Graph& graph) {
+    // Strings are materialized as separate heap objects, so they are avoided where the packed representation
+    // (begins, ends and contiguous symbols) is enough:
+    //   StringTensorPack(StringTensorUnpack(data)) is data itself
+    //   StringTensorUnpack(StringTensorPack(begins, ends, symbols)) compacts the symbols without building the strings
+    const auto& graphNodes = graph.GetNodes();
+
+    auto isUnpackedInput = [](const NodePtr& pack, const NodePtr& unpack) {
+        if (unpack->getType() != Type::StringTensorUnpack || unpack->getChildEdges().size() != 3) {
+            return false;
+        }
+        const auto* unpackNode = dynamic_cast<node::StringTensorUnpack*>(unpack.get());
+        if (!unpackNode || unpackNode->withPackedInput()) {
+            return false;
+        }
+        for (size_t port = 0; port < 3; port++) {
+            const auto edge = pack->getParentEdgeAt(port);
+            if (edge->getParent() != unpack || edge->getInputNum() != static_cast<int>(port)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto pack = graphNodes[i];
+        if (pack->getType() != Type::StringTensorPack) {
+            continue;
+        }
+        const auto unpack = pack->getParentEdgeAt(0)->getParent();
+        if (!isUnpackedInput(pack, unpack)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseStringTensorPackAndUnpack_PackOfUnpack);
+
+        const auto dataEdge = unpack->getParentEdgeAt(0);
+        const auto data = dataEdge->getParent();
+        const auto inNum = dataEdge->getInputNum();
+        for (const auto& childEdge : pack->getChildEdgesAtPort(0)) {
+            const auto child = childEdge->getChild();
+            const auto outNum = childEdge->getOutputNum();
+            graph.RemoveEdge(childEdge);
+            graph.CreateEdge(data, child, inNum, outNum);
+        }
+        graph.DropNode(pack);
+        graph.DropNode(unpack);
+    }
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto unpack = graphNodes[i];
+        if (unpack->getType() != Type::StringTensorUnpack || unpack->isDropped()) {
+            continue;
+        }
+        auto* unpackNode = dynamic_cast<node::StringTensorUnpack*>(unpack.get());
+        const auto packEdge = unpack->getParentEdgeAt(0);
+        const auto pack = packEdge->getParent();
+        if (!unpackNode || unpackNode->withPackedInput() || pack->getType() != Type::StringTensorPack ||
+            pack->getChildEdges().size() != 1) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseStringTensorPackAndUnpack_UnpackOfPack);
+
+        const auto indicesPrecision = pack->getOriginalInputPrecisionAtPort(0);
+        graph.RemoveEdge(packEdge);
+        for (size_t port = 0; port < 3; port++) {
+            const auto edge = pack->getParentEdgeAt(port);
+            graph.CreateEdge(edge->getParent(), unpack, edge->getInputNum(), static_cast<int>(port));
+        }
+        unpack->inputShapes = pack->inputShapes;
+        unpack->setOriginalInputPrecisionAtPort(0, indicesPrecision);
+        unpack->addOriginalInputPrecision(indicesPrecision);
+        unpack->addOriginalInputPrecision(ov::element::u8);
+        unpackNode->fusePackedInput(indicesPrecision);
+        graph.DropNode(pack);
+    }
+}
+
 void GraphOptimizer::DropRedundantMemoryOutput(Graph& graph) {
     // When we have a MemoryInput->MemoryOutput pair, that means that the state is immediately populated with the init
     // subgraph values when the init subgraph exists. In all the other cases the state is simply a read only object.
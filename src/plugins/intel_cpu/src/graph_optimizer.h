@@ -40,9 +40,11 @@ private:
     static void FuseNormalizeL2AndSimpleOperation(Graph& graph);
     static void FuseReduceAndSimpleOperation(Graph& graph);
     static void FuseGatherAndConvert(Graph& graph);
+    static void FuseTopKAndSoftmax(Graph& graph);
 
     static void DropDoubleReorders(Graph& graph);
     static void FuseConvolutionAndZeroPoints(Graph& graph);
+    static void FuseEmbeddingBagAndDecompression(Graph& graph);
     void FuseBroadcastAndEltwise(Graph& graph);
     static void FuseEltwiseAndSimple(Graph& graph);
     static void FusePerformedAsScaleShiftAndFakeQuantize(Graph& graph);
@@ -55,6 +57,7 @@ private:
     static void RemoveConvertMemoryOutput(Graph& graph);
     static void MatchSdpaKvCache(Graph& graph);
     static void DropRedundantMemoryOutput(Graph& graph);
+    static void FuseStringTensorPackAndUnpack(Graph& graph);
 
     static bool canBeInplaced(const NodePtr& parentNode, const NodePtr& childNode);
     // Method checks that after the sequential execution of Transpose and Reorder nodes,
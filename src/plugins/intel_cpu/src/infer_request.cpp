@@ -4,12 +4,16 @@
 
 #include "infer_request.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -77,6 +81,19 @@ void SyncInferRequest::create_infer_request() {
 
     // create states according to the list of the MemoryStateNodes
     m_memory_states = m_compiled_model.graph().memoryStates();
+
+    for (const auto& [index, port] : m_input_ports_map) {
+        const auto& names = port.get_names();
+        if (names.count("input_ids") || names.count("inputs_embeds")) {
+            m_prefill_inputs.tokens = index;
+        } else if (names.count("attention_mask")) {
+            m_prefill_inputs.attention_mask = index;
+        } else if (names.count("position_ids")) {
+            m_prefill_inputs.position_ids = index;
+        } else if (names.count("beam_idx")) {
+            m_prefill_inputs.beam_idx = index;
+        }
+    }
 }
 
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
@@ -104,12 +121,23 @@ void SyncInferRequest::infer() {
     OV_ITT_SCOPED_TASK_BASE(itt::domains::ov_cpu_inference, m_profiling_task);
     auto graphLock = m_compiled_model.lock();
     auto&& graph = graphLock._graph;
-    auto message = ov::threading::message_manager();
 
     throw_if_canceled();
+    if (!m_untouched_tensors.empty()) {
+        first_touch_tensors();
+    }
+    const std::size_t chunk_size = graph.getConfig().prefillChunkSize;
+    if (use_chunked_prefill(chunk_size)) {
+        infer_chunked_prefill(graph, chunk_size);
+    } else {
+        infer_graph(graph);
+    }
+}
+
+void SyncInferRequest::infer_graph(Graph& graph) {
     if (m_asyncRequest->m_has_sub_infers) {
         sub_streams_infer();
-        message->server_wait();
+        ov::threading::message_manager()->server_wait();
         return;
     }
 
@@ -148,6 +176,173 @@ void SyncInferRequest::infer() {
     graph.PullOutputData(m_outputs);
 }
 
+namespace {
+// Copies [begin, end) range of the tensor along the axis to a new dense tensor
+ov::SoPtr<ov::ITensor> copy_slice(const ov::SoPtr<ov::ITensor>& tensor, size_t axis, size_t begin, size_t end) {
+    const auto& shape = tensor->get_shape();
+    ov::Coordinate roi_begin(shape.size(), 0);
+    ov::Coordinate roi_end(shape);
+    roi_begin[axis] = begin;
+    roi_end[axis] = end;
+    auto roi = ov::make_tensor(tensor._ptr, roi_begin, roi_end);
+    auto slice = ov::make_tensor(tensor->get_element_type(), roi->get_shape());
+    roi->copy_to(slice);
+    return slice;
+}
+
+// View of [begin, end) range of the tensor along the axis 1
+ov::SoPtr<ov::ITensor> slice_view(const ov::SoPtr<ov::ITensor>& tensor, size_t begin, size_t end) {
+    const auto& shape = tensor->get_shape();
+    ov::Coordinate roi_begin(shape.size(), 0);
+    ov::Coordinate roi_end(shape);
+    roi_begin[1] = begin;
+    roi_end[1] = end;
+    return ov::make_tensor(tensor._ptr, roi_begin, roi_end);
+}
+
+// Dense tensor on the memory of [begin, end) range of the tensor along the axis 1, the dimension 0 must be 1
+ov::SoPtr<ov::ITensor> dense_slice_view(const ov::SoPtr<ov::ITensor>& tensor, size_t begin, size_t end) {
+    auto shape = tensor->get_shape();
+    const size_t token_bytes = tensor->get_byte_size() / shape[1];
+    shape[1] = end - begin;
+    return ov::make_tensor(tensor->get_element_type(),
+                           shape,
+                           static_cast<uint8_t*>(tensor->data()) + begin * token_bytes);
+}
+
+ov::SoPtr<ov::ITensor> make_identity_beam_idx(const ov::element::Type& type, size_t batch) {
+    auto beam_idx = ov::make_tensor(type, ov::Shape{batch});
+    for (size_t i = 0; i < batch; i++) {
+        if (type == ov::element::i64) {
+            beam_idx->data<int64_t>()[i] = static_cast<int64_t>(i);
+        } else {
+            beam_idx->data<int32_t>()[i] = static_cast<int32_t>(i);
+        }
+    }
+    return beam_idx;
+}
+}  // namespace
+
+bool SyncInferRequest::use_chunked_prefill(std::size_t chunk_size) const {
+    if (chunk_size == 0 || m_memory_states.empty() || !m_prefill_inputs.tokens) {
+        return false;
+    }
+    const auto tokens = get_tensor(m_input_ports_map.at(*m_prefill_inputs.tokens));
+    const auto& shape = tokens->get_shape();
+    if (shape.size() < 2 || shape[1] <= chunk_size) {
+        return false;
+    }
+    if (m_prefill_inputs.beam_idx) {
+        const auto type = m_input_ports_map.at(*m_prefill_inputs.beam_idx).get_element_type();
+        if (none_of(type, ov::element::i32, ov::element::i64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SyncInferRequest::infer_chunked_prefill(Graph& graph, std::size_t chunk_size) {
+    struct ChunkedInput {
+        ov::Output<const ov::Node> port;
+        ov::SoPtr<ov::ITensor> tensor;
+    };
+    auto get_input = [&](const std::optional<std::size_t>& index) -> std::optional<ChunkedInput> {
+        if (!index) {
+            return std::nullopt;
+        }
+        const auto& port = m_input_ports_map.at(*index);
+        return ChunkedInput{port, get_tensor(port)};
+    };
+    const auto tokens = *get_input(m_prefill_inputs.tokens);
+    const auto attention_mask = get_input(m_prefill_inputs.attention_mask);
+    const auto position_ids = get_input(m_prefill_inputs.position_ids);
+    const auto beam_idx = get_input(m_prefill_inputs.beam_idx);
+
+    const size_t seq_len = tokens.tensor->get_shape()[1];
+    // the attention mask covers the tokens already stored in the state and the prompt
+    const size_t past_len = attention_mask ? attention_mask->tensor->get_shape()[1] - seq_len : 0;
+
+    // The outputs which follow the sequence of the tokens are written to their slices of the output tensor, the
+    // others (e.g. logits of the last token only) are overwritten by every chunk and keep the ones of the last chunk
+    struct SequenceOutput {
+        ov::Output<const ov::Node> port;
+        ov::SoPtr<ov::ITensor> result;
+        // the chunks are written here and copied to the result when its slices are not dense
+        ov::SoPtr<ov::ITensor> chunk;
+    };
+    const auto& sequence_output_indices = graph.getConfig().prefillSequenceOutputs;
+    std::vector<SequenceOutput> sequence_outputs;
+    for (const auto& [index, port] : m_output_ports_map) {
+        if (port.get_partial_shape().is_dynamic() &&
+            std::find(sequence_output_indices.begin(), sequence_output_indices.end(), index) !=
+                sequence_output_indices.end()) {
+            sequence_outputs.push_back({port, get_tensor(port), {}});
+        }
+    }
+
+    auto restore_tensors = [&] {
+        for (const auto& input : {std::optional<ChunkedInput>(tokens), attention_mask, position_ids, beam_idx}) {
+            if (input) {
+                set_tensor(input->port, input->tensor);
+            }
+        }
+        for (const auto& output : sequence_outputs) {
+            set_tensor(output.port, output.result);
+        }
+    };
+
+    try {
+        for (size_t begin = 0; begin < seq_len; begin += chunk_size) {
+            const size_t end = std::min(seq_len, begin + chunk_size);
+            set_tensor(tokens.port, copy_slice(tokens.tensor, 1, begin, end));
+            if (attention_mask) {
+                set_tensor(attention_mask->port, copy_slice(attention_mask->tensor, 1, 0, past_len + end));
+            }
+            if (position_ids) {
+                const auto axis = position_ids->tensor->get_shape().size() - 1;
+                set_tensor(position_ids->port, copy_slice(position_ids->tensor, axis, begin, end));
+            }
+            if (beam_idx && begin != 0) {
+                // the state is already reordered by the first chunk
+                set_tensor(beam_idx->port,
+                           make_identity_beam_idx(beam_idx->port.get_element_type(), beam_idx->tensor->get_size()));
+            }
+            for (const auto& output : sequence_outputs) {
+                if (begin != 0) {
+                    set_tensor(output.port, output.chunk ? output.chunk : dense_slice_view(output.result, begin, end));
+                }
+            }
+
+            infer_graph(graph);
+            throw_if_canceled();
+
+            for (auto& output : sequence_outputs) {
+                if (begin == 0) {
+                    // the shape of the whole output is known after the first chunk only
+                    const auto first = get_tensor(output.port);
+                    auto shape = first->get_shape();
+                    OPENVINO_ASSERT(shape.size() >= 2 && shape[1] == end,
+                                    "Output of the chunked prefill doesn't follow the sequence of the tokens");
+                    auto chunk = ov::make_tensor(first->get_element_type(), shape);
+                    first->copy_to(chunk._ptr);
+                    shape[1] = seq_len;
+                    output.result->set_shape(shape);
+                    chunk->copy_to(slice_view(output.result, 0, end)._ptr);
+                    if (shape[0] != 1) {
+                        output.chunk = chunk;
+                    }
+                } else if (output.chunk) {
+                    output.chunk->copy_to(slice_view(output.result, begin, end)._ptr);
+                }
+            }
+        }
+    } catch (...) {
+        restore_tensors();
+        throw;
+    }
+    restore_tensors();
+}
+
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
     auto&& graph = m_compiled_model.graph();
     OPENVINO_ASSERT(graph.IsReady(), "Graph is not ready!");
@@ -337,14 +532,66 @@ void SyncInferRequest::throw_if_canceled() const {
     }
 }
 
+void SyncInferRequest::yield_to_higher_priority() const {
+    if (m_asyncRequest != nullptr) {
+        m_asyncRequest->yield_to_higher_priority();
+    }
+}
+
+void SyncInferRequest::enable_first_touch() {
+    for (const auto& input : m_input_external_ptr) {
+        m_untouched_tensors.push_back(input.second);
+    }
+    for (const auto& output : m_output_external_ptr) {
+        m_untouched_tensors.push_back(output.second);
+    }
+}
+
+void SyncInferRequest::first_touch_tensors() {
+    auto is_bound = [](const std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>>& tensors,
+                       const ov::SoPtr<ov::ITensor>& tensor) {
+        return std::any_of(tensors.begin(), tensors.end(), [&](const auto& item) {
+            return item.second._ptr == tensor._ptr;
+        });
+    };
+    // the tensors replaced by the user are not used by the graph anymore
+    for (const auto& tensor : m_untouched_tensors) {
+        if (tensor && tensor->get_element_type() != element::string && tensor->get_byte_size() != 0 &&
+            (is_bound(m_input_external_ptr, tensor) || is_bound(m_output_external_ptr, tensor))) {
+            std::memset(tensor->data(), 0, tensor->get_byte_size());
+        }
+    }
+    m_untouched_tensors.clear();
+}
+
+void SyncInferRequest::keep_user_data(const std::vector<ov::SoPtr<ov::ITensor>>& tensors) const {
+    for (const auto& tensor : tensors) {
+        m_untouched_tensors.erase(std::remove_if(m_untouched_tensors.begin(),
+                                                 m_untouched_tensors.end(),
+                                                 [&](const ov::SoPtr<ov::ITensor>& untouched) {
+                                                     return untouched._ptr == tensor._ptr;
+                                                 }),
+                                  m_untouched_tensors.end());
+    }
+}
+
 ov::SoPtr<ov::ITensor> SyncInferRequest::get_tensor(const ov::Output<const ov::Node>& in_port) const {
     auto port = get_internal_port(in_port);
-    return ov::ISyncInferRequest::get_tensor(port);
+    auto tensor = ov::ISyncInferRequest::get_tensor(port);
+    // the user may write the input before the first inference
+    if (!m_untouched_tensors.empty() && find_port(in_port).is_input()) {
+        keep_user_data({tensor});
+    }
+    return tensor;
 }
 
 std::vector<ov::SoPtr<ov::ITensor>> SyncInferRequest::get_tensors(const ov::Output<const ov::Node>& in_port) const {
     auto port = get_internal_port(in_port);
-    return ov::ISyncInferRequest::get_tensors(port);
+    auto tensors = ov::ISyncInferRequest::get_tensors(port);
+    if (!m_untouched_tensors.empty() && find_port(in_port).is_input()) {
+        keep_user_data(tensors);
+    }
+    return tensors;
 }
 
 const ov::Output<const ov::Node>& SyncInferRequest::get_internal_port(const ov::Output<const ov::Node>& port) const {
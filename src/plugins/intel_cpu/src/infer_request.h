@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -63,6 +64,18 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Preemption point between the graph nodes: lets the queued requests of the models of a higher priority run
+     * on the current stream if `m_asyncRequest` is initialized and shares the executor with them
+     */
+    void yield_to_higher_priority() const;
+
+    /**
+     * @brief Defers the first touch of the input and output tensors allocated by the request to its first inference,
+     * so the OS places their memory pages on the NUMA node of the stream running it
+     */
+    void enable_first_touch();
+
 private:
     class OutputControlBlock {
     public:
@@ -119,10 +132,30 @@ private:
 
     void sub_streams_infer();
 
+    // Inputs of a stateful LLM which are split into chunks by the chunked prefill, identified by the tensor names
+    struct PrefillInputs {
+        std::optional<std::size_t> tokens;  // input_ids or inputs_embeds
+        std::optional<std::size_t> attention_mask;
+        std::optional<std::size_t> position_ids;
+        std::optional<std::size_t> beam_idx;
+    };
+
+    void first_touch_tensors();
+    // Excludes the input tensors from the first touch, since the user may have written them
+    void keep_user_data(const std::vector<ov::SoPtr<ov::ITensor>>& tensors) const;
+
+    void infer_graph(Graph& graph);
+    [[nodiscard]] bool use_chunked_prefill(std::size_t chunk_size) const;
+    void infer_chunked_prefill(Graph& graph, std::size_t chunk_size);
+
+    PrefillInputs m_prefill_inputs;
+
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
+    // tensors allocated by the request which are not touched yet, the inputs are removed once the user gets them
+    mutable std::vector<ov::SoPtr<ov::ITensor>> m_untouched_tensors;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
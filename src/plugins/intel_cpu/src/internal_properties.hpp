@@ -80,4 +80,62 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Define whether the plugin retains transformed models to speed up re-compilation of reshaped models.
+ * The transformation pipeline is run once per model and compile properties for the model with dynamic input
+ * dimensions, the compilations with any static input shapes reshape the result and only propagate the shapes and
+ * build the graph. The cache is bounded by the number of the models and by the size of their constants.
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_reshape_compile_cache{
+    "CPU_ENABLE_RESHAPE_COMPILE_CACHE"};
+
+/**
+ * @brief Number of the compilations which reused a transformed model retained with enable_reshape_compile_cache.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> reshape_compile_cache_hits{
+    "CPU_RESHAPE_COMPILE_CACHE_HITS"};
+
+/**
+ * @brief Define whether independent branches of a static graph are executed in parallel.
+ * Nodes of parallel branches are scheduled by data dependencies and share the threads of the stream.
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_inter_op_parallelism{
+    "CPU_ENABLE_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Define whether each infer request is pinned to a preferred stream.
+ * Input and output tensors of the request are first touched on the stream, another stream runs the request only when
+ * the preferred one is busy.
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_stream_affinity{"CPU_ENABLE_STREAM_AFFINITY"};
+
+/**
+ * @brief Defines the maximal number of prompt tokens processed by one inference of a stateful LLM.
+ * Longer prompts are split into chunks executed one by one, each chunk appends its keys and values to the model
+ * state. Bounds the activation memory of the prefill. 0 disables chunking, 1 is not allowed.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> prefill_chunk_size{"CPU_PREFILL_CHUNK_SIZE"};
+
+/**
+ * @brief Define whether the model shares the streams executor with the other models compiled with the same streams
+ * configuration. Requests of the models sharing the executor are scheduled by ov::hint::model_priority and
+ * a request of a higher priority preempts a running one between the graph nodes.
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> shared_task_executor{"CPU_SHARED_TASK_EXECUTOR"};
+
+/**
+ * @brief Defines the latency budget of an infer request in milliseconds. The request is started by the deadline equal
+ * to its submission time plus the budget, queued requests of the same priority are started earliest deadline first.
+ * 0 means no budget, i.e. the requests are started in the submission order.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> latency_budget_ms{"CPU_LATENCY_BUDGET_MS"};
+
 }  // namespace ov::intel_cpu
@@ -0,0 +1,506 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_plan.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Largest prime factor computed by a generic butterfly, a size with a larger one uses Bluestein's algorithm
+constexpr size_t MAX_GENERIC_RADIX = 13;
+
+std::vector<size_t> factorize(size_t size) {
+    std::vector<size_t> radices;
+    while (size % 4 == 0) {
+        radices.push_back(4);
+        size /= 4;
+    }
+    for (size_t radix : {2, 3, 5}) {
+        while (size % radix == 0) {
+            radices.push_back(radix);
+            size /= radix;
+        }
+    }
+    for (size_t radix = 7; radix <= MAX_GENERIC_RADIX && size > 1; radix += 2) {
+        while (size % radix == 0) {
+            radices.push_back(radix);
+            size /= radix;
+        }
+    }
+    if (size > 1) {
+        return {};
+    }
+    return radices;
+}
+
+template <bool Inverse>
+void butterfly2(float* re, float* im) {
+    const float r = re[0] - re[1];
+    const float i = im[0] - im[1];
+    re[0] += re[1];
+    im[0] += im[1];
+    re[1] = r;
+    im[1] = i;
+}
+
+template <bool Inverse>
+void butterfly4(float* re, float* im) {
+    const float t0r = re[0] + re[2];
+    const float t0i = im[0] + im[2];
+    const float t1r = re[0] - re[2];
+    const float t1i = im[0] - im[2];
+    const float t2r = re[1] + re[3];
+    const float t2i = im[1] + im[3];
+    // -i * (a1 - a3) for the forward transform, i * (a1 - a3) for the inverse one
+    const float t3r = Inverse ? im[3] - im[1] : im[1] - im[3];
+    const float t3i = Inverse ? re[1] - re[3] : re[3] - re[1];
+    re[0] = t0r + t2r;
+    im[0] = t0i + t2i;
+    re[2] = t0r - t2r;
+    im[2] = t0i - t2i;
+    re[1] = t1r + t3r;
+    im[1] = t1i + t3i;
+    re[3] = t1r - t3r;
+    im[3] = t1i - t3i;
+}
+
+template <bool Inverse>
+void butterfly3(float* re, float* im) {
+    constexpr float sin60 = 0.866025403784438647F;
+    const float t1r = re[1] + re[2];
+    const float t1i = im[1] + im[2];
+    const float mr = re[0] - 0.5F * t1r;
+    const float mi = im[0] - 0.5F * t1i;
+    // -i * sin(2 * pi / 3) * (a1 - a2) for the forward transform
+    const float sr = (Inverse ? -sin60 : sin60) * (im[1] - im[2]);
+    const float si = (Inverse ? sin60 : -sin60) * (re[1] - re[2]);
+    re[0] += t1r;
+    im[0] += t1i;
+    re[1] = mr + sr;
+    im[1] = mi + si;
+    re[2] = mr - sr;
+    im[2] = mi - si;
+}
+
+template <bool Inverse>
+void butterfly5(float* re, float* im) {
+    constexpr float c1 = 0.309016994374947424F;   // cos(2 * pi / 5)
+    constexpr float c2 = -0.809016994374947424F;  // cos(4 * pi / 5)
+    constexpr float s1 = Inverse ? -0.951056516295153572F : 0.951056516295153572F;
+    constexpr float s2 = Inverse ? -0.587785252292473129F : 0.587785252292473129F;
+    const float t1r = re[1] + re[4];
+    const float t1i = im[1] + im[4];
+    const float t2r = re[2] + re[3];
+    const float t2i = im[2] + im[3];
+    const float t3r = re[1] - re[4];
+    const float t3i = im[1] - im[4];
+    const float t4r = re[2] - re[3];
+    const float t4i = im[2] - im[3];
+    const float m1r = re[0] + c1 * t1r + c2 * t2r;
+    const float m1i = im[0] + c1 * t1i + c2 * t2i;
+    const float m2r = re[0] + c2 * t1r + c1 * t2r;
+    const float m2i = im[0] + c2 * t1i + c1 * t2i;
+    // -i * (s1 * t3 + s2 * t4) and -i * (s2 * t3 - s1 * t4)
+    const float n1r = s1 * t3i + s2 * t4i;
+    const float n1i = -(s1 * t3r + s2 * t4r);
+    const float n2r = s2 * t3i - s1 * t4i;
+    const float n2i = -(s2 * t3r - s1 * t4r);
+    re[0] += t1r + t2r;
+    im[0] += t1i + t2i;
+    re[1] = m1r + n1r;
+    im[1] = m1i + n1i;
+    re[4] = m1r - n1r;
+    im[4] = m1i - n1i;
+    re[2] = m2r + n2r;
+    im[2] = m2i + n2i;
+    re[3] = m2r - n2r;
+    im[3] = m2i - n2i;
+}
+
+// One Stockham pass: the radix point DFTs of the elements with the step length / radix are multiplied by the
+// twiddles and stored next to each other. The stride is the number of the interleaved independent sequences
+template <size_t Radix, bool Inverse, typename Butterfly>
+void stockhamPass(const float* src,
+                  float* dst,
+                  const float* twiddles,
+                  size_t radix,
+                  size_t length,
+                  size_t stride,
+                  const Butterfly& butterfly) {
+    const size_t m = length / radix;
+    float re[Radix];
+    float im[Radix];
+    for (size_t q = 0; q < m; q++) {
+        const float* w = twiddles + 2 * q * (radix - 1);
+        for (size_t s = 0; s < stride; s++) {
+            for (size_t k = 0; k < radix; k++) {
+                const size_t idx = stride * (q + m * k) + s;
+                re[k] = src[2 * idx];
+                im[k] = src[2 * idx + 1];
+            }
+            butterfly(re, im);
+            const size_t out = stride * radix * q + s;
+            dst[2 * out] = re[0];
+            dst[2 * out + 1] = im[0];
+            for (size_t j = 1; j < radix; j++) {
+                const float wr = w[2 * (j - 1)];
+                const float wi = Inverse ? -w[2 * (j - 1) + 1] : w[2 * (j - 1) + 1];
+                const size_t idx = out + stride * j;
+                dst[2 * idx] = re[j] * wr - im[j] * wi;
+                dst[2 * idx + 1] = re[j] * wi + im[j] * wr;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+FftPlan::FftPlan(size_t size) : m_size(size) {
+    const auto radices = factorize(size);
+    if (size > 1 && radices.empty()) {
+        // the convolution of the chirped signal with the chirp filter, both zero padded to a power of two
+        size_t convolutionSize = 1;
+        while (convolutionSize < 2 * size - 1) {
+            convolutionSize *= 2;
+        }
+        m_convolution = getFftPlan(convolutionSize);
+        m_chirp.resize(2 * size);
+        for (size_t n = 0; n < size; n++) {
+            // n^2 mod 2 * size keeps the angle exact for the large indices
+            const auto phase = static_cast<uint64_t>(n) * n % (2 * static_cast<uint64_t>(size));
+            const double angle = PI * static_cast<double>(phase) / static_cast<double>(size);
+            m_chirp[2 * n] = static_cast<float>(std::cos(angle));
+            m_chirp[2 * n + 1] = static_cast<float>(-std::sin(angle));
+        }
+        std::vector<float> filter(2 * convolutionSize, 0.F);
+        for (size_t n = 0; n < size; n++) {
+            filter[2 * n] = m_chirp[2 * n];
+            filter[2 * n + 1] = -m_chirp[2 * n + 1];
+            if (n != 0) {
+                filter[2 * (convolutionSize - n)] = m_chirp[2 * n];
+                filter[2 * (convolutionSize - n) + 1] = -m_chirp[2 * n + 1];
+            }
+        }
+        m_filterSpectrum.resize(2 * convolutionSize);
+        std::vector<float> scratch(m_convolution->scratchSize());
+        m_convolution->execute(filter.data(), m_filterSpectrum.data(), scratch.data(), false);
+        return;
+    }
+
+    size_t length = size;
+    size_t stride = 1;
+    for (size_t radix : radices) {
+        m_stages.push_back({radix, length, stride, m_twiddles.size(), m_roots.size()});
+        if (radix > 5) {
+            for (size_t k = 0; k < radix; k++) {
+                const double angle = 2 * PI * static_cast<double>(k) / static_cast<double>(radix);
+                m_roots.push_back(static_cast<float>(std::cos(angle)));
+                m_roots.push_back(static_cast<float>(-std::sin(angle)));
+            }
+        }
+        const size_t m = length / radix;
+        for (size_t q = 0; q < m; q++) {
+            for (size_t j = 1; j < radix; j++) {
+                const double angle = 2 * PI * static_cast<double>(j * q) / static_cast<double>(length);
+                m_twiddles.push_back(static_cast<float>(std::cos(angle)));
+                m_twiddles.push_back(static_cast<float>(-std::sin(angle)));
+            }
+        }
+        length = m;
+        stride *= radix;
+    }
+}
+
+size_t FftPlan::scratchSize() const {
+    if (m_convolution) {
+        return 4 * m_convolution->size() + m_convolution->scratchSize();
+    }
+    return 4 * m_size;
+}
+
+void FftPlan::execute(const float* src, float* dst, float* scratch, bool inverse) const {
+    if (m_convolution) {
+        inverse ? executeBluestein<true>(src, dst, scratch) : executeBluestein<false>(src, dst, scratch);
+    } else {
+        inverse ? executeStockham<true>(src, dst, scratch) : executeStockham<false>(src, dst, scratch);
+    }
+}
+
+template <bool Inverse>
+void FftPlan::runStage(const Stage& stage, const float* src, float* dst) const {
+    const float* twiddles = m_twiddles.data() + stage.twiddlesOffset;
+    switch (stage.radix) {
+    case 2:
+        stockhamPass<2, Inverse>(src, dst, twiddles, 2, stage.length, stage.stride, butterfly2<Inverse>);
+        break;
+    case 3:
+        stockhamPass<3, Inverse>(src, dst, twiddles, 3, stage.length, stage.stride, butterfly3<Inverse>);
+        break;
+    case 4:
+        stockhamPass<4, Inverse>(src, dst, twiddles, 4, stage.length, stage.stride, butterfly4<Inverse>);
+        break;
+    case 5:
+        stockhamPass<5, Inverse>(src, dst, twiddles, 5, stage.length, stage.stride, butterfly5<Inverse>);
+        break;
+    default: {
+        const size_t radix = stage.radix;
+        const float* roots = m_roots.data() + stage.rootsOffset;
+        auto butterfly = [radix, roots](float* re, float* im) {
+            float outRe[MAX_GENERIC_RADIX];
+            float outIm[MAX_GENERIC_RADIX];
+            for (size_t j = 0; j < radix; j++) {
+                float sumRe = 0.F;
+                float sumIm = 0.F;
+                for (size_t k = 0; k < radix; k++) {
+                    const size_t root = (j * k) % radix;
+                    const float rootRe = roots[2 * root];
+                    const float rootIm = Inverse ? -roots[2 * root + 1] : roots[2 * root + 1];
+                    sumRe += re[k] * rootRe - im[k] * rootIm;
+                    sumIm += re[k] * rootIm + im[k] * rootRe;
+                }
+                outRe[j] = sumRe;
+                outIm[j] = sumIm;
+            }
+            std::copy_n(outRe, radix, re);
+            std::copy_n(outIm, radix, im);
+        };
+        stockhamPass<MAX_GENERIC_RADIX, Inverse>(src, dst, twiddles, radix, stage.length, stage.stride, butterfly);
+        break;
+    }
+    }
+}
+
+template <bool Inverse>
+void FftPlan::executeStockham(const float* src, float* dst, float* scratch) const {
+    const size_t stages = m_stages.size();
+    if (stages == 0) {
+        std::copy_n(src, 2 * m_size, dst);
+        return;
+    }
+    // the buffers alternate so that the last stage writes dst
+    float* buffers[2] = {scratch, scratch + 2 * m_size};
+    if (stages == 1 && src == dst) {
+        std::copy_n(src, 2 * m_size, buffers[1]);
+        src = buffers[1];
+    }
+    const float* in = src;
+    for (size_t i = 0; i < stages; i++) {
+        float* out = i + 1 == stages ? dst : buffers[(stages - i) % 2];
+        runStage<Inverse>(m_stages[i], in, out);
+        in = out;
+    }
+}
+
+template <bool Inverse>
+void FftPlan::executeBluestein(const float* src, float* dst, float* scratch) const {
+    const size_t convolutionSize = m_convolution->size();
+    float* chirped = scratch;
+    float* spectrum = scratch + 2 * convolutionSize;
+    float* convolutionScratch = scratch + 4 * convolutionSize;
+
+    // the inverse transform is the conjugate of the forward transform of the conjugate signal
+    const float sign = Inverse ? -1.F : 1.F;
+    for (size_t n = 0; n < m_size; n++) {
+        const float re = src[2 * n];
+        const float im = sign * src[2 * n + 1];
+        chirped[2 * n] = re * m_chirp[2 * n] - im * m_chirp[2 * n + 1];
+        chirped[2 * n + 1] = re * m_chirp[2 * n + 1] + im * m_chirp[2 * n];
+    }
+    std::fill(chirped + 2 * m_size, chirped + 2 * convolutionSize, 0.F);
+
+    m_convolution->execute(chirped, spectrum, convolutionScratch, false);
+    for (size_t k = 0; k < convolutionSize; k++) {
+        const float re = spectrum[2 * k];
+        const float im = spectrum[2 * k + 1];
+        spectrum[2 * k] = re * m_filterSpectrum[2 * k] - im * m_filterSpectrum[2 * k + 1];
+        spectrum[2 * k + 1] = re * m_filterSpectrum[2 * k + 1] + im * m_filterSpectrum[2 * k];
+    }
+    m_convolution->execute(spectrum, chirped, convolutionScratch, true);
+
+    const float norm = 1.F / static_cast<float>(convolutionSize);
+    for (size_t k = 0; k < m_size; k++) {
+        const float re = chirped[2 * k] * norm;
+        const float im = chirped[2 * k + 1] * norm;
+        dst[2 * k] = re * m_chirp[2 * k] - im * m_chirp[2 * k + 1];
+        dst[2 * k + 1] = sign * (re * m_chirp[2 * k + 1] + im * m_chirp[2 * k]);
+    }
+}
+
+RealFftPlan::RealFftPlan(size_t size) : m_size(size) {
+    if (size % 2 == 0) {
+        const size_t half = size / 2;
+        m_complex = getFftPlan(half);
+        m_twiddles.resize(2 * half);
+        for (size_t k = 0; k < half; k++) {
+            const double angle = 2 * PI * static_cast<double>(k) / static_cast<double>(size);
+            m_twiddles[2 * k] = static_cast<float>(std::cos(angle));
+            m_twiddles[2 * k + 1] = static_cast<float>(-std::sin(angle));
+        }
+    } else {
+        m_complex = getFftPlan(size);
+    }
+}
+
+size_t RealFftPlan::scratchSize() const {
+    if (m_size % 2 == 0) {
+        return m_size + m_complex->scratchSize();
+    }
+    return 4 * m_size + m_complex->scratchSize();
+}
+
+void RealFftPlan::forward(const float* src, float* dst, float* scratch) const {
+    if (m_size % 2 != 0) {
+        float* signal = scratch;
+        float* spectrum = scratch + 2 * m_size;
+        for (size_t n = 0; n < m_size; n++) {
+            signal[2 * n] = src[n];
+            signal[2 * n + 1] = 0.F;
+        }
+        m_complex->execute(signal, spectrum, scratch + 4 * m_size, false);
+        std::copy_n(spectrum, 2 * (m_size / 2 + 1), dst);
+        return;
+    }
+
+    // the pairs of the samples form a complex signal of the half size, its spectrum z combines the spectra of the
+    // even and the odd samples: X[k] = E[k] + W^k * O[k]
+    const size_t half = m_size / 2;
+    float* z = scratch;
+    m_complex->execute(src, z, scratch + m_size, false);
+    for (size_t k = 0; k <= half; k++) {
+        const size_t kk = k == half ? 0 : k;
+        const size_t mirror = k == 0 ? 0 : half - k;
+        const float zr = z[2 * kk];
+        const float zi = z[2 * kk + 1];
+        const float cr = z[2 * mirror];
+        const float ci = -z[2 * mirror + 1];
+        // E = (z[k] + conj(z[-k])) / 2, O = -i * (z[k] - conj(z[-k])) / 2
+        const float er = 0.5F * (zr + cr);
+        const float ei = 0.5F * (zi + ci);
+        const float orr = 0.5F * (zi - ci);
+        const float oi = -0.5F * (zr - cr);
+        const float wr = k == half ? -1.F : m_twiddles[2 * k];
+        const float wi = k == half ? 0.F : m_twiddles[2 * k + 1];
+        dst[2 * k] = er + wr * orr - wi * oi;
+        dst[2 * k + 1] = ei + wr * oi + wi * orr;
+    }
+}
+
+void RealFftPlan::inverse(const float* src, float* dst, float* scratch) const {
+    if (m_size % 2 != 0) {
+        float* spectrum = scratch;
+        float* signal = scratch + 2 * m_size;
+        spectrum[0] = src[0];
+        spectrum[1] = 0.F;
+        for (size_t k = 1; k <= m_size / 2; k++) {
+            spectrum[2 * k] = src[2 * k];
+            spectrum[2 * k + 1] = src[2 * k + 1];
+            spectrum[2 * (m_size - k)] = src[2 * k];
+            spectrum[2 * (m_size - k) + 1] = -src[2 * k + 1];
+        }
+        m_complex->execute(spectrum, signal, scratch + 4 * m_size, true);
+        const float norm = 1.F / static_cast<float>(m_size);
+        for (size_t n = 0; n < m_size; n++) {
+            dst[n] = signal[2 * n] * norm;
+        }
+        return;
+    }
+
+    const size_t half = m_size / 2;
+    float* z = scratch;
+    for (size_t k = 0; k < half; k++) {
+        const float xr = src[2 * k];
+        const float xi = k == 0 ? 0.F : src[2 * k + 1];
+        const float cr = src[2 * (half - k)];
+        const float ci = k == 0 ? 0.F : -src[2 * (half - k) + 1];
+        // E = (X[k] + conj(X[h - k])) / 2, O = (X[k] - conj(X[h - k])) * conj(W^k) / 2, z = E + i * O
+        const float er = 0.5F * (xr + cr);
+        const float ei = 0.5F * (xi + ci);
+        const float dr = 0.5F * (xr - cr);
+        const float di = 0.5F * (xi - ci);
+        const float wr = m_twiddles[2 * k];
+        const float wi = -m_twiddles[2 * k + 1];
+        const float orr = dr * wr - di * wi;
+        const float oi = dr * wi + di * wr;
+        z[2 * k] = er - oi;
+        z[2 * k + 1] = ei + orr;
+    }
+    m_complex->execute(z, dst, scratch + m_size, true);
+    const float norm = 1.F / static_cast<float>(half);
+    for (size_t n = 0; n < m_size; n++) {
+        dst[n] *= norm;
+    }
+}
+
+namespace {
+
+struct PlanKey {
+    size_t size;
+
+    [[nodiscard]] size_t hash() const {
+        return std::hash<size_t>()(size);
+    }
+    bool operator==(const PlanKey& rhs) const {
+        return size == rhs.size;
+    }
+};
+
+// Plans of the least recently used sizes are evicted, the nodes executing them keep their own references
+constexpr size_t PLAN_CACHE_CAPACITY = 32;
+
+template <typename Plan>
+std::shared_ptr<const Plan> getCachedPlan(size_t size) {
+    static std::mutex mutex;
+    static LruCache<PlanKey, std::shared_ptr<const Plan>> plans(PLAN_CACHE_CAPACITY);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto plan = plans.get({size})) {
+            return plan;
+        }
+    }
+    // the plan is built without the lock, as it may request the plans of the other sizes
+    auto plan = std::make_shared<const Plan>(size);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto cached = plans.get({size})) {
+        return cached;
+    }
+    plans.put({size}, plan);
+    return plan;
+}
+
+}  // namespace
+
+FftWorkspace::FftWorkspace(size_t size)
+    : m_size(size),
+      m_buffers(size * static_cast<size_t>(parallel_get_max_threads())) {}
+
+float* FftWorkspace::local() {
+    // a thread outside of any arena, e.g. the caller of a serial loop, has no index and is the only user
+    const int thread = parallel_get_thread_num();
+    return m_buffers.data() + static_cast<size_t>(std::max(thread, 0)) * m_size;
+}
+
+std::shared_ptr<const FftPlan> getFftPlan(size_t size) {
+    return getCachedPlan<FftPlan>(size);
+}
+
+std::shared_ptr<const RealFftPlan> getRealFftPlan(size_t size) {
+    return getCachedPlan<RealFftPlan>(size);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+// Below this size the direct DFT kernels are as fast as a planned FFT
+constexpr size_t FFT_PLAN_MIN_SIZE = 16;
+
+// Complex FFT of a fixed size. The size is factorized into radix 4, 2, 3 and 5 stages and stages of the other small
+// primes, which are executed as Stockham passes with precomputed twiddles, so each pass reads and writes contiguous
+// data and no bit reversal is needed. A size with a prime factor above 13 is computed with Bluestein's algorithm as
+// a convolution of a power of two size. The complex values are interleaved (real, imaginary) floats
+class FftPlan {
+public:
+    explicit FftPlan(size_t size);
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    // Number of floats of the scratch buffer passed to execute
+    [[nodiscard]] size_t scratchSize() const;
+
+    // Transforms the size complex values of src to dst, src may be equal to dst. The inverse transform is not
+    // normalized
+    void execute(const float* src, float* dst, float* scratch, bool inverse) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // length of the subsequences transformed by the stage
+        size_t length;
+        size_t stride;
+        size_t twiddlesOffset;
+        // the roots of unity of a generic radix stage
+        size_t rootsOffset;
+    };
+
+    template <bool Inverse>
+    void executeStockham(const float* src, float* dst, float* scratch) const;
+    template <bool Inverse>
+    void executeBluestein(const float* src, float* dst, float* scratch) const;
+    template <bool Inverse>
+    void runStage(const Stage& stage, const float* src, float* dst) const;
+
+    size_t m_size;
+    std::vector<Stage> m_stages;
+    std::vector<float> m_twiddles;
+    std::vector<float> m_roots;
+
+    // Bluestein's algorithm: the chirp exp(-i * pi * n^2 / size) and the spectrum of the conjugate chirp filter
+    std::shared_ptr<const FftPlan> m_convolution;
+    std::vector<float> m_chirp;
+    std::vector<float> m_filterSpectrum;
+};
+
+// FFT of a real signal of a fixed size, the spectrum consists of the size / 2 + 1 non-negative frequency values.
+// An even size is computed with a complex FFT of the half size over the pairs of the samples
+class RealFftPlan {
+public:
+    explicit RealFftPlan(size_t size);
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    [[nodiscard]] size_t scratchSize() const;
+
+    // size real values of src to size / 2 + 1 complex values of dst
+    void forward(const float* src, float* dst, float* scratch) const;
+
+    // size / 2 + 1 complex values of src to size real values of dst, the result is normalized by the size. The
+    // imaginary parts of the zero and the Nyquist frequencies are ignored
+    void inverse(const float* src, float* dst, float* scratch) const;
+
+private:
+    size_t m_size;
+    std::shared_ptr<const FftPlan> m_complex;
+    // exp(-2 * pi * i * k / size) for k in [0, size / 2) of an even size
+    std::vector<float> m_twiddles;
+};
+
+// Buffers of a parallel loop over the signals, one per thread, so the signals transformed by a thread reuse the same
+// memory for the scratch of the plan and the gathered data
+class FftWorkspace {
+public:
+    explicit FftWorkspace(size_t size);
+
+    // The buffer of the calling thread
+    [[nodiscard]] float* local();
+
+private:
+    size_t m_size;
+    std::vector<float> m_buffers;
+};
+
+// The plans are immutable and shared by all the nodes of the process, the cache keeps the plans of the recently used
+// sizes only, so the nodes keep the plans of their sizes to fetch them once
+std::shared_ptr<const FftPlan> getFftPlan(size_t size);
+std::shared_ptr<const RealFftPlan> getRealFftPlan(size_t size);
+
+}  // namespace ov::intel_cpu
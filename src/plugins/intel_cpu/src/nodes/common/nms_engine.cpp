@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_engine.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "nodes/common/radix_select.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+bool isBetterCandidate(const NmsCandidate& l, const NmsCandidate& r) {
+    return l.first > r.first || (l.first == r.first && l.second < r.second);
+}
+
+// Below this size the partial sort is as fast as the histogram passes
+constexpr size_t RADIX_SELECT_MIN_SIZE = 1024;
+
+}  // namespace
+
+void nmsSelectTopK(std::vector<NmsCandidate>& candidates, size_t k) {
+    const size_t count = candidates.size();
+    if (k >= count) {
+        std::sort(candidates.begin(), candidates.end(), isBetterCandidate);
+        return;
+    }
+    if (count < RADIX_SELECT_MIN_SIZE) {
+        std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end(), isBetterCandidate);
+        candidates.resize(k);
+        return;
+    }
+
+    std::vector<uint32_t> keys(count);
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = radixKey(candidates[i].first);
+    }
+
+    size_t remaining = 0;
+    const uint32_t kthKey = radixSelectKey(keys.data(), count, k, remaining);
+
+    // All candidates above the k-th key are taken, and the ties with the lowest indices fill the rest
+    std::vector<NmsCandidate> selected;
+    std::vector<NmsCandidate> ties;
+    selected.reserve(k);
+    for (size_t i = 0; i < count; i++) {
+        if (keys[i] > kthKey) {
+            selected.push_back(candidates[i]);
+        } else if (keys[i] == kthKey) {
+            ties.push_back(candidates[i]);
+        }
+    }
+    if (ties.size() > remaining) {
+        std::nth_element(ties.begin(), ties.begin() + remaining, ties.end(), isBetterCandidate);
+    }
+    selected.insert(selected.end(), ties.begin(), ties.begin() + remaining);
+    std::sort(selected.begin(), selected.end(), isBetterCandidate);
+    candidates = std::move(selected);
+}
+
+void GreedyNms::resize(size_t count) {
+    m_xMin.resize(count);
+    m_yMin.resize(count);
+    m_xMax.resize(count);
+    m_yMax.resize(count);
+    m_area.resize(count);
+}
+
+uint64_t GreedyNms::overlapMask(size_t kept, size_t begin, size_t end) const {
+    const float xMin = m_xMin[kept];
+    const float yMin = m_yMin[kept];
+    const float xMax = m_xMax[kept];
+    const float yMax = m_yMax[kept];
+    const float area = m_area[kept];
+    const float* xMins = m_xMin.data() + begin;
+    const float* yMins = m_yMin.data() + begin;
+    const float* xMaxs = m_xMax.data() + begin;
+    const float* yMaxs = m_yMax.data() + begin;
+    const float* areas = m_area.data() + begin;
+    const size_t size = end - begin;
+
+    std::array<float, TILE> iou{};
+    for (size_t j = 0; j < size; j++) {
+        const float width = std::max(std::min(xMax, xMaxs[j]) - std::max(xMin, xMins[j]) + m_offset, 0.F);
+        const float height = std::max(std::min(yMax, yMaxs[j]) - std::max(yMin, yMins[j]) + m_offset, 0.F);
+        const float intersection = width * height;
+        const bool valid = area > 0.F && areas[j] > 0.F;
+        iou[j] = valid ? intersection / (area + areas[j] - intersection) : 0.F;
+    }
+
+    uint64_t mask = 0;
+    if (m_suppressOnEqual) {
+        for (size_t j = 0; j < size; j++) {
+            mask |= static_cast<uint64_t>(iou[j] >= m_iouThreshold) << j;
+        }
+    } else {
+        for (size_t j = 0; j < size; j++) {
+            mask |= static_cast<uint64_t>(iou[j] > m_iouThreshold) << j;
+        }
+    }
+    return mask;
+}
+
+const std::vector<size_t>& GreedyNms::run(size_t maxKept) {
+    const size_t count = m_area.size();
+    const size_t tiles = (count + TILE - 1) / TILE;
+    m_suppressed.assign(tiles, 0);
+    m_kept.clear();
+
+    for (size_t i = 0; i < count && m_kept.size() < maxKept; i++) {
+        if ((m_suppressed[i / TILE] >> (i % TILE)) & 1U) {
+            continue;
+        }
+        m_kept.push_back(i);
+        if (m_kept.size() == maxKept) {
+            break;
+        }
+        for (size_t tile = (i + 1) / TILE; tile < tiles; tile++) {
+            const size_t tileBegin = tile * TILE;
+            const size_t begin = std::max(tileBegin, i + 1);
+            const size_t end = std::min(tileBegin + TILE, count);
+            const size_t shift = begin - tileBegin;
+            const uint64_t pending = (end - tileBegin == TILE ? ~uint64_t{0} : (uint64_t{1} << (end - tileBegin)) - 1) &
+                                     (~uint64_t{0} << shift);
+            if ((m_suppressed[tile] & pending) == pending) {
+                continue;
+            }
+            m_suppressed[tile] |= overlapMask(i, begin, end) << shift;
+        }
+    }
+    return m_kept;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+// Score and index of a candidate box of the detection post-processing nodes
+using NmsCandidate = std::pair<float, int>;
+
+// Keeps the k candidates with the highest scores and sorts them by the score in descending order, ties are broken by
+// the lower index. The result matches a full sort followed by truncation, but large candidate sets are reduced to k
+// elements with a radix select first, so the cost of the sort depends on k only
+void nmsSelectTopK(std::vector<NmsCandidate>& candidates, size_t k);
+
+// Greedy hard NMS over the boxes given in the selection order: a box is kept if its IoU with each of the previously
+// kept boxes does not exceed the threshold. The boxes are stored as a structure of arrays, so the IoU of a kept box
+// with the following ones is computed in vectorized tiles of 64 boxes, which are merged into a suppression bitmask.
+// Tiles whose boxes are all suppressed are skipped
+class GreedyNms {
+public:
+    // suppressOnEqual: a box with the IoU equal to the threshold is suppressed as well
+    // offset: value added to each side of the intersection, 1 for the boxes in pixel coordinates
+    GreedyNms(float iouThreshold, bool suppressOnEqual, float offset = 0.F)
+        : m_iouThreshold(iouThreshold),
+          m_suppressOnEqual(suppressOnEqual),
+          m_offset(offset) {}
+
+    void resize(size_t count);
+
+    // The area is passed by the caller as the nodes compute it differently.
+    // Boxes with non-positive area overlap nothing
+    void setBox(size_t idx, float xMin, float yMin, float xMax, float yMax, float area) {
+        m_xMin[idx] = xMin;
+        m_yMin[idx] = yMin;
+        m_xMax[idx] = xMax;
+        m_yMax[idx] = yMax;
+        m_area[idx] = area;
+    }
+
+    // Returns the positions of the kept boxes in the selection order, at most maxKept of them
+    const std::vector<size_t>& run(size_t maxKept);
+
+private:
+    static constexpr size_t TILE = 64;
+
+    uint64_t overlapMask(size_t kept, size_t begin, size_t end) const;
+
+    float m_iouThreshold;
+    bool m_suppressOnEqual;
+    float m_offset;
+    std::vector<float> m_xMin;
+    std::vector<float> m_yMin;
+    std::vector<float> m_xMax;
+    std::vector<float> m_yMax;
+    std::vector<float> m_area;
+    std::vector<uint64_t> m_suppressed;
+    std::vector<size_t> m_kept;
+};
+
+}  // namespace ov::intel_cpu
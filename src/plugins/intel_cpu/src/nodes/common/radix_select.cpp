@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "radix_select.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+uint32_t radixSelectKey(const uint32_t* keys, size_t count, size_t k, size_t& ties) {
+    std::vector<uint32_t> matching;
+    const uint32_t* current = keys;
+    size_t currentCount = count;
+    uint32_t prefix = 0;
+    size_t remaining = k;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        std::array<size_t, 256> histogram{};
+        for (size_t i = 0; i < currentCount; i++) {
+            histogram[(current[i] >> shift) & 0xFFU]++;
+        }
+        uint32_t digit = 255;
+        while (histogram[digit] < remaining) {
+            remaining -= histogram[digit];
+            digit--;
+        }
+        prefix |= digit << shift;
+        if (shift == 0) {
+            break;
+        }
+
+        // The keys with other digits are dropped, so the next passes read fewer of them
+        const uint32_t digitMask = 0xFFU << shift;
+        const uint32_t digitValue = digit << shift;
+        if (histogram[digit] != currentCount) {
+            if (matching.empty()) {
+                matching.reserve(histogram[digit]);
+                for (size_t i = 0; i < currentCount; i++) {
+                    if ((current[i] & digitMask) == digitValue) {
+                        matching.push_back(current[i]);
+                    }
+                }
+            } else {
+                size_t size = 0;
+                for (size_t i = 0; i < currentCount; i++) {
+                    if ((current[i] & digitMask) == digitValue) {
+                        matching[size++] = current[i];
+                    }
+                }
+                matching.resize(size);
+            }
+            current = matching.data();
+            currentCount = matching.size();
+        }
+    }
+    ties = remaining;
+    return prefix;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ov::intel_cpu {
+
+// Maps the value to an unsigned key of the same order, -0 and +0 are mapped to the same key
+inline uint32_t radixKey(float value) {
+    if (value == 0.F) {
+        value = 0.F;
+    }
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+}
+
+inline uint32_t radixKey(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000U;
+}
+
+// Finds the k-th largest of the keys (0 < k <= count) with MSB-first 8-bit histogram passes, each pass reads only the
+// keys which still match the found digits. Returns the key, ties is set to the number of the keys equal to it which
+// belong to the k largest ones
+uint32_t radixSelectKey(const uint32_t* keys, size_t count, size_t k, size_t& ties);
+
+// Writes the k largest keys and their indices to dst in the order of the elements, the ties are taken in this order
+// as well. dst may point to the source keys, as an element is never written after its position. Returns the number
+// of the written elements
+template <typename GetIndex>
+size_t radixKeepLargest(const uint32_t* keys,
+                        size_t count,
+                        size_t k,
+                        const GetIndex& getIndex,
+                        uint32_t* dstKeys,
+                        int32_t* dstIdx) {
+    if (count == 0 || k == 0) {
+        return 0;
+    }
+    k = std::min(k, count);
+    size_t ties = 0;
+    const uint32_t kthKey = radixSelectKey(keys, count, k, ties);
+    size_t kept = 0;
+    for (size_t i = 0; i < count && kept < k; i++) {
+        const uint32_t key = keys[i];
+        if (key < kthKey || (key == kthKey && ties == 0)) {
+            continue;
+        }
+        if (key == kthKey) {
+            ties--;
+        }
+        dstIdx[kept] = getIndex(i);
+        dstKeys[kept] = key;
+        kept++;
+    }
+    return kept;
+}
+
+}  // namespace ov::intel_cpu
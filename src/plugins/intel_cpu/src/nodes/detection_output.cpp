@@ -21,6 +21,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_engine.h"
 #include "onednn/dnnl.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -34,21 +35,6 @@
 using namespace dnnl;
 
 namespace ov::intel_cpu::node {
-namespace {
-
-template <typename T>
-bool SortScorePairDescend(const std::pair<float, T>& pair1, const std::pair<float, T>& pair2) {
-    return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second < pair2.second);
-}
-
-template <>
-bool SortScorePairDescend<std::pair<int, int>>(const std::pair<float, std::pair<int, int>>& pair1,
-                                               const std::pair<float, std::pair<int, int>>& pair2) {
-    return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second.second < pair2.second.second);
-}
-
-}  // namespace
-
 bool DetectionOutput::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                            std::string& errorMessage) noexcept {
     try {
@@ -168,22 +154,6 @@ void DetectionOutput::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inDataConf, {{LayoutType::ncsp, ov::element::f32}}, impl_desc_type::ref_any);
 }
 
-struct ConfidenceComparatorDO {
-    explicit ConfidenceComparatorDO(const float* confDataIn) : confData(confDataIn) {}
-
-    bool operator()(int idx1, int idx2) const {
-        if (confData[idx1] > confData[idx2]) {
-            return true;
-        }
-        if (confData[idx1] < confData[idx2]) {
-            return false;
-        }
-        return idx1 < idx2;
-    }
-
-    const float* confData;
-};
-
 void DetectionOutput::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
@@ -407,34 +377,26 @@ void DetectionOutput::execute([[maybe_unused]] const dnnl::stream& strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
-
-            std::mutex mtx;
-            cpu_parallel->parallel_for(classesNum, [&](int c) {
+            // the detections are identified by prior * classesNum + class, so equal scores are ordered by the prior
+            std::vector<NmsCandidate> confIndicesClassMap;
+            confIndicesClassMap.reserve(detectionsTotal);
+            for (int c = 0; c < classesNum; ++c) {
                 const int detections = detectionsData[n * classesNum + c];
-                int* pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
-
-                float* pconf = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
-
+                const int* pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                const float* pconf = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
                 for (int i = 0; i < detections; ++i) {
-                    int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.emplace_back(pconf[pr], std::make_pair(c, pr));
-                    mtx.unlock();
+                    const int pr = pindices[i];
+                    confIndicesClassMap.emplace_back(pconf[pr], pr * classesNum + c);
                 }
-            });
-
-            std::sort(confIndicesClassMap.begin(),
-                      confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
-            confIndicesClassMap.resize(keepTopK);
+            }
+            nmsSelectTopK(confIndicesClassMap, keepTopK);
 
             // Store the new indices. Assign to class back
             memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
 
-            for (auto& j : confIndicesClassMap) {
-                const int cls = j.second.first;
-                const int pr = j.second.second;
+            for (const auto& j : confIndicesClassMap) {
+                const int cls = j.second % classesNum;
+                const int pr = j.second / classesNum;
                 int* pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
                 pindices[detectionsData[n * classesNum + cls]] = pr;
                 detectionsData[n * classesNum + cls]++;
@@ -845,41 +807,14 @@ inline void DetectionOutput::decodeBBoxes(const float* priorData,
 }
 
 inline void DetectionOutput::topk(const int* indicesIn, int* indicesOut, const float* conf, int n, int k) {
-    std::partial_sort_copy(indicesIn, indicesIn + n, indicesOut, indicesOut + k, ConfidenceComparatorDO(conf));
-}
-
-static inline float JaccardOverlap(const float* decodedBbox, const float* bboxSizes, const int idx1, const int idx2) {
-    const float xmin1 = decodedBbox[idx1 * 4 + 0];
-    const float ymin1 = decodedBbox[idx1 * 4 + 1];
-    const float xmax1 = decodedBbox[idx1 * 4 + 2];
-    const float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    const float xmin2 = decodedBbox[idx2 * 4 + 0];
-    const float ymin2 = decodedBbox[idx2 * 4 + 1];
-    const float xmax2 = decodedBbox[idx2 * 4 + 2];
-    const float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0F;
+    std::vector<NmsCandidate> candidates(n);
+    for (int i = 0; i < n; ++i) {
+        candidates[i] = {conf[indicesIn[i]], indicesIn[i]};
     }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0F;
+    nmsSelectTopK(candidates, k);
+    for (int i = 0; i < k; ++i) {
+        indicesOut[i] = candidates[i].second;
     }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
 }
 
 inline void DetectionOutput::NMSCF(const int* indicesIn,
@@ -888,25 +823,18 @@ inline void DetectionOutput::NMSCF(const int* indicesIn,
                                    const float* bboxes,
                                    const float* boxSizes) const {
     // nms for this class
-    int countIn = detections;
-    detections = 0;
-    for (int i = 0; i < countIn; ++i) {
+    GreedyNms nms(NMSThreshold, false);
+    nms.resize(detections);
+    for (int i = 0; i < detections; ++i) {
         const int prior = indicesIn[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indicesOut[detections] = prior;
-            detections++;
-        }
+        const float* box = bboxes + prior * 4;
+        nms.setBox(i, box[0], box[1], box[2], box[3], boxSizes[prior]);
     }
+    const auto& kept = nms.run(detections);
+    for (size_t i = 0; i < kept.size(); ++i) {
+        indicesOut[i] = indicesIn[kept[i]];
+    }
+    detections = static_cast<int>(kept.size());
 }
 
 inline void DetectionOutput::NMSMX(const int* indicesIn,
@@ -915,37 +843,36 @@ inline void DetectionOutput::NMSMX(const int* indicesIn,
                                    const float* bboxes,
                                    const float* sizes) const {
     // Input is candidate for image, output is candidate for each class within image
-    int countIn = detections[0];
+    const int countIn = detections[0];
     detections[0] = 0;
 
+    // The candidates keep their order within the classes, and nms is done for each class independently
+    std::vector<std::vector<int>> classCandidates(classesNum);
     for (int i = 0; i < countIn; ++i) {
-        const int idx = indicesIn[i];
-        const int cls = idx / priorsNum;
-        const int prior = idx % priorsNum;
-
-        // nms within this class
-        int& ndetection = detections[cls];
-        int* pindices = indicesOut + cls * priorsNum;
+        classCandidates[indicesIn[i] / priorsNum].push_back(indicesIn[i] % priorsNum);
+    }
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0F;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
+    const auto& cpu_parallel = context->getCpuParallel();
+    cpu_parallel->parallel_for(classesNum, [&](int cls) {
+        const auto& priors = classCandidates[cls];
+        if (priors.empty()) {
+            return;
         }
-
-        if (keep) {
-            pindices[ndetection++] = prior;
+        const int boxShift = isShareLoc ? 0 : cls * priorsNum;
+        GreedyNms nms(NMSThreshold, false);
+        nms.resize(priors.size());
+        for (size_t i = 0; i < priors.size(); ++i) {
+            const int idx = boxShift + priors[i];
+            const float* box = bboxes + idx * 4;
+            nms.setBox(i, box[0], box[1], box[2], box[3], sizes[idx]);
         }
-    }
+        const auto& kept = nms.run(priors.size());
+        int* pindices = indicesOut + cls * priorsNum;
+        for (size_t i = 0; i < kept.size(); ++i) {
+            pindices[i] = priors[kept[i]];
+        }
+        detections[cls] = static_cast<int>(kept.size());
+    });
 }
 
 inline void DetectionOutput::generateOutput(const float* reorderedConfData,
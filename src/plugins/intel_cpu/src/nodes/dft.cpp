@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/fft_plan.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
@@ -270,7 +271,12 @@ void DFT::execute([[maybe_unused]] const dnnl::stream& strm) {
         size_t nComplex = outputShape[axis];
         // FFT uses different twiddle factors
         if (!IsPowerOfTwo(nComplex)) {
-            if (twiddlesMapDFT.find(nComplex) == twiddlesMapDFT.end() || lastInverse != inverse) {
+            // The larger sizes are computed with the shared FFT plans
+            if (nComplex >= FFT_PLAN_MIN_SIZE) {
+                if (fftPlans.find(nComplex) == fftPlans.end()) {
+                    fftPlans[nComplex] = getFftPlan(nComplex);
+                }
+            } else if (twiddlesMapDFT.find(nComplex) == twiddlesMapDFT.end() || lastInverse != inverse) {
                 twiddlesMapDFT[nComplex] = generateTwiddlesDFT(nComplex, inverse);
             }
         } else {
@@ -304,6 +310,10 @@ void DFT::execute([[maybe_unused]] const dnnl::stream& strm) {
             if (resultBufPtr != dst) {
                 cpu_memcpy(dst, resultBufPtr, nComplex * 2 * sizeof(float));
             }
+        } else if (nComplex >= FFT_PLAN_MIN_SIZE) {
+            const auto& plan = *fftPlans.at(nComplex);
+            std::vector<float> scratch(plan.scratchSize());
+            plannedDFT(dst, plan, scratch.data(), inverse);
         } else {
             naiveDFT(dst, nComplex * 2, inverse);
         }
@@ -327,21 +337,27 @@ void DFT::dftNd(float* output,
         const size_t outputLen = outputComplexLen * 2;
 
         std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
+        if (IsPowerOfTwo(outputComplexLen) || outputComplexLen >= FFT_PLAN_MIN_SIZE) {
             size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+            const FftPlan* plan = IsPowerOfTwo(outputComplexLen) ? nullptr : fftPlans.at(outputComplexLen).get();
+            FftWorkspace workspace(outputLen * 2 + (plan ? plan->scratchSize() : 0));
             do {
                 cpu_parallel->parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen * 2);
+                    float* gatheredData = workspace.local();
                     auto parallelIterationCounter = iterationCounter;
                     parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(),
+                    gatherToBufferND(gatheredData,
                                      output,
                                      currentAxis,
                                      parallelIterationCounter,
                                      outputShape,
                                      outputStrides);
-                    const float* resultBufPtr = nullptr;
-                    fft(gatheredData.data(), gatheredData.data() + outputLen, outputLen, inverse, false, &resultBufPtr);
+                    const float* resultBufPtr = gatheredData;
+                    if (plan == nullptr) {
+                        fft(gatheredData, gatheredData + outputLen, outputLen, inverse, false, &resultBufPtr);
+                    } else {
+                        plannedDFT(gatheredData, *plan, gatheredData + outputLen * 2, inverse);
+                    }
                     applyBufferND(resultBufPtr,
                                   output,
                                   currentAxis,
@@ -506,6 +522,17 @@ void DFT::naiveDFT(float* data, size_t dataLength, bool inverse) const {
     cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
 }
 
+void DFT::plannedDFT(float* data, const FftPlan& plan, float* scratch, bool inverse) {
+    const size_t nComplex = plan.size();
+    plan.execute(data, data, scratch, inverse);
+    if (inverse) {
+        const float reciprocalNComplex = 1.0F / nComplex;
+        for (size_t k = 0; k < 2 * nComplex; k++) {
+            data[k] *= reciprocalNComplex;
+        }
+    }
+}
+
 std::vector<float> DFT::generateTwiddlesDFT(size_t n_complex, bool inverse) {
     std::vector<float> twiddles(n_complex * n_complex * 2);
     const float inverseMultiplier = inverse ? 1 : -1;
@@ -631,7 +658,7 @@ void DFT::createPrimitive() {
         for (auto axis : axes) {
             if (IsPowerOfTwo(outputShape[axis])) {
                 hasFFT = true;
-            } else {
+            } else if (outputShape[axis] < FFT_PLAN_MIN_SIZE) {
                 hasDFT = true;
             }
         }
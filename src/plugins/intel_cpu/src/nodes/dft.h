@@ -9,10 +9,13 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "kernels/x64/dft_uni_kernel.hpp"
+#include "nodes/common/fft_plan.h"
 #include "node.h"
 #include "openvino/core/node.hpp"
 
@@ -50,6 +53,8 @@ private:
              bool parallelize,
              const float** resultBuf) const;
     void naiveDFT(float* data, size_t dataLength, bool inverse) const;
+    // DFT of a size which is not a power of two with the shared mixed radix FFT plans, in place
+    static void plannedDFT(float* data, const FftPlan& plan, float* scratch, bool inverse);
 
     std::vector<float> generateTwiddlesDFT(size_t n_complex, bool inverse);
     void updateTwiddlesFFT(size_t n_complex, bool inverse);
@@ -59,6 +64,7 @@ private:
 
     std::vector<float> twiddlesFFT;
     std::unordered_map<size_t, std::vector<float>> twiddlesMapDFT;
+    std::unordered_map<size_t, std::shared_ptr<const FftPlan>> fftPlans;
 
     std::vector<int32_t> axes;
     const size_t DATA_INDEX = 0;
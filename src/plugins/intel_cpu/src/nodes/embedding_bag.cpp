@@ -4,19 +4,30 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/core/visibility.hpp"
+#include "utils/general_utils.h"
+
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+#    include <xmmintrin.h>
+#endif
 
 namespace ov::intel_cpu::node {
 
@@ -50,11 +61,180 @@ void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
-template <typename T>
-void EmbeddingBag::processData(const T* srcData,
-                               const T* weightsData,
-                               const VectorDims& inDataDims,
-                               const MemoryPtr& outMemory) {
+void EmbeddingBag::fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints) {
+    OPENVINO_ASSERT(!scales.empty(), "Layer EmbeddingBag with name '", _layerName, "' has empty decompression scales");
+    _decompressionScales = std::move(scales);
+    _decompressionZeroPoints = zeroPoints.empty() ? std::vector<float>{0.0F} : std::move(zeroPoints);
+}
+
+bool EmbeddingBag::isSupportedTablePrecision(const ov::element::Type& precision) const {
+    if (withDecompression()) {
+        return any_of(precision, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4);
+    }
+    return any_of(precision,
+                  ov::element::f32,
+                  ov::element::bf16,
+                  ov::element::f16,
+                  ov::element::i8,
+                  ov::element::u8,
+                  ov::element::i32);
+}
+
+ov::element::Type EmbeddingBag::getOutputPrecision(const ov::element::Type& tablePrecision) const {
+    if (withDecompression() || any_of(tablePrecision, ov::element::bf16, ov::element::f16)) {
+        return ov::element::f32;
+    }
+    return tablePrecision;
+}
+
+namespace {
+
+// Number of rows the next rows of a bag are prefetched ahead of the one being reduced. The rows are scattered over
+// the table, so the hardware prefetcher can't predict them
+constexpr size_t PREFETCH_DISTANCE = 8LU;
+
+inline void prefetchRow(const void* row, size_t bytes) {
+    const auto* ptr = static_cast<const char*>(row);
+    for (size_t offset = 0LU; offset < bytes; offset += 64LU) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(ptr + offset);
+#endif
+    }
+}
+
+// Table stored in the output precision or in a narrower floating point one, which is upconverted to f32
+template <typename TableType, typename T>
+struct PlainRows {
+    const TableType* data;
+    size_t depth;
+
+    const void* address(size_t row) const {
+        return data + row * depth;
+    }
+
+    size_t bytes() const {
+        return depth * sizeof(TableType);
+    }
+
+    template <bool accumulate>
+    void reduce(T* dst, size_t row, T weight) const {
+        const TableType* src = data + row * depth;
+        for (size_t i = 0LU; i < depth; i++) {
+            if constexpr (accumulate) {
+                dst[i] += static_cast<T>(src[i]) * weight;
+            } else {
+                dst[i] = static_cast<T>(src[i]) * weight;
+            }
+        }
+    }
+};
+
+// Row-wise quantized table: the scale and zero point are looked up once per row, so the inner loop is a fused
+// multiply-add over the row
+template <typename QuantizedType>
+struct QuantizedRows {
+    const QuantizedType* data;
+    size_t depth;
+    const std::vector<float>& scales;
+    const std::vector<float>& zeroPoints;
+
+    const void* address(size_t row) const {
+        return data + row * depth;
+    }
+
+    size_t bytes() const {
+        return depth * sizeof(QuantizedType);
+    }
+
+    template <bool accumulate>
+    void reduce(float* dst, size_t row, float weight) const {
+        const QuantizedType* src = data + row * depth;
+        const float scale = scales[scales.size() == 1LU ? 0LU : row] * weight;
+        const float zeroPoint = zeroPoints[zeroPoints.size() == 1LU ? 0LU : row];
+        for (size_t i = 0LU; i < depth; i++) {
+            const float value = (static_cast<float>(src[i]) - zeroPoint) * scale;
+            if constexpr (accumulate) {
+                dst[i] += value;
+            } else {
+                dst[i] = value;
+            }
+        }
+    }
+};
+
+// Row-wise quantized table of 4-bit values packed two per byte, the low nibble first
+template <bool isSigned>
+struct Quantized4BitRows {
+    const uint8_t* data;
+    size_t depth;
+    const std::vector<float>& scales;
+    const std::vector<float>& zeroPoints;
+
+    static float unpack(uint8_t nibble) {
+        if constexpr (isSigned) {
+            return static_cast<float>(static_cast<int>(nibble ^ 0x8) - 0x8);
+        } else {
+            return static_cast<float>(nibble);
+        }
+    }
+
+    const void* address(size_t row) const {
+        return data + row * depth / 2;
+    }
+
+    size_t bytes() const {
+        return (depth + 1LU) / 2;
+    }
+
+    template <bool accumulate>
+    void reduce(float* dst, size_t row, float weight) const {
+        const float scale = scales[scales.size() == 1LU ? 0LU : row] * weight;
+        const float zeroPoint = zeroPoints[zeroPoints.size() == 1LU ? 0LU : row];
+        auto store = [&](size_t i, uint8_t nibble) {
+            const float value = (unpack(nibble) - zeroPoint) * scale;
+            if constexpr (accumulate) {
+                dst[i] += value;
+            } else {
+                dst[i] = value;
+            }
+        };
+        const size_t firstElement = row * depth;
+        const uint8_t* src = data + firstElement / 2;
+        size_t i = 0LU;
+        // a row of odd length may start in the high nibble
+        if (firstElement % 2 != 0 && depth > 0LU) {
+            store(i++, *src++ >> 4);
+        }
+        for (; i + 1LU < depth; i += 2LU, src++) {
+            store(i, *src & 0xF);
+            store(i + 1LU, *src >> 4);
+        }
+        if (i < depth) {
+            store(i, *src & 0xF);
+        }
+    }
+};
+
+}  // namespace
+
+void EmbeddingBag::collectBags(size_t bagsNum) {
+    _bags.resize(bagsNum);
+    _bagsWork.resize(bagsNum + 1LU);
+    _bagsWork[0] = 0LU;
+    for (size_t obi = 0LU; obi < bagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        // an empty bag still costs filling its output
+        _bagsWork[obi + 1LU] = _bagsWork[obi] + (bag.indices != nullptr ? bag.size : 0LU) + 1LU;
+    }
+}
+
+template <typename T, typename Rows>
+void EmbeddingBag::processData(const Rows& rows, const T* weightsData, size_t tableRows, const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
 
     initFromInputs();
@@ -62,66 +242,64 @@ void EmbeddingBag::processData(const T* srcData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto* dstData = outMemory->getDataAs<T>();
 
+    collectBags(outputBagsNum);
+    const size_t totalWork = _bagsWork.back();
+
+    // Returns the rows of the bags following the current one, so the prefetch continues across small bags
+    auto rowAhead = [&](size_t obi, size_t inIdx, size_t end) -> const int* {
+        size_t ahead = inIdx + PREFETCH_DISTANCE;
+        // a long run of empty bags is not scanned for every row
+        for (const size_t last = std::min(end, obi + PREFETCH_DISTANCE); obi < last; obi++) {
+            const auto& bag = _bags[obi];
+            const size_t size = bag.indices != nullptr ? bag.size : 0LU;
+            if (ahead < size) {
+                return bag.indices + ahead;
+            }
+            ahead -= size;
+        }
+        return nullptr;
+    };
+
     auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0LU);
-        size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        // The bags are split by the number of rows they reduce rather than by their count, so the threads get an
+        // even share of work for skewed bag lengths
+        auto firstBag = [&](int thr) {
+            const size_t work = totalWork * thr / nthr;
+            return static_cast<size_t>(std::lower_bound(_bagsWork.begin(), _bagsWork.end(), work) - _bagsWork.begin());
+        };
+        const size_t start = firstBag(ithr);
+        const size_t end = std::min(firstBag(ithr + 1), outputBagsNum);
         if (start >= end) {
             return;
         }
 
-        size_t indicesSize = 0LU;
-        const int* indices = nullptr;
-        int weightsIdx = 0LU;
-        bool withWeights = _withWeights;
-
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0LU;
-                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+            T* dst = dstData + obi * _embDepth;
+            const auto& bag = _bags[obi];
+            if (bag.indices == nullptr) {
+                std::fill_n(dst, _embDepth, static_cast<T>(0));
+                continue;
+            }
 
-                for (inIdx = 1LU; inIdx < indicesSize; inIdx++) {
-                    OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                    msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+            for (size_t inIdx = 0LU; inIdx < bag.size; inIdx++) {
+                const int* ahead = rowAhead(obi, inIdx, end);
+                if (ahead != nullptr && static_cast<size_t>(*ahead) < tableRows) {
+                    prefetchRow(rows.address(*ahead), rows.bytes());
                 }
-                if (_reduction == Reduction::MEAN) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] /= indicesSize;
-                    }
+
+                OPENVINO_ASSERT(static_cast<size_t>(bag.indices[inIdx]) < tableRows,
+                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]));
+                const auto row = static_cast<size_t>(bag.indices[inIdx]);
+                const T weight = bag.withWeights ? weightsData[bag.weightsIdx + inIdx] : static_cast<T>(1);
+                if (inIdx == 0LU) {
+                    rows.template reduce<false>(dst, row, weight);
+                } else {
+                    rows.template reduce<true>(dst, row, weight);
                 }
-            } else {
+            }
+            if (_reduction == Reduction::MEAN) {
                 for (size_t i = 0LU; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] /= bag.size;
                 }
             }
         }
@@ -135,30 +313,83 @@ void EmbeddingBag::execute(const uint8_t* srcData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
+    const size_t tableRows = inDims[0];
+    if (withDecompression()) {
+        const auto* weights = reinterpret_cast<const float*>(weightsData);
+        switch (srcPrc) {
+        case ov::element::u8: {
+            QuantizedRows<uint8_t> rows{srcData, _embDepth, _decompressionScales, _decompressionZeroPoints};
+            processData(rows, weights, tableRows, outMemory);
+            break;
+        }
+        case ov::element::i8: {
+            QuantizedRows<int8_t> rows{reinterpret_cast<const int8_t*>(srcData),
+                                       _embDepth,
+                                       _decompressionScales,
+                                       _decompressionZeroPoints};
+            processData(rows, weights, tableRows, outMemory);
+            break;
+        }
+        case ov::element::u4: {
+            Quantized4BitRows<false> rows{srcData, _embDepth, _decompressionScales, _decompressionZeroPoints};
+            processData(rows, weights, tableRows, outMemory);
+            break;
+        }
+        case ov::element::i4: {
+            Quantized4BitRows<true> rows{srcData, _embDepth, _decompressionScales, _decompressionZeroPoints};
+            processData(rows, weights, tableRows, outMemory);
+            break;
+        }
+        default: {
+            OPENVINO_THROW("EmbeddingBag layer does not support compressed table precision '" +
+                           std::string(srcPrc.get_type_name()) + "'");
+        }
+        }
+        return;
+    }
+
     switch (srcPrc) {
     case ov::element::f32: {
-        processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                                                                       reinterpret_cast<const float*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
+        using T = element_type_traits<ov::element::f32>::value_type;
+        processData(PlainRows<T, T>{reinterpret_cast<const T*>(srcData), _embDepth},
+                    reinterpret_cast<const T*>(weightsData),
+                    tableRows,
+                    outMemory);
+        break;
+    }
+    case ov::element::bf16: {
+        processData(PlainRows<ov::bfloat16, float>{reinterpret_cast<const ov::bfloat16*>(srcData), _embDepth},
+                    reinterpret_cast<const float*>(weightsData),
+                    tableRows,
+                    outMemory);
+        break;
+    }
+    case ov::element::f16: {
+        processData(PlainRows<ov::float16, float>{reinterpret_cast<const ov::float16*>(srcData), _embDepth},
+                    reinterpret_cast<const float*>(weightsData),
+                    tableRows,
+                    outMemory);
         break;
     }
     case ov::element::i8: {
-        processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
-                                                                      reinterpret_cast<const int8_t*>(weightsData),
-                                                                      inDims,
-                                                                      outMemory);
+        using T = element_type_traits<ov::element::i8>::value_type;
+        processData(PlainRows<T, T>{reinterpret_cast<const T*>(srcData), _embDepth},
+                    reinterpret_cast<const T*>(weightsData),
+                    tableRows,
+                    outMemory);
         break;
     }
     case ov::element::u8: {
-        processData<element_type_traits<ov::element::u8>::value_type>(srcData, weightsData, inDims, outMemory);
+        using T = element_type_traits<ov::element::u8>::value_type;
+        processData(PlainRows<T, T>{srcData, _embDepth}, weightsData, tableRows, outMemory);
         break;
     }
     case ov::element::i32: {
-        processData<element_type_traits<ov::element::i32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
-                                                                       reinterpret_cast<const int32_t*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
+        using T = element_type_traits<ov::element::i32>::value_type;
+        processData(PlainRows<T, T>{reinterpret_cast<const T*>(srcData), _embDepth},
+                    reinterpret_cast<const T*>(weightsData),
+                    tableRows,
+                    outMemory);
         break;
     }
     default: {
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
@@ -33,6 +34,14 @@ public:
 
     virtual ~EmbeddingBag() = default;
 
+    // The table is quantized row-wise and decompressed on the fly as (table - zeroPoints) * scales. Both vectors hold
+    // either a value per row of the table or a single value
+    void fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints);
+
+    bool withDecompression() const {
+        return !_decompressionScales.empty();
+    }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(size_t embIndex,
@@ -43,8 +52,12 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
-    template <typename T>
-    void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    bool isSupportedTablePrecision(const ov::element::Type& precision) const;
+    // Precision of the output and the per-sample weights: floating point tables are reduced in f32
+    ov::element::Type getOutputPrecision(const ov::element::Type& tablePrecision) const;
+
+    template <typename T, typename Rows>
+    void processData(const Rows& rows, const T* weightsData, size_t tableRows, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
@@ -55,6 +68,22 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    struct Bag {
+        const int* indices = nullptr;
+        size_t size = 0LU;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    void collectBags(size_t bagsNum);
+
+    std::vector<Bag> _bags;
+    // Prefix sums of the number of rows reduced by the bags, used to balance the threads
+    std::vector<size_t> _bagsWork;
+    std::vector<float> _decompressionScales;
+    std::vector<float> _decompressionZeroPoints;
 };
 
 }  // namespace ov::intel_cpu::node
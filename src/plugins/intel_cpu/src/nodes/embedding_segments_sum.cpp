@@ -4,12 +4,12 @@
 
 #include "embedding_segments_sum.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -25,7 +25,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/embedding_segments_sum.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -65,28 +64,11 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
-                                                                    ov::element::i8,
-                                                                    ov::element::u8,
-                                                                    ov::element::i32};
-
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
-    if (!supportedPrecisions.empty()) {
-        CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    } else {
-        static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
-                                                                               ov::element::i8,
-                                                                               ov::element::u8,
-                                                                               ov::element::i32};
-        CPU_NODE_ASSERT(defaultSupportedPrecisions.find(inDataPrecision) != defaultSupportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    }
+    const auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    CPU_NODE_ASSERT(isSupportedTablePrecision(inDataPrecision),
+                    "has unsupported precision: ",
+                    inDataPrecision.get_type_name());
+    const auto outDataPrecision = getOutputPrecision(inDataPrecision);
 
     std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
@@ -96,10 +78,10 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, ov::element::i32);
     }
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, outDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outDataPrecision}}, impl_desc_type::ref_any);
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
@@ -116,6 +98,19 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = getSrcDataAtPortAs<const int>(DEFAULT_INDEX_IDX);
     }
+
+    const auto numSegments = static_cast<size_t>(std::max(lastNumSegments_, 0));
+    segmentBegin_.assign(numSegments, 0LU);
+    segmentSize_.assign(numSegments, 0LU);
+    for (size_t si = 0LU; si < indicesSize_; si++) {
+        const auto segment = static_cast<size_t>(segmentIds_[si]);
+        if (segment >= segmentSize_.size()) {
+            continue;
+        }
+        if (segmentSize_[segment]++ == 0LU) {
+            segmentBegin_[segment] = si;
+        }
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex,
@@ -126,17 +121,12 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     CPU_NODE_ASSERT(embIndex < static_cast<size_t>(lastNumSegments_), "Invalid embedding bag index.");
 
     indices = nullptr;
-    size = 0;
+    size = segmentSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentBegin_[embIndex];
+        weightsIdx = static_cast<int>(segmentBegin_[embIndex]);
     }
 
     // Empty bag
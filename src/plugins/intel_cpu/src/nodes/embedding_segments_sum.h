@@ -9,6 +9,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "embedding_bag.h"
 #include "graph_context.h"
@@ -50,6 +51,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    // The first index and the number of indices of every segment, collected in a single pass over the segment ids
+    std::vector<size_t> segmentBegin_;
+    std::vector<size_t> segmentSize_;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -16,6 +16,8 @@ namespace ov::intel_cpu {
 struct FCAttrs {
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    // the constant weights consist mostly of all zero blocks and are stored in the block compressed sparse row format
+    bool blockSparseWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool constantWeights = true;
 
@@ -43,6 +43,10 @@
 #    include "onednn/iml_type_mapper.h"
 #endif
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/block_sparse_fc.hpp"
+#endif
+
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "nodes/executors/kleidiai/kleidiai_mm.hpp"
 #endif
@@ -191,6 +195,18 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_block_sparse",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return BlockSparseFCExecutor::supports(config);
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            AcceptsAnyShape<FCAttrs>,
+            CreateDefault<BlockSparseFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
@@ -0,0 +1,345 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "block_sparse_fc.hpp"
+
+#include <oneapi/dnnl/dnnl_types.h>
+
+#include <algorithm>
+#include <cpu/x64/amx_tile_configure.hpp>
+#include <cpu/x64/brgemm/brgemm.hpp>
+#include <cpu/x64/brgemm/brgemm_types.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+namespace ov::intel_cpu {
+
+namespace {
+
+struct WeightsDims {
+    size_t N;
+    size_t K;
+};
+
+WeightsDims getWeightsDims(const VectorDims& dims, bool weightsNonTransposed) {
+    return weightsNonTransposed ? WeightsDims{dims[1], dims[0]} : WeightsDims{dims[0], dims[1]};
+}
+
+size_t blockSize(const ov::element::Type& computeType) {
+    return BlockSparseFCExecutor::N_BLOCK * BlockSparseFCExecutor::K_BLOCK * computeType.size();
+}
+
+// Packs the non zero blocks of the weights. A f32 block is stored as [K_BLOCK][N_BLOCK], a bf16 block in the VNNI
+// layout [K_BLOCK / 2][N_BLOCK][2] expected by brgemm
+MemoryPtr packWeights(const MemoryPtr& weightsMemory,
+                      bool weightsNonTransposed,
+                      const ov::element::Type& computeType,
+                      const ExecutorContext::CPtr& context) {
+    constexpr size_t N_BLOCK = BlockSparseFCExecutor::N_BLOCK;
+    constexpr size_t K_BLOCK = BlockSparseFCExecutor::K_BLOCK;
+    const auto [N, K] = getWeightsDims(weightsMemory->getStaticDims(), weightsNonTransposed);
+    const size_t nRows = N / N_BLOCK;
+    const size_t nCols = K / K_BLOCK;
+
+    auto create = [&]() {
+        std::vector<float> converted;
+        const auto* weights = weightsMemory->getDataAs<const float>();
+        if (weightsMemory->getPrecision() != f32) {
+            converted.resize(N * K);
+            cpu_convert(weightsMemory->getData(), converted.data(), weightsMemory->getPrecision(), f32, N * K);
+            weights = converted.data();
+        }
+        auto weight = [&](size_t n, size_t k) {
+            return weightsNonTransposed ? weights[k * N + n] : weights[n * K + k];
+        };
+
+        std::vector<int32_t> rowOffsets(nRows + 1, 0);
+        std::vector<int32_t> colIndices;
+        for (size_t nb = 0; nb < nRows; nb++) {
+            for (size_t kb = 0; kb < nCols; kb++) {
+                bool isZero = true;
+                for (size_t n = nb * N_BLOCK; n < (nb + 1) * N_BLOCK && isZero; n++) {
+                    for (size_t k = kb * K_BLOCK; k < (kb + 1) * K_BLOCK && isZero; k++) {
+                        isZero = weight(n, k) == 0.F;
+                    }
+                }
+                if (!isZero) {
+                    colIndices.push_back(static_cast<int32_t>(kb));
+                }
+            }
+            rowOffsets[nb + 1] = static_cast<int32_t>(colIndices.size());
+        }
+
+        const size_t blocksOffset = rnd_up((rowOffsets.size() + colIndices.size()) * sizeof(int32_t), 64);
+        const size_t packedSize = blocksOffset + colIndices.size() * blockSize(computeType);
+        auto packed = std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(u8, Shape{packedSize}));
+        auto* header = packed->getDataAs<int32_t>();
+        std::copy(rowOffsets.begin(), rowOffsets.end(), header);
+        std::copy(colIndices.begin(), colIndices.end(), header + rowOffsets.size());
+
+        auto* blocks = packed->getDataAs<uint8_t>() + blocksOffset;
+        for (size_t nb = 0; nb < nRows; nb++) {
+            for (auto i = rowOffsets[nb]; i < rowOffsets[nb + 1]; i++) {
+                const size_t n0 = nb * N_BLOCK;
+                const size_t k0 = colIndices[i] * K_BLOCK;
+                auto* block = blocks + i * blockSize(computeType);
+                for (size_t k = 0; k < K_BLOCK; k++) {
+                    for (size_t n = 0; n < N_BLOCK; n++) {
+                        if (computeType == f32) {
+                            reinterpret_cast<float*>(block)[k * N_BLOCK + n] = weight(n0 + n, k0 + k);
+                        } else {
+                            reinterpret_cast<ov::bfloat16*>(block)[((k / 2) * N_BLOCK + n) * 2 + k % 2] =
+                                ov::bfloat16(weight(n0 + n, k0 + k));
+                        }
+                    }
+                }
+            }
+        }
+        DEBUG_LOG("BlockSparseFCExecutor: ", colIndices.size(), " of ", nRows * nCols, " weights blocks are stored");
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = "block_sparse_fc_" + computeType.get_type_name() + "_" + std::to_string(N) +
+                                        "_" + std::to_string(K) + "_" + std::to_string(weightsNonTransposed) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+    return create();
+}
+
+}  // namespace
+
+bool BlockSparseFCExecutor::supports(const FCConfig& config) {
+    VERIFY(config.attrs.blockSparseWeights, HEURISTICS_MISMATCH);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(mayiuse(avx2), UNSUPPORTED_ISA);
+    VERIFY((srcType(config) == f32 && dstType(config) == f32) ||
+               (srcType(config) == bf16 && any_of(dstType(config), bf16, f32) && mayiuse(avx512_core_bf16)),
+           UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(any_of(weiType(config), f32, bf16, f16), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(implication(hasBias(config), biaType(config) == f32), UNSUPPORTED_BIAS_PRECISIONS);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+    const auto [N, K] = getWeightsDims(weiDims(config), config.attrs.weightsNonTransposed);
+    VERIFY(N % N_BLOCK == 0 && K % K_BLOCK == 0, UNSUPPORTED_BY_EXECUTOR);
+    return true;
+}
+
+float BlockSparseFCExecutor::blockSparsity(const MemoryCPtr& weights, bool weightsNonTransposed) {
+    const auto& dims = weights->getStaticDims();
+    if (dims.size() != 2) {
+        return 0.F;
+    }
+    const auto [N, K] = getWeightsDims(dims, weightsNonTransposed);
+    if (N % N_BLOCK != 0 || K % K_BLOCK != 0) {
+        return 0.F;
+    }
+    // the blocks are checked by the contiguous runs of their rows in memory, the check of a dense block stops at
+    // the first non zero value
+    const size_t rowBlock = weightsNonTransposed ? K_BLOCK : N_BLOCK;
+    const size_t runSize = (weightsNonTransposed ? N_BLOCK : K_BLOCK) * weights->getPrecision().size();
+    const size_t rowSize = dims[1] * weights->getPrecision().size();
+    const size_t nRowBlocks = dims[0] / rowBlock;
+    const size_t nColBlocks = rowSize / runSize;
+    const auto* data = weights->getDataAs<const uint8_t>();
+    size_t zeroBlocks = 0;
+    for (size_t rb = 0; rb < nRowBlocks; rb++) {
+        for (size_t cb = 0; cb < nColBlocks; cb++) {
+            bool isZero = true;
+            for (size_t r = rb * rowBlock; r < (rb + 1) * rowBlock && isZero; r++) {
+                const auto* run = data + r * rowSize + cb * runSize;
+                isZero = std::all_of(run, run + runSize, [](uint8_t value) {
+                    return value == 0;
+                });
+            }
+            zeroBlocks += static_cast<size_t>(isZero);
+        }
+    }
+    return static_cast<float>(zeroBlocks) / static_cast<float>(nRowBlocks * nColBlocks);
+}
+
+BlockSparseFCExecutor::BlockSparseFCExecutor(const FCAttrs& attrs,
+                                             const MemoryArgs& memory,
+                                             const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      m_computeType(memory.at(ARG_SRC)->getPrecision() == bf16 ? bf16 : f32),
+      m_isa(isa_undef),
+      m_withAmx(m_computeType == bf16 && mayiuse(avx512_core_amx)),
+      m_kernels(M_BLOCK + 1) {
+    const auto [N, K] = getWeightsDims(memory.at(ARG_WEI)->getStaticDims(), attrs.weightsNonTransposed);
+    m_N = N;
+    m_K = K;
+    // brgemm selects the AMX isa itself
+    if (!m_withAmx) {
+        if (m_computeType == bf16) {
+            m_isa = avx512_core_bf16;
+        } else {
+            m_isa = mayiuse(avx512_core) ? avx512_core : avx2;
+        }
+    }
+    m_packedWeights = packWeights(memory.at(ARG_WEI), attrs.weightsNonTransposed, m_computeType, context);
+    const auto* rowOffsets = m_packedWeights->getDataAs<const int32_t>();
+    const size_t nRows = m_N / N_BLOCK;
+    m_blocksOffset = rnd_up((nRows + 1 + rowOffsets[nRows]) * sizeof(int32_t), 64);
+}
+
+impl_desc_type BlockSparseFCExecutor::implType() const {
+    if (m_withAmx) {
+        return impl_desc_type::brgemm_sparse_avx512_amx;
+    }
+    return m_isa == avx2 ? impl_desc_type::brgemm_sparse_avx2 : impl_desc_type::brgemm_sparse_avx512;
+}
+
+std::unique_ptr<BlockSparseFCExecutor::Kernel> BlockSparseFCExecutor::createKernel(size_t M) const {
+    const auto dataType = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::ElementTypeToDataType(m_computeType));
+    brgemm_desc_t desc;
+    auto status = brgemm_desc_init(&desc,
+                                   m_isa,
+                                   brgemm_addr,
+                                   dataType,
+                                   dataType,
+                                   false,
+                                   false,
+                                   brgemm_row_major,
+                                   1.F,
+                                   0.F,
+                                   m_K,
+                                   N_BLOCK,
+                                   N_BLOCK,
+                                   M,
+                                   N_BLOCK,
+                                   K_BLOCK,
+                                   nullptr);
+    OPENVINO_ASSERT(status == dnnl_success, "BlockSparseFCExecutor: cannot initialize brgemm descriptor");
+
+    auto kernel = std::make_unique<Kernel>();
+    if (m_withAmx) {
+        status = brgemm_init_tiles(desc, kernel->palette);
+        OPENVINO_ASSERT(status == dnnl_success, "BlockSparseFCExecutor: cannot initialize AMX tiles");
+    }
+    brgemm_kernel_t* brgKernel = nullptr;
+    status = brgemm_kernel_create(&brgKernel, desc);
+    OPENVINO_ASSERT(status == dnnl_success, "BlockSparseFCExecutor: cannot create brgemm kernel");
+    kernel->kernel.reset(brgKernel);
+    return kernel;
+}
+
+bool BlockSparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    m_M = 1;
+    for (size_t i = 0; i + 1 < dstDims.size(); i++) {
+        m_M *= dstDims[i];
+    }
+    for (const auto rows : {std::min(m_M, M_BLOCK), m_M % M_BLOCK}) {
+        if (rows != 0 && !m_kernels[rows]) {
+            m_kernels[rows] = createKernel(rows);
+        }
+    }
+    return true;
+}
+
+void BlockSparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const uint8_t>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<uint8_t>();
+    const auto& biasMemory = memory.at(ARG_BIAS);
+    const auto* bias = biasMemory->getDesc().empty() ? nullptr : biasMemory->getDataAs<const float>();
+    const auto dstType = memory.at(ARG_DST)->getPrecision();
+
+    const auto* rowOffsets = m_packedWeights->getDataAs<const int32_t>();
+    const size_t nRows = m_N / N_BLOCK;
+    const auto* colIndices = rowOffsets + nRows + 1;
+    const auto* blocks = m_packedWeights->getDataAs<const uint8_t>() + m_blocksOffset;
+    const size_t srcElemSize = m_computeType.size();
+    const size_t dstElemSize = dstType.size();
+    const size_t mBlocks = div_up(m_M, M_BLOCK);
+
+    m_context->getCpuParallel()->parallel_for(nRows, [&](size_t nb) {
+        const auto begin = static_cast<size_t>(rowOffsets[nb]);
+        const auto end = static_cast<size_t>(rowOffsets[nb + 1]);
+        std::vector<brgemm_batch_element_t> batch(end - begin);
+        for (size_t i = begin; i < end; i++) {
+            batch[i - begin].ptr.B = blocks + i * blockSize(m_computeType);
+        }
+        alignas(64) float acc[M_BLOCK * N_BLOCK];
+        alignas(64) uint8_t wsp[4 * 1024];
+        const Kernel* configured = nullptr;
+
+        for (size_t mb = 0; mb < mBlocks; mb++) {
+            const size_t m0 = mb * M_BLOCK;
+            const size_t rows = std::min(M_BLOCK, m_M - m0);
+            if (batch.empty()) {
+                std::fill(acc, acc + rows * N_BLOCK, 0.F);
+            } else {
+                const auto& kernel = *m_kernels[rows];
+                if (m_withAmx && configured != &kernel) {
+                    amx_tile_configure(kernel.palette);
+                    configured = &kernel;
+                }
+                for (size_t i = begin; i < end; i++) {
+                    batch[i - begin].ptr.A = src + (m0 * m_K + colIndices[i] * K_BLOCK) * srcElemSize;
+                }
+                brgemm_kernel_execute(kernel.kernel.get(), static_cast<int>(batch.size()), batch.data(), acc, wsp);
+            }
+
+            for (size_t r = 0; r < rows; r++) {
+                float* values = acc + r * N_BLOCK;
+                if (bias) {
+                    for (size_t n = 0; n < N_BLOCK; n++) {
+                        values[n] += bias[nb * N_BLOCK + n];
+                    }
+                }
+                auto* out = dst + ((m0 + r) * m_N + nb * N_BLOCK) * dstElemSize;
+                if (dstType == f32) {
+                    std::memcpy(out, values, N_BLOCK * sizeof(float));
+                } else {
+                    auto* outBf16 = reinterpret_cast<ov::bfloat16*>(out);
+                    for (size_t n = 0; n < N_BLOCK; n++) {
+                        outBf16[n] = ov::bfloat16(values[n]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+void BlockSparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (m_curNumaNode == numaNodeID) {
+        return;
+    }
+    m_curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
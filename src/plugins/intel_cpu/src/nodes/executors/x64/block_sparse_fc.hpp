@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/brgemm/brgemm.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+// FullyConnected with block sparse constant weights. The weights are split into blocks of N_BLOCK output channels
+// by K_BLOCK input channels and only the blocks with a non zero value are stored, grouped by the rows of N_BLOCK
+// output channels (block compressed sparse row format). An output block is computed by a batch reduce brgemm over
+// the stored blocks of its row, so the amount of work is proportional to the share of the non zero blocks
+class BlockSparseFCExecutor : public Executor {
+public:
+    // A row of a f32 block fills an AVX-512 register, a bf16 block fills an AMX tile
+    static constexpr size_t N_BLOCK = 16;
+    static constexpr size_t K_BLOCK = 32;
+    static constexpr size_t M_BLOCK = 32;
+
+    BlockSparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // creates the brgemm kernels for the number of the rows of the source
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    // Share of the all zero blocks of the weights, 0 if the weights can't be split into the blocks
+    static float blockSparsity(const MemoryCPtr& weights, bool weightsNonTransposed);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    struct Kernel {
+        std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> kernel;
+        char palette[64] = {};
+    };
+
+    [[nodiscard]] std::unique_ptr<Kernel> createKernel(size_t M) const;
+
+    const MemoryArgs& m_memoryArgs;
+    ExecutorContext::CPtr m_context;
+    // precision of the source and the packed weights, the blocks are accumulated in f32
+    ov::element::Type m_computeType;
+    dnnl::impl::cpu::x64::cpu_isa_t m_isa;
+    bool m_withAmx;
+    size_t m_N;
+    size_t m_K;
+    size_t m_M = 0;
+    // [N / N_BLOCK + 1] row offsets, the indices of the stored K blocks and the stored blocks
+    MemoryCPtr m_packedWeights;
+    size_t m_blocksOffset = 0;
+    // the kernels are indexed by the number of the rows they process
+    std::vector<std::unique_ptr<Kernel>> m_kernels;
+    int m_curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
@@ -51,6 +51,9 @@
 #include "transformations/utils/utils.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/block_sparse_fc.hpp"
+#endif
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "openvino/core/shape.hpp"
 #    include "utils/precision_support.h"
@@ -254,6 +257,9 @@ FullyConnected::FullyConnected(const std::shared_ptr<ov::Node>& op, const GraphC
     } else {
         algorithm = Algorithm::FullyConnectedCommon;
     }
+
+    const auto& rtInfo = op->get_rt_info();
+    blockSparseWeightsHint = rtInfo.find("blockSparseWeights") != rtInfo.end();
 }
 
 bool FullyConnected::canBeExecutedInInt8() const {
@@ -469,6 +475,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::brgemm_sparse_avx512,
+        impl_desc_type::brgemm_sparse_avx2,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgconv_avx512_1x1,
         impl_desc_type::brgemm_avx512,
@@ -562,10 +570,51 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     return sparseRate >= minSparseRate;
 }
 
+static bool useBlockSparseWeights([[maybe_unused]] const NodePtr& weightsInput,
+                                  [[maybe_unused]] const bool weightsNonTransposed,
+                                  [[maybe_unused]] const bool blockSparseWeightsHint) {
+#if defined(OPENVINO_ARCH_X86_64)
+    // the share of the zero blocks from which skipping them pays off, the hint marks the weights pruned by blocks
+    const float minBlockSparsity = blockSparseWeightsHint ? 0.3F : 0.5F;
+
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode) {
+        return false;
+    }
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+    if (none_of(weiMemory->getPrecision(), f32, bf16, f16)) {
+        return false;
+    }
+
+    const auto blockSparsity = BlockSparseFCExecutor::blockSparsity(weiMemory, weightsNonTransposed);
+    DEBUG_LOG("Block sparsity = ",
+              blockSparsity * 100,
+              "%, min block sparsity = ",
+              minBlockSparsity * 100,
+              "%, use block sparse weights = ",
+              blockSparsity >= minBlockSparsity);
+
+    return blockSparsity >= minBlockSparsity;
+#else
+    return false;
+#endif
+}
+
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    attrs.blockSparseWeights = algorithm == Algorithm::FullyConnectedCommon && !attrs.sparseWeights &&
+                               !tp_cfg.enable_tensor_parallel &&
+                               useBlockSparseWeights(getParentEdgeAt(WEIGHTS)->getParent(),
+                                                     attrs.weightsNonTransposed,
+                                                     blockSparseWeightsHint);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
 
@@ -121,6 +121,8 @@ private:
     void needSplitMemoryForTensorParallel();
 
     FCAttrs attrs;
+    // the weights are marked as pruned by blocks in the runtime info of the operation
+    bool blockSparseWeightsHint = false;
     MemoryArgs memory;
     ExecutorFactoryPtr<FCAttrs> factory;
     ExecutorPtr executor = nullptr;
@@ -19,8 +19,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
-#include "nodes/common/cpu_memcpy.h"
-#include "nodes/rdft.h"
+#include "nodes/common/fft_plan.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -101,28 +100,6 @@ bool ISTFT::created() const {
 }
 
 namespace {
-void transpose_out4d(const uint8_t* in,
-                     uint8_t* out,
-                     const VectorDims& in_shape,
-                     const VectorDims& out_shape,
-                     size_t elem_size,
-                     const std::shared_ptr<CpuParallel>& cpu_parallel) {
-    const std::vector<size_t> axes_order{0, 2, 1, 3};
-    cpu_parallel->parallel_for3d(
-        out_shape[0],
-        out_shape[1],
-        out_shape[2],
-        [in, out, axes_order, &in_shape, &out_shape, elem_size](size_t i, size_t j, size_t k) {
-            size_t in_indexes[3];
-            in_indexes[axes_order[0]] = i;
-            in_indexes[axes_order[1]] = j;
-            in_indexes[axes_order[2]] = k;
-            size_t in_off = ((in_indexes[0] * in_shape[1] + in_indexes[1]) * in_shape[2] + in_indexes[2]) * in_shape[3];
-            size_t out_off = ((i * out_shape[1] + j) * out_shape[2] + k) * out_shape[3];
-            cpu_memcpy(out + out_off * elem_size, in + in_off * elem_size, out_shape[3] * elem_size);
-        });
-}
-
 void istft_impl(const float* in_data,
                 const float* window,
                 float* final_result,
@@ -133,7 +110,7 @@ void istft_impl(const float* in_data,
                 const int64_t length,
                 const bool center,
                 const bool normalized,
-                std::shared_ptr<RDFTExecutor> rdft_executor,
+                const RealFftPlan& plan,
                 const std::shared_ptr<CpuParallel>& cpu_parallel) {
     const auto is_data_3D = data_shape.size() == 3;
     const size_t frames_axis = 1 + (is_data_3D ? 0 : 1);
@@ -160,7 +137,6 @@ void istft_impl(const float* in_data,
     OPENVINO_ASSERT(fft_results_dim == static_cast<size_t>((frame_size / 2) + 1));
 
     const auto frame_size_dim = static_cast<size_t>(frame_size);
-    const auto fft_out_shape = ov::Shape{fft_results_dim, 2};
 
     const auto window_length = window_shape[0] < frame_size_dim ? window_shape[0] : frame_size_dim;
     std::vector<float> pad_window(frame_size, 0);
@@ -170,15 +146,6 @@ void istft_impl(const float* in_data,
         return win_val * win_val;
     });
 
-    std::vector<float> data_t(shape_size(data_shape));
-    const auto stft_transp_out_shape = ov::Shape{batch_size, num_frames, fft_out_shape[0], fft_out_shape[1]};
-    transpose_out4d(reinterpret_cast<const uint8_t*>(in_data),
-                    reinterpret_cast<uint8_t*>(data_t.data()),
-                    ov::Shape{batch_size, fft_out_shape[0], num_frames, fft_out_shape[1]},
-                    stft_transp_out_shape,
-                    sizeof(float),
-                    cpu_parallel);
-
     // Setting function for the result postprocessing
     const auto norm_window_div = [sqrt_frame_size](float a, float b) {
         if (b != 0.F) {
@@ -199,51 +166,50 @@ void istft_impl(const float* in_data,
         postprocess_func = window_div;
     }
 
-    const auto fft_out_shape_size = shape_size(fft_out_shape);
-    const auto in_batch_single_step = num_frames * fft_out_shape_size;
+    const auto in_batch_single_step = num_frames * fft_results_dim * 2;
     const int64_t margin = center ? (frame_size / 2) : 0;
     const int64_t data_end = signal_length - margin;
     const int64_t copy_end = final_signal_length < data_end ? final_signal_length : data_end;
 
-    std::vector<float> window_sum(batch_size * signal_length);
-    auto twiddles =
-        rdft_executor->generateTwiddles({static_cast<int>(frame_size)}, {frame_size_dim}, {0}, cpu_parallel);
+    // The frames are transformed independently, the bins of a frame are gathered from the [bins, frames, 2] layout
+    std::vector<float> frames(batch_size * num_frames * frame_size_dim);
+    FftWorkspace workspace(fft_results_dim * 2 + plan.scratchSize());
+    cpu_parallel->parallel_for2d(batch_size, num_frames, [&](size_t batch, size_t frame_idx) {
+        float* buffer = workspace.local();
+        const float* in_frame = in_data + batch * in_batch_single_step + frame_idx * 2;
+        for (size_t bin = 0; bin < fft_results_dim; ++bin) {
+            buffer[2 * bin] = in_frame[bin * num_frames * 2];
+            buffer[2 * bin + 1] = in_frame[bin * num_frames * 2 + 1];
+        }
+        float* frame_signal = frames.data() + (batch * num_frames + frame_idx) * frame_size_dim;
+        plan.inverse(buffer, frame_signal, buffer + fft_results_dim * 2);
+        std::transform(frame_signal,
+                       frame_signal + frame_size_dim,
+                       pad_window.begin(),
+                       frame_signal,
+                       std::multiplies<>());
+    });
+
+    // The window sum is the same for all the batches
+    std::vector<float> window_sum(signal_length);
+    for (size_t frame_idx = 0; frame_idx < num_frames; ++frame_idx) {
+        float* window_frame_sum = window_sum.data() + frame_idx * frame_step;
+        for (size_t i = 0; i < frame_size_dim; ++i) {
+            window_frame_sum[i] += pow_window[i];
+        }
+    }
 
     cpu_parallel->parallel_for(batch_size, [&](size_t batch) {
+        float* result = mid_result.data() + (batch * signal_length);
+        // Overlap Add
         for (size_t frame_idx = 0; frame_idx < num_frames; ++frame_idx) {
-            size_t batch_in_start = batch * in_batch_single_step;
-            size_t batch_out_start = batch * signal_length;
-
-            const auto in_frame_start = batch_in_start + frame_idx * fft_out_shape_size;
-            const auto out_frame_start = batch_out_start + frame_idx * frame_step;
-
-            std::vector<float> frame_signal(frame_size);
-            rdft_executor->execute(data_t.data() + in_frame_start,
-                                   frame_signal.data(),
-                                   twiddles,
-                                   1,
-                                   {0},
-                                   {static_cast<int>(frame_size)},
-                                   {frame_size_dim},
-                                   {frame_size_dim},
-                                   {1},
-                                   {1},
-                                   cpu_parallel);
-
-            // Overlap Add
-            float* mid_result_sum = mid_result.data() + out_frame_start;
-            float* window_frame_sum = window_sum.data() + out_frame_start;
-            for (size_t i = 0; i < frame_signal.size(); ++i) {
-                mid_result_sum[i] += frame_signal[i] * pad_window[i];
-                window_frame_sum[i] += pow_window[i];
+            const float* frame_signal = frames.data() + (batch * num_frames + frame_idx) * frame_size_dim;
+            float* mid_result_sum = result + frame_idx * frame_step;
+            for (size_t i = 0; i < frame_size_dim; ++i) {
+                mid_result_sum[i] += frame_signal[i];
             }
         }
-        float* result = mid_result.data() + (batch * signal_length);
-        std::transform(result,
-                       result + signal_length,
-                       window_sum.begin() + batch * signal_length,
-                       result,
-                       postprocess_func);
+        std::transform(result, result + signal_length, window_sum.begin(), result, postprocess_func);
         auto* const result_start = result + margin;
         std::copy(result_start, result_start + copy_end, final_result + batch * final_signal_length);
     });
@@ -253,6 +219,10 @@ void istft_impl(const float* in_data,
 void ISTFT::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto signal_length =
         m_has_signal_length_input ? (getSrcDataAtPortAs<const int32_t>(SIGNAL_LENGTH_IDX))[0] : -1;
+    const auto frame_size = static_cast<size_t>((getSrcDataAtPortAs<const int32_t>(FRAME_SIZE_IDX))[0]);
+    if (!m_fft_plan || m_fft_plan->size() != frame_size) {
+        m_fft_plan = getRealFftPlan(frame_size);
+    }
     istft_impl(getSrcDataAtPortAs<const float>(DATA_IDX),
                getSrcDataAtPortAs<const float>(WINDOW_IDX),
                getDstDataAtPortAs<float>(0),
@@ -263,7 +233,7 @@ void ISTFT::execute([[maybe_unused]] const dnnl::stream& strm) {
                signal_length,
                m_center,
                m_normalized,
-               rdft_executor,
+               *m_fft_plan,
                context->getCpuParallel());
 }
 
@@ -276,18 +246,4 @@ bool ISTFT::needShapeInfer() const {
            (!m_has_signal_length_input && (!m_is_frame_size_const || !m_is_frame_step_const)) || Node::needShapeInfer();
 }
 
-void ISTFT::createPrimitive() {
-    RDFTKey key{};
-    key.isInverse = true;
-    auto buildExecutor = [&](const RDFTKey& key) -> std::shared_ptr<RDFTExecutor> {
-        return RDFTExecutor::build(key.isInverse, getSelectedPrimitiveDescriptor());
-    };
-
-    auto cache = context->getParamsCache();
-    auto result = cache->getOrCreate(key, buildExecutor);
-    rdft_executor = result.first;
-
-    Node::createPrimitive();
-}
-
 }  // namespace ov::intel_cpu::node
@@ -0,0 +1,242 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "logits_sampling.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "kernels/scaled_attn/softmax.hpp"
+#include "node.h"
+#include "nodes/common/radix_select.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/reference/random_uniform.hpp"
+#include "shape_inference/custom/logits_sampling.hpp"
+#include "transformations/cpu_opset/common/op/logits_sampling.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+// Number of the probabilities summed into one block sum, the draws read the block sums and a single block only
+constexpr size_t SAMPLING_BLOCK = 256;
+
+}  // namespace
+
+bool LogitsSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                          std::string& errorMessage) noexcept {
+    try {
+        if (!ov::as_type_ptr<const LogitsSamplingNode>(op)) {
+            errorMessage = "Only LogitsSampling from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+LogitsSampling::LogitsSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, LogitsSamplingShapeInferFactory()) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto& config = ov::as_type_ptr<const LogitsSamplingNode>(op)->get_config();
+    m_scale = config.scale;
+    m_topK = static_cast<size_t>(config.top_k);
+    m_withReplacement = config.with_replacement;
+    m_globalSeed = config.global_seed;
+    m_opSeed = config.op_seed;
+    m_outputPrecision = config.output_type;
+
+    constant = ConstantType::StrictNoConst;
+}
+
+void LogitsSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32}, {LayoutType::ncsp, ov::element::i32}},
+                         {{LayoutType::ncsp, m_outputPrecision}},
+                         ref_any);
+}
+
+bool LogitsSampling::created() const {
+    return getType() == Type::LogitsSampling;
+}
+
+bool LogitsSampling::neverExecute() const {
+    return getSelectedPrimitiveDescriptor()->hasZeroInputDimsAtPort(LOGITS_PORT) ||
+           getSelectedPrimitiveDescriptor()->hasZeroOutputDimsAtPort(OUTPUT_PORT);
+}
+
+bool LogitsSampling::isExecutable() const {
+    return !isInputTensorAtPortEmpty(LOGITS_PORT) && !isOutputTensorAtPortEmpty(OUTPUT_PORT);
+}
+
+void LogitsSampling::execute([[maybe_unused]] const dnnl::stream& strm) {
+    switch (m_outputPrecision) {
+    case ov::element::i32:
+        sample<int32_t>();
+        break;
+    case ov::element::i64:
+        sample<int64_t>();
+        break;
+    default:
+        CPU_NODE_THROW("does not support output type: ", m_outputPrecision);
+    }
+}
+
+void LogitsSampling::executeDynamicImpl(const dnnl::stream& strm) {
+    execute(strm);
+}
+
+template <typename O>
+void LogitsSampling::sample() {
+    const auto& logitsDims = getParentEdgeAt(LOGITS_PORT)->getMemory().getStaticDims();
+    const size_t batch = logitsDims[0];
+    const size_t vocab = logitsDims[1];
+    const size_t samples = getChildEdgeAt(OUTPUT_PORT)->getMemory().getStaticDims()[1];
+    const auto* logits = getSrcDataAtPortAs<const float>(LOGITS_PORT);
+    auto* dst = getDstDataAtPortAs<O>(OUTPUT_PORT);
+
+    // The same uniform values as the reference Multinomial draws: Philox from the initial state, one per output
+    const float zero = 0.F;
+    const float one = 1.F;
+    const std::vector<uint64_t> uniformShape{batch, samples};
+    m_uniform.resize(batch * samples);
+    ov::reference::random_uniform(uniformShape.data(),
+                                  reinterpret_cast<const char*>(&zero),
+                                  reinterpret_cast<const char*>(&one),
+                                  reinterpret_cast<char*>(m_uniform.data()),
+                                  ov::Shape{uniformShape.size()},
+                                  ov::element::f32,
+                                  m_globalSeed,
+                                  m_opSeed,
+                                  {0, 0});
+
+    const size_t width = m_topK != 0 ? std::min(m_topK, vocab) : vocab;
+    const size_t blocks = div_up(width, SAMPLING_BLOCK);
+    m_probs.resize(batch * width);
+    m_blockSums.resize(batch * blocks);
+    if (m_topK != 0) {
+        m_keys.resize(batch * vocab);
+        m_topKeys.resize(batch * width);
+        m_topIdx.resize(batch * width);
+    }
+
+    context->getCpuParallel()->parallel_for(batch, [&](size_t b) {
+        const float* rowLogits = logits + b * vocab;
+        float* probs = m_probs.data() + b * width;
+        int32_t* ids = nullptr;
+        if (m_topK != 0) {
+            uint32_t* keys = m_keys.data() + b * vocab;
+            for (size_t i = 0; i < vocab; i++) {
+                keys[i] = radixKey(rowLogits[i]);
+            }
+            ids = m_topIdx.data() + b * width;
+            radixKeepLargest(
+                keys,
+                vocab,
+                width,
+                [](size_t i) {
+                    return static_cast<int32_t>(i);
+                },
+                m_topKeys.data() + b * width,
+                ids);
+            // the order of TopK sorting by values, the ties are ordered by the index
+            std::sort(ids, ids + width, [keys](int32_t l, int32_t r) {
+                return keys[l] > keys[r] || (keys[l] == keys[r] && l < r);
+            });
+            for (size_t i = 0; i < width; i++) {
+                probs[i] = rowLogits[ids[i]];
+            }
+        } else {
+            std::copy_n(rowLogits, vocab, probs);
+        }
+
+        ov::Extensions::Cpu::XARCH::attn_softmax(probs,
+                                                 probs,
+                                                 m_scale,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 false,
+                                                 width,
+                                                 width,
+                                                 ov::element::f32,
+                                                 ov::element::f32,
+                                                 ov::element::f32,
+                                                 nullptr);
+        drawSamples(probs,
+                    m_blockSums.data() + b * blocks,
+                    width,
+                    ids,
+                    m_uniform.data() + b * samples,
+                    samples,
+                    dst + b * samples);
+    });
+}
+
+template <typename O>
+void LogitsSampling::drawSamples(float* probs,
+                                 float* blockSums,
+                                 size_t width,
+                                 const int32_t* ids,
+                                 const float* uniform,
+                                 size_t samples,
+                                 O* dst) const {
+    const size_t blocks = div_up(width, SAMPLING_BLOCK);
+    auto blockSum = [&](size_t block) {
+        const size_t begin = block * SAMPLING_BLOCK;
+        return std::accumulate(probs + begin, probs + std::min(begin + SAMPLING_BLOCK, width), 0.F);
+    };
+    for (size_t block = 0; block < blocks; block++) {
+        blockSums[block] = blockSum(block);
+    }
+
+    for (size_t s = 0; s < samples; s++) {
+        // the first position whose inclusive cumulative sum reaches the uniform value scaled by the total, as the cdf
+        // search of Multinomial does
+        const float target = uniform[s] * std::accumulate(blockSums, blockSums + blocks, 0.F);
+        float prefix = 0.F;
+        size_t block = 0;
+        while (block + 1 < blocks && prefix + blockSums[block] < target) {
+            prefix += blockSums[block];
+            block++;
+        }
+        const size_t end = std::min((block + 1) * SAMPLING_BLOCK, width);
+        size_t pos = block * SAMPLING_BLOCK;
+        while (pos + 1 < end && prefix + probs[pos] < target) {
+            prefix += probs[pos];
+            pos++;
+        }
+        dst[s] = static_cast<O>(ids != nullptr ? static_cast<size_t>(ids[pos]) : pos);
+
+        // without replacement the drawn class is removed and the rest are renormalized by the next total
+        if (!m_withReplacement) {
+            probs[pos] = 0.F;
+            blockSums[block] = blockSum(block);
+        }
+    }
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::node {
+
+// Samples the token ids from the logits in one pass per batch row: the scaled logits (or the top_k largest of them)
+// are normalized in place by the vectorized softmax kernel and the draws search the block sums of the probabilities
+// before the probabilities of a single block. The uniform values are generated by the Philox generator of the
+// reference Multinomial, so the fused graph keeps the seeded results of the original one
+class LogitsSampling : public Node {
+public:
+    LogitsSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool needPrepareParams() const override {
+        return false;
+    }
+    [[nodiscard]] bool neverExecute() const override;
+    [[nodiscard]] bool isExecutable() const override;
+    [[nodiscard]] bool canBeInPlace() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(const dnnl::stream& strm) override;
+
+private:
+    static constexpr size_t LOGITS_PORT = 0LU;
+    static constexpr size_t NUM_SAMPLES_PORT = 1LU;
+    static constexpr size_t OUTPUT_PORT = 0LU;
+
+    template <typename O>
+    void sample();
+
+    // Draws the samples from the probabilities of a row, ids maps the positions to the output values if not null
+    template <typename O>
+    void drawSamples(float* probs,
+                     float* blockSums,
+                     size_t width,
+                     const int32_t* ids,
+                     const float* uniform,
+                     size_t samples,
+                     O* dst) const;
+
+    float m_scale = 1.F;
+    size_t m_topK = 0;
+    bool m_withReplacement = false;
+    uint64_t m_globalSeed = 0;
+    uint64_t m_opSeed = 0;
+    ov::element::Type m_outputPrecision;
+
+    std::vector<float> m_uniform;
+    std::vector<float> m_probs;
+    std::vector<float> m_blockSums;
+    std::vector<uint32_t> m_keys;
+    std::vector<uint32_t> m_topKeys;
+    std::vector<int32_t> m_topIdx;
+};
+
+}  // namespace ov::intel_cpu::node
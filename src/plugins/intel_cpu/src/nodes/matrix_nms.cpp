@@ -8,7 +8,6 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,6 +18,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_engine.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/enum_names.hpp"
 #include "openvino/core/except.hpp"
@@ -193,26 +193,24 @@ size_t MatrixNms::nmsMatrix(const float* boxesData,
                             BoxInfo* filterBoxes,
                             const int64_t batchIdx,
                             const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
-    int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
-    if (originalSize <= 0) {
-        return 0;
+    std::vector<NmsCandidate> candidates;
+    candidates.reserve(m_numBoxes);
+    for (size_t i = 0; i < m_numBoxes; i++) {
+        if (scoresData[i] > m_scoreThreshold) {
+            candidates.emplace_back(scoresData[i], static_cast<int>(i));
+        }
     }
-    if (m_nmsTopk > -1 && originalSize > m_nmsTopk) {
-        originalSize = m_nmsTopk;
+    if (candidates.empty()) {
+        return 0;
     }
+    nmsSelectTopK(candidates, m_nmsTopk > -1 ? static_cast<size_t>(m_nmsTopk) : candidates.size());
 
-    std::partial_sort(candidateIndex.begin(),
-                      candidateIndex.begin() + originalSize,
-                      end,
-                      [&scoresData](int32_t a, int32_t b) {
-                          return scoresData[a] > scoresData[b];
-                      });
+    int64_t numDet = 0;
+    const auto originalSize = static_cast<int64_t>(candidates.size());
+    std::vector<int32_t> candidateIndex(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        candidateIndex[i] = candidates[i].second;
+    }
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
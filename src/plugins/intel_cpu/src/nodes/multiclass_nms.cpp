@@ -23,6 +23,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_engine.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -628,49 +629,32 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* scoresPtr =
                 slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            std::vector<NmsCandidate> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
             for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
                 if (scoresPtr[box_idx] >= m_scoreThreshold) {  // align with ref
                     sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
                 }
             }
+            // only the nms_top_k best boxes are the candidates
+            nmsSelectTopK(sorted_boxes, static_cast<size_t>(m_nmsRealTopk));
+
+            // box format: y1, x1, y2, x2
+            const auto norm = static_cast<float>(!m_normalized);
+            GreedyNms nms(m_iouThreshold, true, norm);
+            nms.resize(sorted_boxes.size());
+            for (size_t i = 0; i < sorted_boxes.size(); i++) {
+                const float* box = &boxesPtr[sorted_boxes[i].second * 4];
+                nms.setBox(i, box[1], box[0], box[3], box[2], (box[2] - box[0] + norm) * (box[3] - box[1] + norm));
+            }
+            const auto& kept = nms.run(sorted_boxes.size());
 
-            int io_selection_size = 0;
-            if (!sorted_boxes.empty()) {
-                parallel_sort(sorted_boxes.begin(),
-                              sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                              });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] =
-                    filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                                                          &boxesPtr[m_filtBoxes[offset + idx].box_index * 4],
-                                                          m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+            for (size_t i = 0; i < kept.size(); i++) {
+                const auto& box = sorted_boxes[kept[i]];
+                m_filtBoxes[offset + i] = filteredBoxes(box.first, batch_idx, class_idx, box.second);
             }
-            m_numFiltBox[batch_idx][class_idx] = io_selection_size;
+            m_numFiltBox[batch_idx][class_idx] = kept.size();
         }
     });
 }
@@ -27,6 +27,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_engine.h"
 #include "nodes/kernels/x64/non_max_suppression.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -34,6 +35,7 @@
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/nms_rotated.hpp"
 #include "openvino/op/non_max_suppression.hpp"
 #include "ov_ops/nms_ie_internal.hpp"
@@ -129,6 +131,13 @@ NonMaxSuppression::NonMaxSuppression(const std::shared_ptr<ov::Node>& op, const
     for (size_t i = 0LU; i < op->get_output_size(); i++) {
         m_defined_outputs[i] = !op->get_output_target_inputs(i).empty();
     }
+
+    if (op->get_input_size() <= NMS_SOFT_NMS_SIGMA) {
+        m_hard_nms_only = true;
+    } else if (const auto sigma =
+                   as_type_ptr<const op::v0::Constant>(op->get_input_node_shared_ptr(NMS_SOFT_NMS_SIGMA))) {
+        m_hard_nms_only = sigma->cast_vector<float>()[0] == 0.F;
+    }
 }
 
 void NonMaxSuppression::initSupportedPrimitiveDescriptors() {
@@ -175,8 +184,10 @@ void NonMaxSuppression::initSupportedPrimitiveDescriptors() {
     using namespace dnnl::impl::cpu;
 
     // As only FP32 and ncsp is supported, and kernel is shape agnostic, we can create here. There is no need to
-    // recompilation.
-    createJitKernel();
+    // recompilation. The kernel is used only by the soft NMS, the hard one is executed by GreedyNms.
+    if (!m_hard_nms_only) {
+        createJitKernel();
+    }
 
     x64::cpu_isa_t actual_isa = x64::isa_undef;
     if (m_jit_kernel) {
@@ -518,7 +529,6 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
                                             const VectorDims& scoresStrides,
                                             std::vector<FilteredBox>& filtBoxes) {
     const auto& cpu_parallel = context->getCpuParallel();
-    auto max_out_box = static_cast<int>(m_output_boxes_per_class);
     cpu_parallel->parallel_for2d(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
         const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
@@ -531,90 +541,44 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
             }
         }
 
-        int io_selection_size = 0;
-        const size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0LU) {
-            parallel_sort(sorted_boxes.begin(),
-                          sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
-            filtBoxes[offset + 0] = FilteredBox(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            if (sortedBoxSize > 1LU) {
-                if (m_jit_kernel) {
-#if defined(OPENVINO_ARCH_X86_64)
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0F);
-
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * m_coord_num];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 3];
-
-                    auto arg = kernel::NmsCallArgs();
-                    arg.iou_threshold = (&m_iou_threshold);
-                    arg.score_threshold = (&m_score_threshold);
-                    arg.scale = (&m_scale);
-                    // box start index do not change for hard supresion
-                    arg.selected_boxes_coord[0] = static_cast<float*>(boxCoord0.data());
-                    arg.selected_boxes_coord[1] = static_cast<float*>(boxCoord1.data());
-                    arg.selected_boxes_coord[2] = static_cast<float*>(boxCoord2.data());
-                    arg.selected_boxes_coord[3] = static_cast<float*>(boxCoord3.data());
-
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
-                         candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = (&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num]);
-                        arg.candidate_status = (&candidateStatus);
-                        (*m_jit_kernel)(&arg);
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num];
-                            boxCoord1[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 1];
-                            boxCoord2[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 2];
-                            boxCoord3[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 3];
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
-#endif  // OPENVINO_ARCH_X86_64
-                } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
-                         candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(
-                                &boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * m_coord_num]);
-                            if (iou >= m_iou_threshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
-
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
-                }
+        // the whole candidate list is ordered, since the suppressed boxes are replaced by the following ones
+        parallel_sort(sorted_boxes.begin(),
+                      sorted_boxes.end(),
+                      [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                          return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                      });
+
+        GreedyNms nms(m_iou_threshold, true);
+        nms.resize(sorted_boxes.size());
+        for (size_t i = 0; i < sorted_boxes.size(); i++) {
+            const float* box = &boxesPtr[sorted_boxes[i].second * m_coord_num];
+            float xMin = 0.F;
+            float yMin = 0.F;
+            float xMax = 0.F;
+            float yMax = 0.F;
+            if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+                // box format: x_center, y_center, width, height
+                xMin = box[0] - box[2] / 2.F;
+                yMin = box[1] - box[3] / 2.F;
+                xMax = box[0] + box[2] / 2.F;
+                yMax = box[1] + box[3] / 2.F;
+            } else {
+                // box format: y1, x1, y2, x2
+                xMin = (std::min)(box[1], box[3]);
+                yMin = (std::min)(box[0], box[2]);
+                xMax = (std::max)(box[1], box[3]);
+                yMax = (std::max)(box[0], box[2]);
             }
+            nms.setBox(i, xMin, yMin, xMax, yMax, (yMax - yMin) * (xMax - xMin));
         }
+        const auto& kept = nms.run(m_output_boxes_per_class);
 
-        m_num_filtered_boxes[batch_idx][class_idx] = io_selection_size;
+        const size_t offset = (batch_idx * m_classes_num + class_idx) * m_output_boxes_per_class;
+        for (size_t i = 0; i < kept.size(); i++) {
+            const auto& box = sorted_boxes[kept[i]];
+            filtBoxes[offset + i] = FilteredBox(box.first, batch_idx, class_idx, box.second);
+        }
+        m_num_filtered_boxes[batch_idx][class_idx] = kept.size();
     });
 }
 
@@ -146,6 +146,8 @@ private:
     float m_scale = 0.F;
     // control placeholder for NMS in new opset.
     bool m_is_soft_suppressed_by_iou = false;
+    // soft_nms_sigma is absent or a zero constant, so the soft NMS is never executed
+    bool m_hard_nms_only = false;
 
     bool m_out_static_shape = false;
 
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/fft_plan.h"
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
@@ -178,6 +179,7 @@ void RDFT::execute([[maybe_unused]] const dnnl::stream& strm) {
     executor->execute(inputPtr,
                       outputPtr,
                       twiddles,
+                      plans,
                       rank,
                       axes,
                       signalSizes,
@@ -238,6 +240,7 @@ void RDFT::prepareParams() {
 
     const auto& outputShape = getChildEdgeAt(0)->getMemory().getStaticDims();
     twiddles = executor->generateTwiddles(signalSizes, outputShape, axes, context->getCpuParallel());
+    plans = executor->generatePlans(signalSizes);
 }
 
 bool RDFT::axesChanged() const {
@@ -322,6 +325,7 @@ static void adjustInputSize(VectorDims& inputShape,
 void RDFTExecutor::execute(float* inputPtr,
                            float* outputPtr,
                            const std::vector<std::vector<float>>& twiddles,
+                           const std::vector<FftPlans>& plans,
                            size_t rank,
                            const std::vector<int>& axes,
                            std::vector<int> signalSizes,
@@ -334,8 +338,11 @@ void RDFTExecutor::execute(float* inputPtr,
 
     if (rank == 1) {
         const auto* twiddlesPtr = twiddles[0].data();
+        std::vector<float> plannedScratch(plannedFftScratchSize(plans[0], signalSizes[0]));
         dftCommon(inputPtr,
                   twiddlesPtr,
+                  plans[0],
+                  plannedScratch.data(),
                   outputPtr,
                   inputShape[0],
                   signalSizes[0],
@@ -349,6 +356,7 @@ void RDFTExecutor::execute(float* inputPtr,
             rdftNd(inputPtr,
                    outputPtr,
                    twiddles,
+                   plans,
                    axes,
                    signalSizes,
                    inputShape,
@@ -360,6 +368,7 @@ void RDFTExecutor::execute(float* inputPtr,
             irdftNd(inputPtr,
                     outputPtr,
                     twiddles,
+                    plans,
                     axes,
                     signalSizes,
                     inputShape,
@@ -598,8 +607,74 @@ void RDFTExecutor::fft(float* input,
     }
 }
 
+size_t RDFTExecutor::plannedFftScratchSize(const FftPlans& plans, size_t signalSize) {
+    if (plans.real) {
+        return signalSize + 2 * (signalSize / 2 + 1) + plans.real->scratchSize();
+    }
+    if (plans.complex) {
+        return 4 * signalSize + plans.complex->scratchSize();
+    }
+    return 0;
+}
+
+void RDFTExecutor::plannedFft(float* input,
+                              float* output,
+                              size_t inputSize,
+                              size_t signalSize,
+                              size_t outputSize,
+                              enum dft_type type,
+                              const FftPlans& plans,
+                              float* scratch,
+                              bool parallelize,
+                              const CpuParallelPtr& cpuParallel) const {
+    // the scratch is reused by the signals, so the padding of a signal is zeroed explicitly
+    if (plans.real) {
+        const size_t spectrumSize = signalSize / 2 + 1;
+        float* signal = scratch;
+        float* spectrum = signal + signalSize;
+        if (type == real_to_complex) {
+            const size_t copied = std::min(inputSize, signalSize);
+            cpu_memcpy(signal, input, copied * sizeof(float));
+            std::fill(signal + copied, signal + signalSize, 0.F);
+            plans.real->forward(signal, spectrum, spectrum + 2 * spectrumSize);
+            cpu_memcpy(output, spectrum, outputSize * complex_type_size<float>());
+        } else {
+            plans.real->inverse(input, output, spectrum + 2 * spectrumSize);
+        }
+        return;
+    }
+
+    OPENVINO_ASSERT(plans.complex, "No FFT plan of size ", signalSize);
+    float* signal = scratch;
+    float* spectrum = signal + 2 * signalSize;
+    size_t copied = std::min(inputSize, signalSize);
+    if (isInverse && inputSize < signalSize) {
+        fftCopyInverseInputData(signal, input, inputSize, signalSize, parallelize, cpuParallel);
+        copied = signalSize;
+    } else if (type == real_to_complex) {
+        fftCopyRealInputData(signal, input, copied, parallelize, cpuParallel);
+    } else {
+        cpu_memcpy(signal, input, copied * complex_type_size<float>());
+    }
+    std::fill(signal + 2 * copied, signal + 2 * signalSize, 0.F);
+    plans.complex->execute(signal, spectrum, spectrum + 2 * signalSize, isInverse);
+
+    const float norm = isInverse ? 1.F / static_cast<float>(signalSize) : 1.F;
+    if (type == complex_to_real) {
+        for (size_t i = 0; i < signalSize; i++) {
+            output[i] = spectrum[2 * i] * norm;
+        }
+    } else {
+        for (size_t i = 0; i < 2 * outputSize; i++) {
+            output[i] = spectrum[i] * norm;
+        }
+    }
+}
+
 void RDFTExecutor::dftCommon(float* inputPtr,
                              const float* twiddlesPtr,
+                             const FftPlans& plans,
+                             float* plannedScratch,
                              float* outputPtr,
                              size_t inputSize,
                              size_t signalSize,
@@ -610,6 +685,17 @@ void RDFTExecutor::dftCommon(float* inputPtr,
                              const CpuParallelPtr& cpuParallel) {
     if (useFFT) {
         fft(inputPtr, twiddlesPtr, outputPtr, inputSize, signalSize, outputSize, type, parallelize, cpuParallel);
+    } else if (signalSize >= FFT_PLAN_MIN_SIZE) {
+        plannedFft(inputPtr,
+                   outputPtr,
+                   inputSize,
+                   signalSize,
+                   outputSize,
+                   type,
+                   plans,
+                   plannedScratch,
+                   parallelize,
+                   cpuParallel);
     } else {
         dft(inputPtr, twiddlesPtr, outputPtr, inputSize, signalSize, outputSize, type, parallelize, cpuParallel);
     }
@@ -619,6 +705,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
                              float* inputPtr,
                              float* outputPtr,
                              const float* twiddlesPtr,
+                             const FftPlans& plans,
                              int axis,
                              size_t signalSize,
                              const VectorDims& inputShape,
@@ -672,17 +759,20 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
     size_t totalWorkSize =
         std::accumulate(iterationRange.begin(), iterationRange.end(), 1, std::multiplies<>()) / iterationRange[axis];
     bool parallelizeOuterAxes = totalWorkSize > signalSize;
+    const size_t plannedScratchSize = plannedFftScratchSize(plans, signalSize);
 
     if (parallelizeOuterAxes) {
+        FftWorkspace workspace(gatherSize + scatterSize + plannedScratchSize);
         cpuParallel->parallel_for(totalWorkSize, [&](size_t i) {
             std::vector<size_t> coords(iterationRange.size(), 0);
-            std::vector<float> gatherScatterBuffer(gatherSize + scatterSize);
-            float* gatherBuffer = gatherScatterBuffer.data();
-            float* scatterBuffer = &gatherScatterBuffer[gatherSize];
+            float* gatherBuffer = workspace.local();
+            float* scatterBuffer = gatherBuffer + gatherSize;
             coordsFromIndex(i, coords, iterationRange, axis);
             gather(gatherBuffer, inputPtr, axis, coords, inputSize, inputStrides);
             dftCommon(gatherBuffer,
                       twiddlesPtr,
+                      plans,
+                      scatterBuffer + scatterSize,
                       scatterBuffer,
                       inputSize,
                       signalSize,
@@ -695,7 +785,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
         });
     } else {
         std::vector<size_t> coords(iterationRange.size(), 0);
-        std::vector<float> gatherScatterBuffer(gatherSize + scatterSize);
+        std::vector<float> gatherScatterBuffer(gatherSize + scatterSize + plannedScratchSize);
         float* gatherBuffer = gatherScatterBuffer.data();
         float* scatterBuffer = &gatherScatterBuffer[gatherSize];
         for (size_t i = 0; i < totalWorkSize; i++) {
@@ -703,6 +793,8 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
             gather(gatherBuffer, inputPtr, axis, coords, inputSize, inputStrides);
             dftCommon(gatherBuffer,
                       twiddlesPtr,
+                      plans,
+                      scatterBuffer + scatterSize,
                       scatterBuffer,
                       inputSize,
                       signalSize,
@@ -720,6 +812,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
 void RDFTExecutor::rdftNd(float* inputPtr,
                           float* outputPtr,
                           const std::vector<std::vector<float>>& twiddles,
+                          const std::vector<FftPlans>& plans,
                           const std::vector<int>& axes,
                           const std::vector<int>& signalSizes,
                           const VectorDims& inputShape,
@@ -733,6 +826,7 @@ void RDFTExecutor::rdftNd(float* inputPtr,
               inputPtr,
               outputPtr,
               twiddles.back().data(),
+              plans.back(),
               axes.back(),
               signalSizes.back(),
               inputShape,
@@ -749,6 +843,7 @@ void RDFTExecutor::rdftNd(float* inputPtr,
                   inputPtr,
                   outputPtr,
                   twiddles[i].data(),
+                  plans[i],
                   axis,
                   signalSizes[i],
                   outputShape,
@@ -764,6 +859,7 @@ void RDFTExecutor::rdftNd(float* inputPtr,
 void RDFTExecutor::irdftNd(float* inputPtr,
                            float* outputPtr,
                            const std::vector<std::vector<float>>& twiddles,
+                           const std::vector<FftPlans>& plans,
                            const std::vector<int>& axes,
                            const std::vector<int>& signalSizes,
                            const VectorDims& inputShape,
@@ -778,6 +874,7 @@ void RDFTExecutor::irdftNd(float* inputPtr,
                   inputPtr,
                   outputPtr,
                   twiddles[0].data(),
+                  plans[0],
                   axes[0],
                   signalSizes[0],
                   inputShape,
@@ -810,6 +907,7 @@ void RDFTExecutor::irdftNd(float* inputPtr,
                   inputPtr,
                   output,
                   twiddles[i].data(),
+                  plans[i],
                   axis,
                   signalSizes[i],
                   inputShape,
@@ -824,6 +922,7 @@ void RDFTExecutor::irdftNd(float* inputPtr,
               inputPtr,
               outputPtr,
               twiddles.back().data(),
+              plans.back(),
               axes.back(),
               signalSizes.back(),
               inputShape,
@@ -854,6 +953,10 @@ std::vector<float> RDFTExecutor::generateTwiddlesCommon(size_t signalSize,
     if (useFFT) {
         return generateTwiddlesFFT(signalSize);
     }
+    if (signalSize >= FFT_PLAN_MIN_SIZE) {
+        // the planned FFT keeps its own twiddles, see generatePlans
+        return {};
+    }
     return generateTwiddlesDFT(signalSize, outputSize, cpuParallel, type);
 }
 
@@ -875,6 +978,22 @@ std::vector<std::vector<float>> RDFTExecutor::generateTwiddles(const std::vector
     }
     return twiddles;
 }
+
+std::vector<RDFTExecutor::FftPlans> RDFTExecutor::generatePlans(const std::vector<int>& signalSizes) {
+    std::vector<FftPlans> plans(signalSizes.size());
+    for (size_t i = 0; i < signalSizes.size(); i++) {
+        const auto signalSize = static_cast<size_t>(signalSizes[i]);
+        if (canUseFFT(signalSize) || signalSize < FFT_PLAN_MIN_SIZE) {
+            continue;
+        }
+        if (i == signalSizes.size() - 1) {
+            plans[i].real = getRealFftPlan(signalSize);
+        } else {
+            plans[i].complex = getFftPlan(signalSize);
+        }
+    }
+    return plans;
+}
 #if defined(OPENVINO_ARCH_X86_64)
 struct RDFTJitExecutor : public RDFTExecutor {
     RDFTJitExecutor(bool inverse, NodeDesc* primDesc) : RDFTExecutor(inverse) {
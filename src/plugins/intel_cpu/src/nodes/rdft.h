@@ -13,6 +13,7 @@
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "kernels/x64/rdft_kernel.hpp"
+#include "nodes/common/fft_plan.h"
 #include "node.h"
 #include "openvino/core/node.hpp"
 
@@ -22,9 +23,18 @@ struct RDFTExecutor {
 public:
     explicit RDFTExecutor(bool inverse) : isInverse(inverse) {}
     virtual ~RDFTExecutor() = default;
+
+    // The shared plans of an axis computed with the planned FFT. The last axis is transformed from or to a one-sided
+    // spectrum with the real plan, the other axes with the complex one
+    struct FftPlans {
+        std::shared_ptr<const FftPlan> complex;
+        std::shared_ptr<const RealFftPlan> real;
+    };
+
     void execute(float* inputPtr,
                  float* outputPtr,
                  const std::vector<std::vector<float>>& twiddles,
+                 const std::vector<FftPlans>& plans,
                  size_t rank,
                  const std::vector<int>& axes,
                  std::vector<int> signalSizes,
@@ -39,6 +49,8 @@ public:
                                                      const std::vector<int>& axes,
                                                      const CpuParallelPtr& cpuParallel);
 
+    std::vector<FftPlans> generatePlans(const std::vector<int>& signalSizes);
+
     static std::shared_ptr<RDFTExecutor> build(bool inverse, NodeDesc* primDesc = nullptr);
 
 protected:
@@ -64,8 +76,23 @@ private:
                      enum dft_type type,
                      bool parallelize,
                      const CpuParallelPtr& cpuParallel);
+    // FFT of a size which is not a power of two, computed with the shared mixed radix plans
+    void plannedFft(float* input,
+                    float* output,
+                    size_t inputSize,
+                    size_t signalSize,
+                    size_t outputSize,
+                    enum dft_type type,
+                    const FftPlans& plans,
+                    float* scratch,
+                    bool parallelize,
+                    const CpuParallelPtr& cpuParallel) const;
+    // Number of floats of the scratch buffer passed to plannedFft
+    static size_t plannedFftScratchSize(const FftPlans& plans, size_t signalSize);
     void dftCommon(float* inputPtr,
                    const float* twiddlesPtr,
+                   const FftPlans& plans,
+                   float* plannedScratch,
                    float* outputPtr,
                    size_t inputSize,
                    size_t signalSize,
@@ -78,6 +105,7 @@ private:
                    float* inputPtr,
                    float* outputPtr,
                    const float* twiddlesPtr,
+                   const FftPlans& plans,
                    int axis,
                    size_t signalSize,
                    const VectorDims& inputShape,
@@ -89,6 +117,7 @@ private:
     void rdftNd(float* inputPtr,
                 float* outputPtr,
                 const std::vector<std::vector<float>>& twiddles,
+                const std::vector<FftPlans>& plans,
                 const std::vector<int>& axes,
                 const std::vector<int>& signalSizes,
                 const VectorDims& inputShape,
@@ -99,6 +128,7 @@ private:
     void irdftNd(float* inputPtr,
                  float* outputPtr,
                  const std::vector<std::vector<float>>& twiddles,
+                 const std::vector<FftPlans>& plans,
                  const std::vector<int>& axes,
                  const std::vector<int>& signalSizes,
                  const VectorDims& inputShape,
@@ -143,6 +173,7 @@ private:
     std::vector<int> axes;
     std::vector<int> signalSizes;
     std::vector<std::vector<float>> twiddles;
+    std::vector<RDFTExecutor::FftPlans> plans;
     std::shared_ptr<RDFTExecutor> executor;
     bool isAxesConstant = false;
     bool isSignalSizesConstant = false;
@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <cmath>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -25,6 +26,7 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
+#include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -1369,6 +1371,12 @@ void RNN::prepareParams() {
     auto dataMemPtr = getSrcMemoryAtPort(0);
     const size_t B = dataMemPtr->getShape().getStaticDims()[0];
     const size_t SL = is_cell ? 1LU : dataMemPtr->getShape().getStaticDims()[1];
+
+    useDirectKernel = B <= directKernelMaxBatch && canUseDirectKernel();
+    if (useDirectKernel) {
+        prepareDirectKernel();
+        return;
+    }
     const Shape shapeS_4D{L, D, B, SC};
 
     inDataDescs[0] =
@@ -1453,6 +1461,11 @@ std::shared_ptr<MemoryDesc> RNN::getDstMemDesc([[maybe_unused]] const dnnl::prim
 }
 
 void RNN::execute(const dnnl::stream& strm) {
+    if (useDirectKernel) {
+        executeDirect();
+        return;
+    }
+
     CPU_NODE_ASSERT(execPtr, "does not have initialized primitive to execute.");
 
     const auto src_data_mem = getSrcMemoryAtPort(0);
@@ -1489,6 +1502,242 @@ void RNN::execute(const dnnl::stream& strm) {
     execPtr->exec(args, strm);
 }
 
+namespace {
+
+inline float sigmoid(float x) {
+    return 1.F / (1.F + std::exp(-x));
+}
+
+inline float activate(dnnl::algorithm alg, float x) {
+    switch (alg) {
+    case dnnl::algorithm::eltwise_logistic:
+        return sigmoid(x);
+    case dnnl::algorithm::eltwise_relu:
+        return std::max(x, 0.F);
+    default:
+        return std::tanh(x);
+    }
+}
+
+// dst += a * src, vectorized by the compiler
+inline void axpy(float* dst, float a, const float* src, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] += a * src[i];
+    }
+}
+
+// Stride of a logical dimension of the memory, the layouts of the RNN ports have no inner blocks
+size_t dimStride(const IMemory& mem, size_t dim) {
+    const auto desc = mem.getDescWithType<BlockedMemoryDesc>();
+    const auto& order = desc->getOrder();
+    const auto& strides = desc->getStrides();
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] == dim) {
+            return strides[i];
+        }
+    }
+    OPENVINO_THROW("RNN memory does not have dimension ", dim);
+}
+
+}  // namespace
+
+bool RNN::canUseDirectKernel() const {
+    if (none_of(cell_type,
+                dnnl::algorithm::vanilla_lstm,
+                dnnl::algorithm::vanilla_gru,
+                dnnl::algorithm::lbr_gru,
+                dnnl::algorithm::vanilla_rnn)) {
+        return false;
+    }
+    if (inDataTypes[xIdx] != memory::data_type::f32 || inDataTypes[hIdx] != memory::data_type::f32 ||
+        (!is_cell && outDataTypes[yIdx] != memory::data_type::f32)) {
+        return false;
+    }
+    return G * SC * SC * sizeof(float) <= directKernelMaxWeightsIterSize;
+}
+
+void RNN::prepareDirectKernel() {
+    if (m_directWeights) {
+        return;
+    }
+
+    auto toF32 = [&](size_t port) {
+        CPU_NODE_ASSERT(getParentEdgeAt(port)->getParent()->getType() == Type::Input,
+                        "expects Constant for port ",
+                        port);
+        const auto blob = static_cast<Input*>(getParentEdgeAt(port)->getParent().get())->getMemoryPtr();
+        std::vector<float> data(blob->getShape().getElementsCount());
+        cpu_convert(blob->getData(), data.data(), blob->getDesc().getPrecision(), ov::element::f32, data.size());
+        return data;
+    };
+
+    m_directBias = toF32(bIdx);
+
+    const size_t GS = G * SC;
+    auto create = [&]() {
+        auto desc = std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{DC + SC, GS}),
+                                                            memory::data_type::f32,
+                                                            memory::format_tag::nc);
+        MemoryPtr mem = std::make_shared<Memory>(getEngine(), desc);
+        auto* dst = mem->getDataAs<float>();
+        const auto w = toF32(wIdx);
+        const auto r = toF32(rIdx);
+        context->getCpuParallel()->parallel_for(GS, [&](size_t o) {
+            for (size_t i = 0; i < DC; i++) {
+                dst[i * GS + o] = w[o * DC + i];
+            }
+            for (size_t i = 0; i < SC; i++) {
+                dst[(DC + i) * GS + o] = r[o * SC + i];
+            }
+        });
+        return mem;
+    };
+
+    if (auto weight_cache = context->getWeightsCache()) {
+        const std::string hash_str = getName() + "_direct_" + std::to_string(DC) + "_" + std::to_string(GS);
+        m_directWeights = MemoryPtr(*weight_cache->findOrCreate(hash_str, create));
+    } else {
+        m_directWeights = create();
+    }
+}
+
+/* The input projection X * W + B of all the time steps is computed first, in parallel over the steps and the batch.
+ * Then every batch row runs through the time steps on a single thread: the product of the hidden state and R is
+ * accumulated into the projected gates row by row of the transposed R, and the gate activations and the state update
+ * are applied in the same pass. So there is no synchronization between the steps, and R, which is small for the
+ * layers taking this path, is read from the cache of the thread at each step.
+ */
+void RNN::executeDirect() {
+    const auto& srcMem = getParentEdgeAt(xIdx)->getMemory();
+    const size_t B = srcMem.getStaticDims()[0];
+    const size_t SL = is_cell ? 1LU : srcMem.getStaticDims()[1];
+    if (B == 0 || SL == 0) {
+        return;
+    }
+    const size_t GS = G * SC;
+    const size_t xBatchStride = dimStride(srcMem, 0);
+    const size_t xTimeStride = is_cell ? 0 : dimStride(srcMem, 1);
+
+    const auto* x = srcMem.getDataAs<const float>();
+    const auto* w = m_directWeights->getDataAs<const float>();
+    const float* r = w + DC * GS;
+
+    const auto& cpu_parallel = context->getCpuParallel();
+    m_directGates.resize(SL * B * GS);
+    cpu_parallel->parallel_for2d(SL, B, [&](size_t t, size_t n) {
+        const float* xt = x + n * xBatchStride + t * xTimeStride;
+        float* gates = m_directGates.data() + (t * B + n) * GS;
+        std::copy_n(m_directBias.data(), GS, gates);
+        for (size_t i = 0; i < DC; i++) {
+            axpy(gates, xt[i], w + i * GS, GS);
+        }
+    });
+
+    const auto& hiMem = getParentEdgeAt(hIdx)->getMemory();
+    const auto& hoMem = getChildEdgeAt(hoIdx)->getMemory();
+    const auto* hi = hiMem.getDataAs<const float>();
+    auto* ho = hoMem.getDataAs<float>();
+    const size_t hiStride = dimStride(hiMem, 0);
+    const size_t hoStride = dimStride(hoMem, 0);
+    const float* ci = nullptr;
+    float* co = nullptr;
+    size_t ciStride = 0;
+    size_t coStride = 0;
+    if (haveCellState(cell_type)) {
+        const auto& ciMem = getParentEdgeAt(cIdx)->getMemory();
+        const auto& coMem = getChildEdgeAt(coIdx)->getMemory();
+        ci = ciMem.getDataAs<const float>();
+        co = coMem.getDataAs<float>();
+        ciStride = dimStride(ciMem, 0);
+        coStride = dimStride(coMem, 0);
+    }
+    float* y = nullptr;
+    size_t yBatchStride = 0;
+    size_t yTimeStride = 0;
+    if (!is_cell) {
+        const auto& yMem = getChildEdgeAt(yIdx)->getMemory();
+        y = yMem.getDataAs<float>();
+        yBatchStride = dimStride(yMem, 0);
+        // [N, D, T, SC] in the native order, [N, T, SC] otherwise
+        yTimeStride = dimStride(yMem, yMem.getStaticDims().size() - 2);
+    }
+
+    const bool reverse = direction == rnn_direction::unidirectional_right2left;
+    const float* recurrentBias = m_directBias.data() + GS;
+    m_directScratch.resize(B * SC);
+    cpu_parallel->parallel_for(B, [&](size_t n) {
+        // the state is updated in place in the output memory
+        float* h = ho + n * hoStride;
+        float* c = co ? co + n * coStride : nullptr;
+        float* tmp = m_directScratch.data() + n * SC;
+        std::copy_n(hi + n * hiStride, SC, h);
+        if (c) {
+            std::copy_n(ci + n * ciStride, SC, c);
+        }
+
+        for (size_t step = 0; step < SL; step++) {
+            const size_t t = reverse ? SL - 1 - step : step;
+            float* gates = m_directGates.data() + (t * B + n) * GS;
+            switch (cell_type) {
+            case dnnl::algorithm::vanilla_lstm:
+                // OV gate order: f, i, c, o
+                for (size_t k = 0; k < SC; k++) {
+                    axpy(gates, h[k], r + k * GS, GS);
+                }
+                for (size_t j = 0; j < SC; j++) {
+                    const float f = sigmoid(gates[j]);
+                    const float i = sigmoid(gates[SC + j]);
+                    const float g = std::tanh(gates[2 * SC + j]);
+                    const float o = sigmoid(gates[3 * SC + j]);
+                    c[j] = f * c[j] + i * g;
+                    h[j] = o * std::tanh(c[j]);
+                }
+                break;
+            case dnnl::algorithm::vanilla_gru:
+                // OV gate order: z, r, h. The candidate is computed from the reset state
+                for (size_t k = 0; k < SC; k++) {
+                    axpy(gates, h[k], r + k * GS, 2 * SC);
+                }
+                for (size_t j = 0; j < SC; j++) {
+                    gates[j] = sigmoid(gates[j]);
+                    tmp[j] = sigmoid(gates[SC + j]) * h[j];
+                }
+                for (size_t k = 0; k < SC; k++) {
+                    axpy(gates + 2 * SC, tmp[k], r + k * GS + 2 * SC, SC);
+                }
+                for (size_t j = 0; j < SC; j++) {
+                    const float z = gates[j];
+                    h[j] = (1.F - z) * std::tanh(gates[2 * SC + j]) + z * h[j];
+                }
+                break;
+            case dnnl::algorithm::lbr_gru:
+                // the reset gate is applied to the recurrent part of the candidate, which has its own bias
+                std::copy_n(recurrentBias, SC, tmp);
+                for (size_t k = 0; k < SC; k++) {
+                    axpy(gates, h[k], r + k * GS, 2 * SC);
+                    axpy(tmp, h[k], r + k * GS + 2 * SC, SC);
+                }
+                for (size_t j = 0; j < SC; j++) {
+                    const float z = sigmoid(gates[j]);
+                    const float rs = sigmoid(gates[SC + j]);
+                    h[j] = (1.F - z) * std::tanh(gates[2 * SC + j] + rs * tmp[j]) + z * h[j];
+                }
+                break;
+            default:
+                for (size_t k = 0; k < SC; k++) {
+                    axpy(gates, h[k], r + k * GS, GS);
+                }
+                for (size_t j = 0; j < SC; j++) {
+                    h[j] = activate(cell_act, gates[j]);
+                }
+            }
+            if (y) {
+                std::copy_n(h, SC, y + n * yBatchStride + t * yTimeStride);
+            }
+        }
+    });
+}
+
 void RNN::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
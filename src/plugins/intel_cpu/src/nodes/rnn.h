@@ -72,6 +72,10 @@ private:
 
     void copyWeightsData();
 
+    [[nodiscard]] bool canUseDirectKernel() const;
+    void prepareDirectKernel();
+    void executeDirect();
+
     void prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) override;
     class RnnDnnlExecutor : public DnnlExecutorLegacy {
     public:
@@ -164,6 +168,17 @@ private:
     float inputShift = 0.F;
     std::vector<float> weightsScales;
 
+    /** Small f32 layers are executed by executeDirect instead of the oneDNN primitive.
+     *  The recurrent weights of such a layer fit into L2 and stay there for all the time steps */
+    bool useDirectKernel = false;
+    static constexpr size_t directKernelMaxWeightsIterSize = 256LU * 1024LU;
+    static constexpr size_t directKernelMaxBatch = optimalBatchSize;
+    // [DC + SC, G * SC]: transposed W and R in the OV gate order
+    MemoryPtr m_directWeights;
+    std::vector<float> m_directBias;
+    std::vector<float> m_directGates;
+    std::vector<float> m_directScratch;
+
     const uint64_t* m_gate_map = nullptr;
     // Need to reorder from the initial memory descs due to limited Reorders set.
     MemoryPtr m_initial_weights[3] = {nullptr, nullptr, nullptr};
@@ -33,6 +33,10 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
+    [[nodiscard]] size_t getAxis() const {
+        return axis;
+    }
+
 private:
     using executorPtr = std::shared_ptr<DnnlExecutorLegacy>;
     executorPtr execPtr = nullptr;
@@ -17,15 +17,12 @@
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
-#include "memory_desc/cpu_blocked_memory_desc.h"
-#include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
 #include "nodes/common/cpu_memcpy.h"
-#include "nodes/rdft.h"
+#include "nodes/common/fft_plan.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
-#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
@@ -92,30 +89,6 @@ bool STFT::created() const {
     return getType() == Type::STFT;
 }
 
-namespace {
-void transpose_out4d(const uint8_t* in,
-                     uint8_t* out,
-                     const VectorDims& in_shape,
-                     const VectorDims& out_shape,
-                     size_t elem_size,
-                     const std::shared_ptr<CpuParallel>& cpu_parallel) {
-    const std::vector<size_t> axes_order{0, 2, 1, 3};
-    cpu_parallel->parallel_for3d(
-        out_shape[0],
-        out_shape[1],
-        out_shape[2],
-        [in, out, axes_order, &in_shape, &out_shape, elem_size](size_t i, size_t j, size_t k) {
-            size_t in_indexes[3];
-            in_indexes[axes_order[0]] = i;
-            in_indexes[axes_order[1]] = j;
-            in_indexes[axes_order[2]] = k;
-            size_t in_off = ((in_indexes[0] * in_shape[1] + in_indexes[1]) * in_shape[2] + in_indexes[2]) * in_shape[3];
-            size_t out_off = ((i * out_shape[1] + j) * out_shape[2] + k) * out_shape[3];
-            cpu_memcpy(out + out_off * elem_size, in + in_off * elem_size, out_shape[3] * elem_size);
-        });
-}
-}  // namespace
-
 void STFT::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto& cpu_parallel = context->getCpuParallel();
     const auto* signal = getSrcDataAtPortAs<const float>(DATA_IDX);
@@ -132,8 +105,7 @@ void STFT::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto signal_length = signal_shape[signal_axis];
     const auto num_frames = static_cast<size_t>((signal_length - frame_size) / frame_step) + 1;
     const auto frame_size_dim = static_cast<size_t>(frame_size);
-    const auto fft_out_shape = VectorDims{static_cast<size_t>((frame_size_dim / 2) + 1), 2};
-    const auto fft_out_shape_size = shape_size(fft_out_shape);
+    const auto num_bins = (frame_size_dim / 2) + 1;
 
     const auto window_length = window_shape[0] < frame_size_dim ? window_shape[0] : frame_size_dim;
     std::vector<float> pad_window(frame_size, 0);
@@ -141,51 +113,33 @@ void STFT::execute([[maybe_unused]] const dnnl::stream& strm) {
                         window,
                         sizeof(float) * window_shape[0]);
 
-    float* dst = rdft_result;
-    const auto stft_shape = VectorDims{batch_size, num_frames, fft_out_shape[0], fft_out_shape[1]};
-    if (m_transpose_frames) {  // Store intermediate results
-        MemoryPtr dst_mem =
-            getScratchPadMem(std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{stft_shape}));
-        dst = dst_mem->getDataAs<float>();
+    // The output is [batch, frames, bins, 2], or [batch, bins, frames, 2] with the transposed frames, so the spectrum
+    // of a frame is written with the bin stride of the layout directly
+    const size_t bin_stride = m_transpose_frames ? num_frames * 2 : 2;
+    const size_t frame_stride = m_transpose_frames ? 2 : num_bins * 2;
+    if (!m_fft_plan || m_fft_plan->size() != frame_size_dim) {
+        m_fft_plan = getRealFftPlan(frame_size_dim);
     }
+    const auto& plan = *m_fft_plan;
+    FftWorkspace workspace(frame_size_dim + num_bins * 2 + plan.scratchSize());
 
     cpu_parallel->parallel_for2d(batch_size, num_frames, [&](size_t batch, size_t frame_idx) {
-        size_t batch_in_start = batch * signal_length;
-        size_t batch_frames_out = batch * num_frames;
-
-        const auto frame_start = batch_in_start + frame_idx * frame_step;
-        const auto frame_end = frame_start + frame_size;
-        std::vector<float> signal_slice(signal + frame_start, signal + frame_end);
-        std::transform(signal_slice.begin(),
-                       signal_slice.end(),
-                       pad_window.begin(),
-                       signal_slice.begin(),
-                       std::multiplies<>());
-
-        const auto result_idx = (batch_frames_out + frame_idx) * fft_out_shape_size;
-        auto twiddles =
-            rdft_executor->generateTwiddles({static_cast<int>(signal_slice.size())}, fft_out_shape, {0}, cpu_parallel);
-        rdft_executor->execute(signal_slice.data(),
-                               dst + result_idx,
-                               twiddles,
-                               1,
-                               {0},
-                               {static_cast<int>(frame_size)},
-                               {frame_size_dim},
-                               fft_out_shape,
-                               {1},
-                               {2, 1},
-                               cpu_parallel);
+        float* frame = workspace.local();
+        float* spectrum = frame + frame_size_dim;
+        const float* frame_start = signal + batch * signal_length + frame_idx * frame_step;
+        std::transform(frame_start, frame_start + frame_size_dim, pad_window.begin(), frame, std::multiplies<>());
+        plan.forward(frame, spectrum, spectrum + num_bins * 2);
+
+        float* out = rdft_result + batch * num_frames * num_bins * 2 + frame_idx * frame_stride;
+        if (!m_transpose_frames) {
+            std::copy_n(spectrum, num_bins * 2, out);
+            return;
+        }
+        for (size_t bin = 0; bin < num_bins; bin++) {
+            out[bin * bin_stride] = spectrum[2 * bin];
+            out[bin * bin_stride + 1] = spectrum[2 * bin + 1];
+        }
     });
-    if (m_transpose_frames) {
-        const auto stft_transp_out_shape = VectorDims{batch_size, fft_out_shape[0], num_frames, fft_out_shape[1]};
-        transpose_out4d(reinterpret_cast<const uint8_t*>(dst),
-                        reinterpret_cast<uint8_t*>(rdft_result),
-                        stft_shape,
-                        stft_transp_out_shape,
-                        sizeof(float),
-                        cpu_parallel);
-    }
 }
 
 void STFT::executeDynamicImpl(const dnnl::stream& strm) {
@@ -197,18 +151,4 @@ bool STFT::needShapeInfer() const {
     return !both_const || Node::needShapeInfer();
 }
 
-void STFT::createPrimitive() {
-    RDFTKey key{};
-    key.isInverse = false;
-    auto buildExecutor = [&](const RDFTKey& key) -> std::shared_ptr<RDFTExecutor> {
-        return RDFTExecutor::build(key.isInverse, getSelectedPrimitiveDescriptor());
-    };
-
-    auto cache = context->getParamsCache();
-    auto result = cache->getOrCreate(key, buildExecutor);
-    rdft_executor = result.first;
-
-    Node::createPrimitive();
-}
-
 }  // namespace ov::intel_cpu::node
@@ -11,8 +11,8 @@
 
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/common/fft_plan.h"
 #include "openvino/core/node.hpp"
-#include "rdft.h"
 
 namespace ov::intel_cpu::node {
 
@@ -25,7 +25,6 @@ public:
     [[nodiscard]] bool created() const override;
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
     [[nodiscard]] bool needPrepareParams() const override;
-    void createPrimitive() override;
 
     void execute(const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
@@ -40,11 +39,12 @@ private:
     /// STFT params
     bool m_transpose_frames = false;
 
-    // RDFT executor
-    std::shared_ptr<RDFTExecutor> rdft_executor = nullptr;
     bool m_is_frame_size_const = false;
     bool m_is_frame_step_const = false;
 
+    // the shared plan of the frame size
+    std::shared_ptr<const RealFftPlan> m_fft_plan;
+
     // Input indices
     static constexpr size_t DATA_IDX = 0LU;
     static constexpr size_t WINDOW_IDX = 1LU;
@@ -20,7 +20,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_pack.hpp"
-#include "openvino/reference/string_tensor_pack.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -77,11 +76,15 @@ void StringTensorPack::executeDynamicImpl(const dnnl::stream& strm) {
 template <class T_idx>
 void StringTensorPack::executeImpl() {
     const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    ov::reference::string_tensor_pack(getSrcDataAtPortAs<const T_idx>(0),
-                                      getSrcDataAtPortAs<const T_idx>(1),
-                                      getSrcDataAtPortAs<const uint8_t>(2),
-                                      getDstDataAtPortAs<std::string>(0),
-                                      ov::shape_size(data_shape));
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* chars = getSrcDataAtPortAs<const char>(2);
+    auto* strings = getDstDataAtPortAs<std::string>(0);
+    // Each string is allocated separately, so the allocations are spread over the threads
+    const auto& cpu_parallel = context->getCpuParallel();
+    cpu_parallel->parallel_for(ov::shape_size(data_shape), [&](size_t i) {
+        strings[i].assign(chars + begins[i], chars + ends[i]);
+    });
 }
 
 namespace {
@@ -4,6 +4,7 @@
 
 #include "string_tensor_unpack.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -11,6 +12,7 @@
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -56,13 +58,26 @@ void StringTensorUnpack::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty()) {
         return;
     }
-    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::string}},
+    std::vector<PortConfigurator> inConfigurators;
+    if (m_packedInput) {
+        inConfigurators = {{LayoutType::ncsp, m_indicesPrecision},
+                           {LayoutType::ncsp, m_indicesPrecision},
+                           {LayoutType::ncsp, ov::element::u8}};
+    } else {
+        inConfigurators = {{LayoutType::ncsp, ov::element::string}};
+    }
+    addSupportedPrimDesc(inConfigurators,
                          {{LayoutType::ncsp, ov::element::i32},
                           {LayoutType::ncsp, ov::element::i32},
                           {LayoutType::ncsp, ov::element::u8}},
                          impl_desc_type::ref);
 }
 
+void StringTensorUnpack::fusePackedInput(ov::element::Type indicesPrecision) {
+    m_packedInput = true;
+    m_indicesPrecision = indicesPrecision;
+}
+
 bool StringTensorUnpack::created() const {
     return getType() == Type::StringTensorUnpack;
 }
@@ -71,20 +86,93 @@ bool StringTensorUnpack::needPrepareParams() const {
     return false;
 }
 
+bool StringTensorUnpack::isExecutable() const {
+    // All the strings of a packed input may be empty, so only the indices are checked
+    return m_packedInput ? !isInputTensorAtPortEmpty(0) : Node::isExecutable();
+}
+
+template <typename T_idx>
+size_t StringTensorUnpack::getPackedCharLength() const {
+    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto symbolsCount = static_cast<T_idx>(ov::shape_size(getSrcMemoryAtPort(2)->getStaticDims()));
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    size_t totalCharLength = 0;
+    for (size_t i = 0; i < stringCount; ++i) {
+        CPU_NODE_ASSERT(begins[i] >= 0 && begins[i] <= ends[i] && ends[i] <= symbolsCount,
+                        "has string ",
+                        i,
+                        " with begin ",
+                        begins[i],
+                        " and end ",
+                        ends[i],
+                        " out of the symbols range [0, ",
+                        symbolsCount,
+                        "]");
+        totalCharLength += static_cast<size_t>(ends[i] - begins[i]);
+    }
+    return totalCharLength;
+}
+
 void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
     const auto& srcMemory = getSrcMemoryAtPort(0);
     const auto& srcDataDims = srcMemory->getStaticDims();
-    const auto& srcData = srcMemory->getDataAs<std::string>();
-    Dim stringCount = std::accumulate(srcDataDims.begin(), srcDataDims.end(), 1, std::multiplies<>());
     size_t totalCharLength = 0;
-    for (Dim i = 0; i < stringCount; ++i) {
-        totalCharLength += srcData[i].length();
+    if (m_packedInput) {
+        totalCharLength = m_indicesPrecision == ov::element::i64 ? getPackedCharLength<int64_t>()
+                                                                 : getPackedCharLength<int32_t>();
+    } else {
+        const auto& srcData = srcMemory->getDataAs<std::string>();
+        Dim stringCount = std::accumulate(srcDataDims.begin(), srcDataDims.end(), 1, std::multiplies<>());
+        for (Dim i = 0; i < stringCount; ++i) {
+            totalCharLength += srcData[i].length();
+        }
     }
     redefineOutputMemory({srcDataDims, srcDataDims, {totalCharLength}});
     execute(strm);
 }
 
+template <typename T_idx>
+void StringTensorUnpack::executePacked() {
+    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* symbols = getSrcDataAtPortAs<const uint8_t>(2);
+    auto* outBegins = getDstDataAtPortAs<int32_t>(0);
+    auto* outEnds = getDstDataAtPortAs<int32_t>(1);
+    auto* outSymbols = getDstDataAtPortAs<uint8_t>(2);
+
+    int32_t offset = 0;
+    bool contiguous = true;
+    for (size_t i = 0; i < stringCount; ++i) {
+        contiguous = contiguous && begins[i] - begins[0] == offset;
+        outBegins[i] = offset;
+        offset += static_cast<int32_t>(ends[i] - begins[i]);
+        outEnds[i] = offset;
+    }
+    if (offset == 0) {
+        return;
+    }
+    // Strings packed back to back, e.g. unpacked before, are copied at once
+    if (contiguous) {
+        std::copy_n(symbols + begins[0], offset, outSymbols);
+        return;
+    }
+    const auto& cpu_parallel = context->getCpuParallel();
+    cpu_parallel->parallel_for(stringCount, [&](size_t i) {
+        std::copy_n(symbols + begins[i], outEnds[i] - outBegins[i], outSymbols + outBegins[i]);
+    });
+}
+
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_packedInput) {
+        if (m_indicesPrecision == ov::element::i64) {
+            executePacked<int64_t>();
+        } else {
+            executePacked<int32_t>();
+        }
+        return;
+    }
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
     ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
                                         getDstDataAtPortAs<int32_t>(0),
@@ -11,6 +11,7 @@
 #include "graph_context.h"
 #include "node.h"
 #include "openvino/core/node.hpp"
+#include "openvino/core/type/element_type.hpp"
 
 namespace ov::intel_cpu::node {
 
@@ -25,6 +26,23 @@ public:
     [[nodiscard]] bool created() const override;
     [[nodiscard]] bool needPrepareParams() const override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
+    [[nodiscard]] bool isExecutable() const override;
+
+    // Makes the node unpack the begins, ends and symbols of a fused StringTensorPack instead of the string tensor, so
+    // the strings are never materialized
+    void fusePackedInput(ov::element::Type indicesPrecision);
+    [[nodiscard]] bool withPackedInput() const {
+        return m_packedInput;
+    }
+
+private:
+    template <typename T_idx>
+    size_t getPackedCharLength() const;
+    template <typename T_idx>
+    void executePacked();
+
+    bool m_packedInput = false;
+    ov::element::Type m_indicesPrecision = ov::element::dynamic;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -11,12 +11,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -27,10 +29,12 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/radix_select.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/topk.hpp"
@@ -1878,6 +1882,24 @@ private:
 };
 #endif
 
+namespace {
+
+// Rows at least this long are split between the threads and reduced with the radix select
+constexpr size_t RADIX_SELECT_MIN_AXIS_DIM = 16384;
+// Minimal number of the row elements handled by one thread in the radix select
+constexpr size_t RADIX_SELECT_MIN_CHUNK = 4096;
+
+template <typename T>
+uint32_t topk_key(T value) {
+    if constexpr (std::is_integral_v<T>) {
+        return radixKey(static_cast<int32_t>(value));
+    } else {
+        return radixKey(static_cast<float>(value));
+    }
+}
+
+}  // namespace
+
 bool TopK::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (none_of(op->get_type_info(),
@@ -2011,6 +2033,10 @@ void TopK::initSupportedPrimitiveDescriptors() {
             dataPrecision = ov::element::i32;
         }
     }
+    // the fused softmax is computed over the contiguous rows of the values
+    if (with_softmax) {
+        dataPrecision = ov::element::f32;
+    }
 
     std::vector<std::pair<LayoutType, LayoutType>> dataFomats{{LayoutType::ncsp, LayoutType::ncsp},
 #if defined(OPENVINO_ARCH_X86_64)
@@ -2020,6 +2046,10 @@ void TopK::initSupportedPrimitiveDescriptors() {
 #endif
     };
 
+    if (with_softmax) {
+        dataFomats.resize(1);
+    }
+
     for (const auto& df : dataFomats) {
         addSupportedPrimDesc({{df.first, dataPrecision}, {LayoutType::ncsp, ov::element::i32}},
                              {{df.second, dataPrecision}, {df.second, ov::element::i32}},
@@ -2086,6 +2116,11 @@ void TopK::prepareParams() {
         top_k = getSrcDataAtPortAs<int>(TOPK_K)[0];
     }
 
+    // The JIT kernels sort a row in a single thread, which is slow for the long rows (e.g. the vocabulary sized logits)
+    // when there are fewer rows than threads
+    radix_select = layout == TopKLayoutType::topk_ncsp && axis == static_cast<int>(src_dims.size() - 1) &&
+                   src_dims[axis] >= RADIX_SELECT_MIN_AXIS_DIM;
+
     if (jit_mode) {
         if (!preset_params_done) {
             preset_params();
@@ -2232,7 +2267,36 @@ void TopK::execute([[maybe_unused]] const dnnl::stream& strm) {
     auto* dst_data = dstMemPtr->getDataAs<uint8_t>();
     auto* dst_idx = dstIndexesMemPtr->getDataAs<uint8_t>();
 
-    if (jit_mode) {
+    if (radix_select) {
+        auto* out_idx_ptr = reinterpret_cast<int32_t*>(dst_idx);
+        switch (srcMemPtr->getDesc().getPrecision()) {
+        case ov::element::f32:
+            topk_radix_process(reinterpret_cast<const float*>(src_data),
+                               reinterpret_cast<float*>(dst_data),
+                               out_idx_ptr);
+            break;
+        case ov::element::bf16:
+            topk_radix_process(reinterpret_cast<const ov::bfloat16*>(src_data),
+                               reinterpret_cast<ov::bfloat16*>(dst_data),
+                               out_idx_ptr);
+            break;
+        case ov::element::i32:
+            topk_radix_process(reinterpret_cast<const int32_t*>(src_data),
+                               reinterpret_cast<int32_t*>(dst_data),
+                               out_idx_ptr);
+            break;
+        case ov::element::i8:
+            topk_radix_process(reinterpret_cast<const int8_t*>(src_data),
+                               reinterpret_cast<int8_t*>(dst_data),
+                               out_idx_ptr);
+            break;
+        case ov::element::u8:
+            topk_radix_process(src_data, dst_data, out_idx_ptr);
+            break;
+        default:
+            CPU_NODE_THROW("has unsupported precision: ", srcMemPtr->getDesc().getPrecision());
+        }
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2244,6 +2308,123 @@ void TopK::execute([[maybe_unused]] const dnnl::stream& strm) {
             CPU_NODE_THROW("only support plain layout on machine w/o sse42.");
         }
     }
+
+    if (with_softmax) {
+        softmax_process(reinterpret_cast<float*>(dst_data));
+    }
+}
+
+void TopK::fuseSoftmax(float scale) {
+    with_softmax = true;
+    softmax_scale = scale;
+}
+
+// The row is split into chunks processed by different threads, each chunk keeps its top_k elements and the
+// candidates of all the chunks are reduced to the top_k elements of the row. Both steps are radix selects, so the
+// elements are sorted only when they are written to the output
+template <typename T>
+void TopK::topk_radix_process(const T* in_ptr, T* out_ptr, int32_t* out_idx_ptr) {
+    const auto& cpu_parallel = context->getCpuParallel();
+    const auto rows = static_cast<size_t>(count(src_dims, 0, axis));
+    const size_t row_len = src_dims[axis];
+    const auto k = static_cast<size_t>(top_k);
+    if (rows == 0 || k == 0) {
+        return;
+    }
+
+    const auto threads = static_cast<size_t>(cpu_parallel->get_num_threads());
+    size_t chunks = 1;
+    if (rows < threads) {
+        chunks = std::min(div_up(threads, rows), std::max(row_len / std::max(RADIX_SELECT_MIN_CHUNK, k), size_t{1}));
+    }
+    const size_t chunk_len = div_up(row_len, chunks);
+    vec_radix_keys.resize(rows * chunks * k);
+    vec_radix_idx.resize(rows * chunks * k);
+    vec_radix_count.resize(rows * chunks);
+
+    cpu_parallel->parallel_for2d(rows, chunks, [&](size_t row, size_t chunk) {
+        const size_t begin = std::min(chunk * chunk_len, row_len);
+        const size_t end = std::min(begin + chunk_len, row_len);
+        const T* src = in_ptr + row * row_len + begin;
+        std::vector<uint32_t> keys(end - begin);
+        for (size_t i = 0; i < keys.size(); i++) {
+            const uint32_t key = topk_key(src[i]);
+            keys[i] = mode_max ? key : ~key;
+        }
+        const size_t offset = (row * chunks + chunk) * k;
+        vec_radix_count[row * chunks + chunk] = radixKeepLargest(
+            keys.data(),
+            keys.size(),
+            k,
+            [begin](size_t i) {
+                return static_cast<int32_t>(begin + i);
+            },
+            vec_radix_keys.data() + offset,
+            vec_radix_idx.data() + offset);
+    });
+
+    cpu_parallel->parallel_for(rows, [&](size_t row) {
+        uint32_t* keys = vec_radix_keys.data() + row * chunks * k;
+        int32_t* idx = vec_radix_idx.data() + row * chunks * k;
+        size_t candidates = 0;
+        for (size_t chunk = 0; chunk < chunks; chunk++) {
+            const size_t chunk_count = vec_radix_count[row * chunks + chunk];
+            std::copy_n(keys + chunk * k, chunk_count, keys + candidates);
+            std::copy_n(idx + chunk * k, chunk_count, idx + candidates);
+            candidates += chunk_count;
+        }
+        if (candidates > k) {
+            radixKeepLargest(
+                keys,
+                candidates,
+                k,
+                [idx](size_t i) {
+                    return idx[i];
+                },
+                keys,
+                idx);
+        }
+
+        // the selected elements are in the order of their indices
+        std::vector<size_t> order(k);
+        std::iota(order.begin(), order.end(), 0);
+        if (!sort_index) {
+            std::stable_sort(order.begin(), order.end(), [keys](size_t l, size_t r) {
+                return keys[l] > keys[r];
+            });
+        }
+        const T* src = in_ptr + row * row_len;
+        for (size_t i = 0; i < k; i++) {
+            out_ptr[row * k + i] = src[idx[order[i]]];
+            out_idx_ptr[row * k + i] = idx[order[i]];
+        }
+    });
+}
+
+void TopK::softmax_process(float* out_ptr) const {
+    const auto& cpu_parallel = context->getCpuParallel();
+    const auto k = static_cast<size_t>(top_k);
+    if (k == 0) {
+        return;
+    }
+    const size_t rows = std::accumulate(dst_dims.begin(), dst_dims.end(), size_t{1}, std::multiplies<>()) / k;
+    cpu_parallel->parallel_for(rows, [&](size_t row) {
+        float* values = out_ptr + row * k;
+        float max = std::numeric_limits<float>::lowest();
+        for (size_t i = 0; i < k; i++) {
+            values[i] *= softmax_scale;
+            max = std::max(max, values[i]);
+        }
+        float sum = 0.F;
+        for (size_t i = 0; i < k; i++) {
+            values[i] = std::exp(values[i] - max);
+            sum += values[i];
+        }
+        const float norm = 1.F / sum;
+        for (size_t i = 0; i < k; i++) {
+            values[i] *= norm;
+        }
+    });
 }
 
 void TopK::topk_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr) {
@@ -99,7 +99,19 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
+    [[nodiscard]] int getAxis() const {
+        return axis;
+    }
+    // The values output is replaced with softmax(scale * values) computed along the topk axis
+    void fuseSoftmax(float scale);
+    [[nodiscard]] bool withSoftmax() const {
+        return with_softmax;
+    }
+
 private:
+    template <typename T>
+    void topk_radix_process(const T* in_ptr, T* out_ptr, int32_t* out_idx_ptr);
+    void softmax_process(float* out_ptr) const;
     void topk_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr);
     void topk_ref(const float* in_ptr, float* out_ptr, int32_t* dst_idx);
     inline void topk_kernel_process(const uint8_t* in_p,
@@ -138,6 +150,9 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    bool radix_select = false;
+    bool with_softmax = false;
+    float softmax_scale = 1.F;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
@@ -152,6 +167,11 @@ private:
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
 
+    // candidates of the row chunks in the radix select
+    std::vector<uint32_t> vec_radix_keys;
+    std::vector<int32_t> vec_radix_idx;
+    std::vector<size_t> vec_radix_count;
+
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel = nullptr;
 };
 
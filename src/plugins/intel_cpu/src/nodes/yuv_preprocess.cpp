@@ -0,0 +1,289 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+struct Rgb {
+    float r;
+    float g;
+    float b;
+};
+
+// The conversion of the ColorConvert node, the values are rounded if the converted image was u8
+template <bool Round>
+inline Rgb yuvToRgb(float y, float u, float v) {
+    const float c = y - 16.F;
+    const float d = u - 128.F;
+    const float e = v - 128.F;
+    auto clip = [](float a) {
+        if constexpr (Round) {
+            a = std::round(a);
+        }
+        return std::min(std::max(a, 0.F), 255.F);
+    };
+    return {clip(1.164F * c + 1.596F * e), clip(1.164F * c - 0.391F * d - 0.813F * e), clip(1.164F * c + 2.018F * d)};
+}
+
+// Pointers to the planes of one image and the offsets of the chroma values of a pixel
+template <typename T>
+struct YuvImage {
+    const T* y;
+    const T* u;
+    const T* v;
+    size_t width;
+    bool i420;
+
+    template <bool Round>
+    [[nodiscard]] Rgb pixel(size_t h, size_t w) const {
+        const float yv = static_cast<float>(y[h * width + w]);
+        if (i420) {
+            const size_t uvIdx = (h / 2) * (width / 2) + w / 2;
+            return yuvToRgb<Round>(yv, static_cast<float>(u[uvIdx]), static_cast<float>(v[uvIdx]));
+        }
+        const size_t uvIdx = (h / 2) * width + (w / 2) * 2;
+        return yuvToRgb<Round>(yv, static_cast<float>(u[uvIdx]), static_cast<float>(u[uvIdx + 1]));
+    }
+};
+
+}  // namespace
+
+bool YuvPreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                         std::string& errorMessage) noexcept {
+    try {
+        if (!ov::as_type_ptr<const YuvPreprocessNode>(op)) {
+            errorMessage = "Only YuvPreprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+YuvPreprocess::YuvPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto& config = ov::as_type_ptr<const YuvPreprocessNode>(op)->get_config();
+    m_i420 = config.i420;
+    m_roundRgb = config.round_rgb;
+    m_planar = config.planar;
+    switch (config.resize_mode) {
+    case YuvPreprocessNode::ResizeMode::NEAREST:
+        m_resizeMode = ResizeMode::NEAREST;
+        break;
+    case YuvPreprocessNode::ResizeMode::LINEAR:
+        m_resizeMode = ResizeMode::LINEAR;
+        break;
+    default:
+        m_resizeMode = ResizeMode::NONE;
+    }
+    if (config.bgr) {
+        m_channelOrder = {2, 1, 0};
+    }
+    CPU_NODE_ASSERT(config.channel_scale.size() == 3 && config.channel_shift.size() == 3,
+                    "expects three channel scales and shifts");
+    std::copy_n(config.channel_scale.begin(), 3, m_scale.begin());
+    std::copy_n(config.channel_shift.begin(), 3, m_shift.begin());
+    m_inputPrecision = op->get_input_element_type(0);
+    m_outputPrecision = config.output_type;
+}
+
+void YuvPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    if (!any_of(m_inputPrecision, ov::element::u8, ov::element::f32)) {
+        m_inputPrecision = ov::element::f32;
+    }
+    if (!any_of(m_outputPrecision, ov::element::f32, ov::element::bf16)) {
+        m_outputPrecision = ov::element::f32;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs(getParentEdges().size(), {LayoutType::ncsp, m_inputPrecision});
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, m_outputPrecision}}, ref_any);
+}
+
+bool YuvPreprocess::created() const {
+    return getType() == Type::YuvPreprocess;
+}
+
+void YuvPreprocess::buildAxisMap(AxisMap& map, size_t inSize, size_t outSize) const {
+    map.index.resize(2 * outSize);
+    map.weight.resize(2 * outSize);
+    const float scale = static_cast<float>(outSize) / static_cast<float>(inSize);
+    const bool identity = m_resizeMode == ResizeMode::NONE || inSize == outSize || scale == 1.F;
+    const auto maxIdx = static_cast<int64_t>(inSize) - 1;
+    for (size_t o = 0; o < outSize; o++) {
+        size_t i0 = o;
+        size_t i1 = o;
+        float w0 = 1.F;
+        float w1 = 0.F;
+        if (!identity) {
+            // half pixel coordinate transformation
+            const float coord = (static_cast<float>(o) + 0.5F) / scale - 0.5F;
+            if (m_resizeMode == ResizeMode::NEAREST) {
+                // round prefer floor
+                const auto floorCoord = static_cast<float>(static_cast<int64_t>(std::floor(coord)));
+                const auto nearest = coord == floorCoord + 0.5F ? static_cast<int64_t>(floorCoord)
+                                                                : static_cast<int64_t>(std::round(coord));
+                i0 = i1 = static_cast<size_t>(std::clamp<int64_t>(nearest, 0, maxIdx));
+            } else {
+                const float clamped = std::clamp(coord, 0.F, static_cast<float>(maxIdx));
+                const auto lo = std::min(static_cast<int64_t>(clamped), maxIdx);
+                const auto hi = std::min(lo + 1, maxIdx);
+                i0 = static_cast<size_t>(lo);
+                i1 = static_cast<size_t>(hi);
+                if (lo == hi) {
+                    w0 = w1 = 0.5F;
+                } else {
+                    w0 = std::fabs(clamped - static_cast<float>(hi));
+                    w1 = std::fabs(clamped - static_cast<float>(lo));
+                }
+            }
+        }
+        map.index[2 * o] = i0;
+        map.index[2 * o + 1] = i1;
+        map.weight[2 * o] = w0;
+        map.weight[2 * o + 1] = w1;
+    }
+}
+
+void YuvPreprocess::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const bool bf16Output = m_outputPrecision == ov::element::bf16;
+    if (m_inputPrecision == ov::element::u8) {
+        bf16Output ? executeImpl<uint8_t, ov::bfloat16>() : executeImpl<uint8_t, float>();
+    } else {
+        bf16Output ? executeImpl<float, ov::bfloat16>() : executeImpl<float, float>();
+    }
+}
+
+void YuvPreprocess::executeDynamicImpl(const dnnl::stream& strm) {
+    execute(strm);
+}
+
+template <typename T, typename O>
+void YuvPreprocess::executeImpl() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    const bool singlePlane = getParentEdges().size() == 1;
+    const size_t batch = srcDims[0];
+    const size_t height = singlePlane ? srcDims[1] * 2 / 3 : srcDims[1];
+    const size_t width = srcDims[2];
+    const size_t outHeight = m_planar ? dstDims[2] : dstDims[1];
+    const size_t outWidth = m_planar ? dstDims[3] : dstDims[2];
+    const size_t imageSize = height * width;
+
+    buildAxisMap(m_rows, height, outHeight);
+    buildAxisMap(m_cols, width, outWidth);
+
+    const auto* src0 = getSrcDataAtPortAs<const T>(0);
+    const T* src1 = singlePlane ? nullptr : getSrcDataAtPortAs<const T>(1);
+    const T* src2 = m_i420 && !singlePlane ? getSrcDataAtPortAs<const T>(2) : nullptr;
+    auto* dst = getDstDataAtPortAs<O>(0);
+
+    auto image = [&](size_t n) {
+        YuvImage<T> img{nullptr, nullptr, nullptr, width, m_i420};
+        if (singlePlane) {
+            img.y = src0 + n * imageSize * 3 / 2;
+            img.u = img.y + imageSize;
+            img.v = img.u + imageSize / 4;
+        } else {
+            img.y = src0 + n * imageSize;
+            img.u = src1 + n * imageSize / (m_i420 ? 4 : 2);
+            img.v = m_i420 ? src2 + n * imageSize / 4 : img.u;
+        }
+        return img;
+    };
+
+    const size_t outImageSize = outHeight * outWidth;
+    auto store = [&](O* out, size_t pixel, const Rgb& rgb) {
+        const std::array<float, 3> values{rgb.r, rgb.g, rgb.b};
+        for (size_t c = 0; c < 3; c++) {
+            const size_t ch = m_channelOrder[c];
+            const float value = values[c] * m_scale[ch] + m_shift[ch];
+            out[m_planar ? ch * outImageSize + pixel : pixel * 3 + ch] = static_cast<O>(value);
+        }
+    };
+
+    const bool linear = m_resizeMode == ResizeMode::LINEAR;
+    auto processRow = [&](size_t n, size_t oh, auto round) {
+        constexpr bool Round = decltype(round)::value;
+        const auto img = image(n);
+        O* out = dst + n * outImageSize * 3;
+        const size_t h0 = m_rows.index[2 * oh];
+        const size_t h1 = m_rows.index[2 * oh + 1];
+        const float wh0 = m_rows.weight[2 * oh];
+        const float wh1 = m_rows.weight[2 * oh + 1];
+        for (size_t ow = 0; ow < outWidth; ow++) {
+            const size_t w0 = m_cols.index[2 * ow];
+            const size_t pixel = oh * outWidth + ow;
+            if (!linear) {
+                store(out, pixel, img.template pixel<Round>(h0, w0));
+                continue;
+            }
+            const size_t w1 = m_cols.index[2 * ow + 1];
+            const float ww0 = m_cols.weight[2 * ow];
+            const float ww1 = m_cols.weight[2 * ow + 1];
+            const Rgb p00 = img.template pixel<Round>(h0, w0);
+            const Rgb p01 = img.template pixel<Round>(h0, w1);
+            const Rgb p10 = img.template pixel<Round>(h1, w0);
+            const Rgb p11 = img.template pixel<Round>(h1, w1);
+            auto blend = [&](float a00, float a01, float a10, float a11) {
+                return wh0 * (ww0 * a00 + ww1 * a01) + wh1 * (ww0 * a10 + ww1 * a11);
+            };
+            store(out,
+                  pixel,
+                  {blend(p00.r, p01.r, p10.r, p11.r),
+                   blend(p00.g, p01.g, p10.g, p11.g),
+                   blend(p00.b, p01.b, p10.b, p11.b)});
+        }
+    };
+
+    const auto& cpuParallel = context->getCpuParallel();
+    if (m_roundRgb) {
+        cpuParallel->parallel_for2d(batch, outHeight, [&](size_t n, size_t oh) {
+            processRow(n, oh, std::true_type{});
+        });
+    } else {
+        cpuParallel->parallel_for2d(batch, outHeight, [&](size_t n, size_t oh) {
+            processRow(n, oh, std::false_type{});
+        });
+    }
+}
+
+}  // namespace ov::intel_cpu::node
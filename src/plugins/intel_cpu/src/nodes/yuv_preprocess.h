@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::node {
+
+// Converts a NV12 or I420 image to RGB, resizes and normalizes it in one pass over the output pixels. Only the source
+// pixels an output pixel is interpolated from are converted, so the full size RGB image and the resized image are
+// never stored, and the output rows of a thread read neighbouring source rows which stay in cache
+class YuvPreprocess : public Node {
+public:
+    YuvPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool needPrepareParams() const override {
+        return false;
+    }
+    [[nodiscard]] bool canBeInPlace() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(const dnnl::stream& strm) override;
+
+private:
+    enum class ResizeMode : uint8_t { NONE, NEAREST, LINEAR };
+
+    // Source coordinates of the output positions along one axis: two indices and their weights per position
+    struct AxisMap {
+        std::vector<size_t> index;
+        std::vector<float> weight;
+    };
+
+    template <typename T, typename O>
+    void executeImpl();
+
+    void buildAxisMap(AxisMap& map, size_t inSize, size_t outSize) const;
+
+    bool m_i420 = false;
+    bool m_roundRgb = false;
+    bool m_planar = false;
+    ResizeMode m_resizeMode = ResizeMode::NONE;
+    // output channel of the R, G and B values
+    std::array<size_t, 3> m_channelOrder{0, 1, 2};
+    std::array<float, 3> m_scale{1.F, 1.F, 1.F};
+    std::array<float, 3> m_shift{0.F, 0.F, 0.F};
+    ov::element::Type m_inputPrecision;
+    ov::element::Type m_outputPrecision;
+
+    AxisMap m_rows;
+    AxisMap m_cols;
+};
+
+}  // namespace ov::intel_cpu::node
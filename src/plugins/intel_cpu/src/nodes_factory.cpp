@@ -52,6 +52,7 @@
 #include "nodes/inverse.hpp"
 #include "nodes/istft.h"
 #include "nodes/log_softmax.h"
+#include "nodes/logits_sampling.h"
 #include "nodes/lora.h"
 #include "nodes/lrn.h"
 #include "nodes/mathematics.h"
@@ -108,6 +109,7 @@
 #include "nodes/topk.h"
 #include "nodes/transpose.h"
 #include "nodes/unique.hpp"
+#include "nodes/yuv_preprocess.h"
 #include "openvino/cc/factory.h"
 #include "selective_build.h"
 
@@ -186,6 +188,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(Convert, Type::Convert);
     INTEL_CPU_NODE(Col2Im, Type::Col2Im);
     INTEL_CPU_NODE(ColorConvert, Type::ColorConvert);
+    INTEL_CPU_NODE(YuvPreprocess, Type::YuvPreprocess);
     INTEL_CPU_NODE(EmbeddingBagOffset, Type::EmbeddingBagOffsetsSum);
     INTEL_CPU_NODE(EmbeddingBagOffset, Type::EmbeddingBagOffsets);
     INTEL_CPU_NODE(Roll, Type::Roll);
@@ -216,6 +219,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(Eye, Type::Eye);
     INTEL_CPU_NODE(Unique, Type::Unique);
     INTEL_CPU_NODE(Ngram, Type::Ngram);
+    INTEL_CPU_NODE(LogitsSampling, Type::LogitsSampling);
     INTEL_CPU_NODE(RoPE, Type::RoPE);
     INTEL_CPU_NODE(CausalMaskPreprocess, Type::CausalMaskPreprocess);
     INTEL_CPU_NODE(Identity, Type::Identity);
@@ -142,6 +142,8 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(brgemm_uni);
     CASE(brgemm_avx512_amx);
     CASE(brgemm_sparse_avx512_amx);
+    CASE(brgemm_sparse_avx512);
+    CASE(brgemm_sparse_avx2);
     CASE(acl);
     CASE(dw_acl);
     CASE(gemm_acl);
@@ -111,6 +111,8 @@ enum impl_desc_type : int64_t {
     brgemm_uni = brgemm | uni,
     brgemm_avx512_amx = brgemm | avx512 | amx,
     brgemm_sparse_avx512_amx = brgemm | sparse | avx512 | amx,
+    brgemm_sparse_avx512 = brgemm | sparse | avx512,
+    brgemm_sparse_avx2 = brgemm | sparse | avx2,
 
     dw_acl = _dw | acl,
     gemm_acl = gemm | acl,
@@ -4,12 +4,16 @@
 
 #include "plugin.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <istream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -33,9 +37,11 @@
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/symbol.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/version.hpp"
 #include "openvino/itt.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convolution.hpp"
 #include "openvino/op/paged_attention.hpp"
 #include "openvino/op/scaled_dot_product_attention.hpp"
@@ -51,8 +57,11 @@
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/weightless_properties_utils.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "sigstack_manager.h"
+#include "transformations/hash.hpp"
+#include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
 #include "utils/codec_xor.hpp"
@@ -311,6 +320,193 @@ void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& m
     }
 }
 
+void Plugin::transform_model(const std::shared_ptr<ov::Model>& model, Config& conf) {
+    Transformations transformations(model, conf);
+
+    transformations.UpToLpt();
+
+    calculate_streams(conf, model);
+
+    if (!conf.cacheEncrypt || !conf.cacheDecrypt) {
+        conf.cacheEncrypt = codec_xor_str;
+        conf.cacheDecrypt = codec_xor_str;
+    }
+
+    transformations.PostLpt();
+    transformations.Snippets();
+
+    transformations.CpuSpecificOpSet();
+}
+
+std::shared_ptr<ov::Model> Plugin::get_reshaped_transformed_model(const std::shared_ptr<ov::Model>& model,
+                                                                  const ov::AnyMap& properties,
+                                                                  Config& conf) const {
+    OV_ITT_SCOPED_TASK(itt::domains::ov_intel_cpu, "Plugin::get_reshaped_transformed_model");
+    std::map<size_t, ov::PartialShape> static_shapes;
+    std::map<size_t, ov::PartialShape> dynamic_shapes;
+    for (size_t i = 0; i < model->inputs().size(); i++) {
+        const auto& shape = model->input(i).get_partial_shape();
+        static_shapes[i] = shape;
+        dynamic_shapes[i] = ov::PartialShape::dynamic(shape.rank());
+    }
+
+    // The key is computed for the model with dynamic input dimensions, so all reshaped variants of the model share it
+    std::shared_ptr<ov::Model> dynamic_model;
+    uint64_t model_hash = 0;
+    try {
+        dynamic_model = model->clone();
+        dynamic_model->reshape(dynamic_shapes);
+        ov::pass::Hash(model_hash).run_on_model(dynamic_model);
+    } catch (const ov::Exception&) {
+        return nullptr;
+    }
+
+    const auto find_entry = [&]() {
+        return std::find_if(m_reshape_cache.begin(), m_reshape_cache.end(), [&](const ReshapeCacheEntry& entry) {
+            return entry.model_hash == model_hash && entry.properties == properties;
+        });
+    };
+    std::shared_ptr<const ov::Model> transformed_model;
+    {
+        std::lock_guard<std::mutex> lock(m_reshape_cache_mutex);
+        auto it = find_entry();
+        if (it != m_reshape_cache.end()) {
+            if (!it->transformed_model) {
+                return nullptr;
+            }
+            m_reshape_cache.splice(m_reshape_cache.begin(), m_reshape_cache, it);
+            transformed_model = it->transformed_model;
+            m_reshape_cache_hits++;
+        }
+    }
+
+    if (!transformed_model) {
+        // The model is transformed once for dynamic input dimensions, the streams are calculated below for the
+        // requested shapes
+        Config dynamic_conf = conf;
+        transform_model(dynamic_model, dynamic_conf);
+        transformed_model = dynamic_model;
+        cache_transformed_model(model_hash, properties, transformed_model);
+    }
+
+    auto reshaped_model = transformed_model->clone();
+    try {
+        reshaped_model->reshape(static_shapes);
+    } catch (const ov::Exception&) {
+        // Keep the entry without the model, so the following compilations run the full pipeline right away
+        std::lock_guard<std::mutex> lock(m_reshape_cache_mutex);
+        auto it = find_entry();
+        if (it != m_reshape_cache.end()) {
+            m_reshape_cache_bytes -= it->bytes;
+            it->bytes = 0;
+            it->transformed_model.reset();
+        }
+        return nullptr;
+    }
+
+    // Streams hints depend on the input shapes, so they are calculated for the original model with the requested
+    // shapes and saved to the rt_info of the reshaped one, as the exported model must carry them
+    calculate_streams(conf, model);
+    reshaped_model->get_rt_info()["intel_cpu_hints_config"] = model->get_rt_info().at("intel_cpu_hints_config");
+    if (!conf.cacheEncrypt || !conf.cacheDecrypt) {
+        conf.cacheEncrypt = codec_xor_str;
+        conf.cacheDecrypt = codec_xor_str;
+    }
+    return reshaped_model;
+}
+
+void Plugin::cache_transformed_model(uint64_t model_hash,
+                                     const ov::AnyMap& properties,
+                                     const std::shared_ptr<const ov::Model>& transformed_model) const {
+    // The constants dominate the size of the model, the ones shared with the original model are counted as well,
+    // since the cache keeps them alive
+    size_t bytes = 0;
+    for (const auto& op : transformed_model->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<const op::v0::Constant>(op)) {
+            bytes += constant->get_byte_size();
+        }
+    }
+    if (bytes > max_reshape_cache_bytes) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_reshape_cache_mutex);
+    // Another compilation of the same model may have cached it meanwhile
+    if (std::any_of(m_reshape_cache.begin(), m_reshape_cache.end(), [&](const ReshapeCacheEntry& entry) {
+            return entry.model_hash == model_hash && entry.properties == properties;
+        })) {
+        return;
+    }
+    m_reshape_cache.push_front({model_hash, properties, transformed_model, bytes});
+    m_reshape_cache_bytes += bytes;
+    while (m_reshape_cache.size() > max_reshape_cache_entries || m_reshape_cache_bytes > max_reshape_cache_bytes) {
+        m_reshape_cache_bytes -= m_reshape_cache.back().bytes;
+        m_reshape_cache.pop_back();
+    }
+}
+
+// Outputs of a stateful LLM whose dimension 1 is the sequence of the tokens input, the chunked prefill concatenates
+// them over the chunks. The dimension is recognized by the symbol it shares with the tokens input, so an output whose
+// size only happens to match the chunk size is not concatenated. Empty if the sequence dimension of the tokens input
+// has no symbol, so the outputs can't be classified
+static std::optional<std::vector<size_t>> getPrefillSequenceOutputs(const std::shared_ptr<const Model>& model) {
+    const auto model_copy = model->clone();
+    ov::pass::SymbolicPropagation().run_on_model(model_copy);
+    std::shared_ptr<ov::Symbol> sequence;
+    for (const auto& input : model_copy->inputs()) {
+        const auto& names = input.get_names();
+        const auto& shape = input.get_partial_shape();
+        if ((names.count("input_ids") || names.count("inputs_embeds")) && shape.rank().is_static() &&
+            shape.size() >= 2) {
+            sequence = shape[1].get_symbol();
+        }
+    }
+    if (!sequence) {
+        return std::nullopt;
+    }
+    std::vector<size_t> sequence_outputs;
+    for (size_t i = 0; i < model_copy->outputs().size(); i++) {
+        const auto& shape = model_copy->output(i).get_partial_shape();
+        if (shape.rank().is_static() && shape.size() >= 2 && ov::symbol::are_equal(shape[1].get_symbol(), sequence)) {
+            sequence_outputs.push_back(i);
+        }
+    }
+    return sequence_outputs;
+}
+
+// The outputs are classified on the original model, the symbols may be lost in the transformed one, so the indices
+// are kept in the rt_info of the transformed model and exported with it
+static constexpr const char* prefill_sequence_outputs_rt_info = "intel_cpu_prefill_sequence_outputs";
+
+static void setPrefillSequenceOutputs(Config& conf, const std::shared_ptr<const Model>& model) {
+    if (conf.prefillChunkSize == 0 || model->get_variables().empty()) {
+        return;
+    }
+    if (const auto sequence_outputs = getPrefillSequenceOutputs(model)) {
+        conf.prefillSequenceOutputs = *sequence_outputs;
+    } else {
+        // the outputs holding the whole sequence would contain the last chunk only
+        conf.prefillChunkSize = 0;
+    }
+}
+
+static void importPrefillSequenceOutputs(Config& conf, const std::shared_ptr<const Model>& model) {
+    if (conf.prefillChunkSize == 0 || model->get_variables().empty()) {
+        return;
+    }
+    if (!model->has_rt_info(prefill_sequence_outputs_rt_info)) {
+        conf.prefillChunkSize = 0;
+        return;
+    }
+    conf.prefillSequenceOutputs.clear();
+    const auto indices = model->get_rt_info<std::string>(prefill_sequence_outputs_rt_info);
+    for (const auto& index : ov::util::split(indices, ',', true)) {
+        if (!index.empty()) {
+            conf.prefillSequenceOutputs.push_back(std::stoul(index));
+        }
+    }
+}
+
 static Config::ModelType getModelType(const std::shared_ptr<const Model>& model) {
     if (op::util::has_op_with_type<op::v13::ScaledDotProductAttention>(model)) {
         if (!model->get_variables().empty()) {
@@ -364,39 +560,39 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     Config conf = engConfig;
     conf.applyRtInfo(cloned_model);
     conf.readProperties(config, modelType);
+    setPrefillSequenceOutputs(conf, model);
 
-    Transformations transformations(cloned_model, conf);
-
-    transformations.UpToLpt();
-
-    calculate_streams(conf, cloned_model);
-
-    if (!conf.cacheEncrypt || !conf.cacheDecrypt) {
-        conf.cacheEncrypt = codec_xor_str;
-        conf.cacheDecrypt = codec_xor_str;
+    // Only static models benefit from the cache, dynamic ones are compiled for any input shape anyway. Stateful models
+    // are not cached since their variable shapes are not a part of the input shapes
+    std::shared_ptr<ov::Model> transformed_model;
+    if (conf.enableReshapeCompileCache && !model->is_dynamic() && model->get_variables().empty()) {
+        transformed_model = get_reshaped_transformed_model(cloned_model, config, conf);
+    }
+    if (!transformed_model) {
+        transform_model(cloned_model, conf);
+        transformed_model = cloned_model;
     }
 
-    transformations.PostLpt();
-    transformations.Snippets();
-
-    transformations.CpuSpecificOpSet();
-
-    DEBUG_LOG(PrintableModel(*cloned_model, "cpu_"));
+    DEBUG_LOG(PrintableModel(*transformed_model, "cpu_"));
+    if (conf.prefillChunkSize != 0 && !model->get_variables().empty()) {
+        transformed_model->set_rt_info(ov::util::join(conf.prefillSequenceOutputs, ","),
+                                       prefill_sequence_outputs_rt_info);
+    }
 
-    OPENVINO_ASSERT(cloned_model->inputs().size() == model->inputs().size() &&
-                        cloned_model->outputs().size() == model->outputs().size(),
+    OPENVINO_ASSERT(transformed_model->inputs().size() == model->inputs().size() &&
+                        transformed_model->outputs().size() == model->outputs().size(),
                     "Input/output ports count mismatch between the original model and after the transformation! "
                     "Original model inputs count: ",
                     model->inputs().size(),
                     " after the transformations ",
-                    cloned_model->inputs().size(),
+                    transformed_model->inputs().size(),
                     ". Original model outputs count:",
                     model->inputs().size(),
                     " after the transformations ",
-                    cloned_model->outputs().size());
+                    transformed_model->outputs().size());
     // Make output ports have the same tensor names with original model
-    for (size_t idx = 0; idx < cloned_model->outputs().size(); idx++) {
-        auto new_result = cloned_model->output(idx);
+    for (size_t idx = 0; idx < transformed_model->outputs().size(); idx++) {
+        auto new_result = transformed_model->output(idx);
         auto orig_result = model->output(idx);
         new_result.get_tensor().set_names(orig_result.get_tensor().get_names());
     }
@@ -412,10 +608,16 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    return std::make_shared<CompiledModel>(transformed_model, shared_from_this(), conf, false);
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
+    {
+        // Cached transformed models depend on the plugin configuration
+        std::lock_guard<std::mutex> lock(m_reshape_cache_mutex);
+        m_reshape_cache.clear();
+        m_reshape_cache_bytes = 0;
+    }
     // @todo after Legacy configuration is dropped, use some wrapper class to keep both the property and
     // "ifSetExplicitly" flag
     streamsExplicitlySetForEngine = streamsSet(config);
@@ -459,6 +661,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         const bool reserve_value = engConfig.enableCpuReservation;
         return static_cast<decltype(ov::hint::enable_cpu_reservation)::value_type>(reserve_value);
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
     if (name == ov::hint::scheduling_core_type) {
         const auto core_type = engConfig.schedulingCoreType;
         return core_type;
@@ -577,6 +782,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::hint::enable_cpu_pinning.name()),
                                                    RW_property(ov::hint::enable_cpu_reservation.name()),
                                                    RW_property(ov::hint::scheduling_core_type.name()),
+                                                   RW_property(ov::hint::model_priority.name()),
                                                    RW_property(ov::hint::model_distribution_policy.name()),
                                                    RW_property(ov::hint::enable_hyper_threading.name()),
                                                    RW_property(ov::device::id.name()),
@@ -666,6 +872,9 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
     if (name == ov::intel_cpu::tbb_partitioner) {
         return static_cast<decltype(ov::intel_cpu::tbb_partitioner)::value_type>(engConfig.tbbPartitioner);
     }
+    if (name == ov::intel_cpu::reshape_compile_cache_hits) {
+        return decltype(ov::intel_cpu::reshape_compile_cache_hits)::value_type{m_reshape_cache_hits.load()};
+    }
     if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{get_device_name()};
     }
@@ -800,6 +1009,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
         _config.erase(it);
     }
     conf.readProperties(_config, modelType);
+    importPrefillSequenceOutputs(conf, model);
 
     // import config props from caching model
     calculate_streams(conf, model, true);
@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <istream>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "config.h"
@@ -72,6 +76,23 @@ private:
 
     static void get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model);
     static void calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported = false);
+    static void transform_model(const std::shared_ptr<ov::Model>& model, Config& conf);
+    std::shared_ptr<ov::Model> get_reshaped_transformed_model(const std::shared_ptr<ov::Model>& model,
+                                                              const ov::AnyMap& properties,
+                                                              Config& conf) const;
+    void cache_transformed_model(uint64_t model_hash,
+                                 const ov::AnyMap& properties,
+                                 const std::shared_ptr<const ov::Model>& transformed_model) const;
+
+    struct ReshapeCacheEntry {
+        // Hash of the original model with dynamic input dimensions
+        uint64_t model_hash;
+        ov::AnyMap properties;
+        // Model transformed for dynamic input dimensions, reset if it can't be reshaped back to static shapes
+        std::shared_ptr<const ov::Model> transformed_model;
+        size_t bytes;
+    };
+
     Config engConfig;
     /* Explicily configured streams have higher priority than performance hints.
        So track if streams is set explicitly (not auto-configured) */
@@ -79,6 +100,15 @@ private:
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
 
+    // Transformed models compiled with enable_reshape_compile_cache, the most recently used first. The cache is
+    // bounded by the number of the models and by the size of their constants
+    static constexpr size_t max_reshape_cache_entries = 8;
+    static constexpr size_t max_reshape_cache_bytes = 512 * 1024 * 1024;
+    mutable std::mutex m_reshape_cache_mutex;
+    mutable std::list<ReshapeCacheEntry> m_reshape_cache;
+    mutable size_t m_reshape_cache_bytes = 0;
+    mutable std::atomic<uint64_t> m_reshape_cache_hits{0};
+
     std::shared_ptr<void> specialSetup;
 };
 
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "logits_sampling.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/except.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+
+namespace ov::intel_cpu::node {
+
+Result LogitsSamplingShapeInfer::infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                                       const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    const auto num_samples = data_dependency.at(1)->getDataAs<const int32_t>()[0];
+    OPENVINO_ASSERT(num_samples >= 0, "LogitsSampling num_samples value can't be negative.");
+    const auto& logits_shape = input_shapes.front().get();
+    return {{VectorDims{logits_shape[0], static_cast<size_t>(num_samples)}}, ShapeInferStatus::success};
+}
+
+}  // namespace ov::intel_cpu::node
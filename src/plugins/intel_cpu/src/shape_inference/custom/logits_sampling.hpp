@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "shape_inference/shape_inference_cpu.hpp"
+
+#pragma once
+
+namespace ov::intel_cpu::node {
+using Result = IShapeInfer::Result;
+/**
+ * The output shape of LogitsSampling is [B, num_samples], where B is the batch dimension of the logits and
+ * num_samples is the value of the second input.
+ */
+class LogitsSamplingShapeInfer : public ShapeInferEmptyPads {
+public:
+    LogitsSamplingShapeInfer() = default;
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return PortMask(1);
+    }
+};
+
+class LogitsSamplingShapeInferFactory : public ShapeInferFactory {
+public:
+    [[nodiscard]] ShapeInferPtr makeShapeInfer() const override {
+        return std::make_shared<LogitsSamplingShapeInfer>();
+    }
+};
+
+}  // namespace ov::intel_cpu::node
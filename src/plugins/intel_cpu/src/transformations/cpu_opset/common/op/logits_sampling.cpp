@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "logits_sampling.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::LogitsSamplingNode::LogitsSamplingNode(const ov::Output<Node>& logits,
+                                                      const ov::Output<Node>& num_samples,
+                                                      const Config& cfg)
+    : Op({logits, num_samples}),
+      m_config(cfg) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::LogitsSamplingNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(LogitsSamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::LogitsSamplingNode>(new_args.at(0), new_args.at(1), m_config);
+}
+
+bool ov::intel_cpu::LogitsSamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(LogitsSamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("with_replacement", m_config.with_replacement);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::LogitsSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(LogitsSamplingNode_validate_and_infer_types);
+    const auto& logits_shape = get_input_partial_shape(0);
+    OPENVINO_ASSERT(get_input_element_type(0).is_real(),
+                    "'logits' input must be real whereas current element type is",
+                    get_input_element_type(0));
+    OPENVINO_ASSERT(logits_shape.rank().compatible(2),
+                    "'logits' input must have 2D shape whereas current shape is",
+                    logits_shape);
+    OPENVINO_ASSERT(get_input_element_type(1).is_integral_number(),
+                    "'num_samples' input must be integer whereas current element type is",
+                    get_input_element_type(1));
+    OPENVINO_ASSERT(m_config.output_type == ov::element::i32 || m_config.output_type == ov::element::i64,
+                    "output type must be i32 or i64 whereas current type is",
+                    m_config.output_type);
+
+    auto num_samples = Dimension::dynamic();
+    if (const auto samples_const = ov::as_type_ptr<ov::op::v0::Constant>(get_input_node_shared_ptr(1))) {
+        num_samples = samples_const->cast_vector<int64_t>().at(0);
+    }
+    const auto batch = logits_shape.rank().is_static() ? logits_shape[0] : Dimension::dynamic();
+    set_output_type(0, m_config.output_type, {batch, num_samples});
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation draws token ids from the logits of a generation step: the logits are multiplied by the scale (inverse
+ * temperature), optionally reduced to the top_k largest ones, normalized with softmax and sampled as Multinomial does.
+ * Inputs:
+ *     1. Logits of type f32 - shape [B, V], where B - batch size, V - vocabulary size. Required
+ *     2. Number of samples of an integer type - scalar or shape [1]. Required
+ * Outputs:
+ *     1. Vocabulary ids of type output_type - shape [B, num_samples].
+ */
+class LogitsSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("LogitsSampling", "cpu_plugin_opset");
+
+    LogitsSamplingNode() = default;
+
+    struct Config {
+        float scale = 1.F;
+        // 0 means the whole vocabulary is sampled
+        uint64_t top_k = 0;
+        bool with_replacement = false;
+        uint64_t global_seed = 0;
+        uint64_t op_seed = 0;
+        ov::element::Type output_type = ov::element::i32;
+    };
+
+    LogitsSamplingNode(const ov::Output<Node>& logits, const ov::Output<Node>& num_samples, const Config& cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
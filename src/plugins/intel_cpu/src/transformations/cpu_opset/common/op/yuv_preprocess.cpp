@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess.hpp"
+
+#include <memory>
+#include <ostream>
+
+#include "openvino/core/attribute_adapter.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+namespace ov {
+
+template <>
+EnumNames<ov::intel_cpu::YuvPreprocessNode::ResizeMode>&
+EnumNames<ov::intel_cpu::YuvPreprocessNode::ResizeMode>::get() {
+    static auto enum_names = EnumNames<ov::intel_cpu::YuvPreprocessNode::ResizeMode>(
+        "op::intel_cpu::YuvPreprocessNode::ResizeMode",
+        {{"NONE", ov::intel_cpu::YuvPreprocessNode::ResizeMode::NONE},
+         {"NEAREST", ov::intel_cpu::YuvPreprocessNode::ResizeMode::NEAREST},
+         {"LINEAR", ov::intel_cpu::YuvPreprocessNode::ResizeMode::LINEAR}});
+    return enum_names;
+}
+
+std::ostream& operator<<(std::ostream& os, const ov::intel_cpu::YuvPreprocessNode::ResizeMode& type) {
+    return os << as_string(type);
+}
+
+}  // namespace ov
+
+ov::intel_cpu::YuvPreprocessNode::YuvPreprocessNode(const ov::OutputVector& planes, const Config& cfg)
+    : Op(planes),
+      m_config(cfg) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::YuvPreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::YuvPreprocessNode>(new_args, m_config);
+}
+
+bool ov::intel_cpu::YuvPreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("i420", m_config.i420);
+    visitor.on_attribute("bgr", m_config.bgr);
+    visitor.on_attribute("round_rgb", m_config.round_rgb);
+    visitor.on_attribute("resize_mode", m_config.resize_mode);
+    visitor.on_attribute("height", m_config.height);
+    visitor.on_attribute("width", m_config.width);
+    visitor.on_attribute("channel_scale", m_config.channel_scale);
+    visitor.on_attribute("channel_shift", m_config.channel_shift);
+    visitor.on_attribute("planar", m_config.planar);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::YuvPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_validate_and_infer_types);
+    const auto planes = get_input_size();
+    OPENVINO_ASSERT(planes == 1 || planes == (m_config.i420 ? 3 : 2),
+                    "YuvPreprocess expects a single plane or all the planes of the image, got ",
+                    planes,
+                    " inputs");
+    OPENVINO_ASSERT(m_config.channel_scale.size() == 3 && m_config.channel_shift.size() == 3,
+                    "YuvPreprocess expects the scale and the shift of 3 channels");
+    for (size_t i = 0; i < planes; i++) {
+        OPENVINO_ASSERT(get_input_element_type(i) == ov::element::u8 || get_input_element_type(i) == ov::element::f32,
+                        "YuvPreprocess input must be u8 or f32 whereas current element type is ",
+                        get_input_element_type(i));
+        OPENVINO_ASSERT(get_input_partial_shape(i).rank().compatible(4),
+                        "YuvPreprocess input must have 4D shape whereas current shape is ",
+                        get_input_partial_shape(i));
+    }
+
+    const auto& image_shape = get_input_partial_shape(0);
+    auto batch = Dimension::dynamic();
+    auto height = Dimension::dynamic();
+    auto width = Dimension::dynamic();
+    if (image_shape.rank().is_static()) {
+        batch = image_shape[0];
+        height = image_shape[1];
+        width = image_shape[2];
+        if (planes == 1 && height.is_static()) {
+            height = height.get_length() * 2 / 3;
+        }
+    }
+    if (m_config.resize_mode != ResizeMode::NONE) {
+        height = m_config.height;
+        width = m_config.width;
+    }
+    const auto output_shape =
+        m_config.planar ? PartialShape{batch, 3, height, width} : PartialShape{batch, height, width, 3};
+    set_output_type(0, m_config.output_type, output_shape);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "openvino/core/attribute_adapter.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation converts a NV12 or I420 image to RGB or BGR, resizes it and normalizes each channel as
+ * value * channel_scale + channel_shift, which is the preprocessing chain of a video frame.
+ * Inputs:
+ *     1. Y plane, or the whole image of a single plane format, of type u8 or f32 - shape [N, H, W, 1] or
+ *        [N, H * 3 / 2, W, 1]. Required
+ *     2. UV plane of NV12 [N, H / 2, W / 2, 2] or U plane of I420 [N, H / 2, W / 2, 1]. Optional
+ *     3. V plane of I420 [N, H / 2, W / 2, 1]. Optional
+ * Outputs:
+ *     1. Image of type output_type - shape [N, 3, OH, OW] if planar, [N, OH, OW, 3] otherwise.
+ */
+class YuvPreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("YuvPreprocess", "cpu_plugin_opset");
+
+    YuvPreprocessNode() = default;
+
+    enum class ResizeMode : uint8_t { NONE, NEAREST, LINEAR };
+
+    struct Config {
+        bool i420 = false;
+        bool bgr = false;
+        // the color conversion produced u8 values, so they are rounded before the conversion to float
+        bool round_rgb = false;
+        ResizeMode resize_mode = ResizeMode::NONE;
+        int64_t height = 0;
+        int64_t width = 0;
+        std::vector<float> channel_scale{1.F, 1.F, 1.F};
+        std::vector<float> channel_shift{0.F, 0.F, 0.F};
+        bool planar = false;
+        ov::element::Type output_type = ov::element::f32;
+    };
+
+    YuvPreprocessNode(const ov::OutputVector& planes, const Config& cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
+
+namespace ov {
+
+template <>
+class AttributeAdapter<ov::intel_cpu::YuvPreprocessNode::ResizeMode>
+    : public EnumAttributeAdapterBase<ov::intel_cpu::YuvPreprocessNode::ResizeMode> {
+public:
+    explicit AttributeAdapter(ov::intel_cpu::YuvPreprocessNode::ResizeMode& value)
+        : EnumAttributeAdapterBase<ov::intel_cpu::YuvPreprocessNode::ResizeMode>(value) {}
+
+    OPENVINO_RTTI("AttributeAdapter<ov::intel_cpu::YuvPreprocessNode::ResizeMode>");
+};
+
+std::ostream& operator<<(std::ostream& os, const ov::intel_cpu::YuvPreprocessNode::ResizeMode& type);
+
+}  // namespace ov
@@ -0,0 +1,182 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "logits_sampling_fusion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather_elements.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/gather_base.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/logits_sampling.hpp"
+
+namespace {
+
+std::optional<float> get_scalar(const ov::Output<ov::Node>& output) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || !constant->get_element_type().is_real() || ov::shape_size(constant->get_shape()) != 1 ||
+        constant->get_shape().size() > 2) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<float>()[0];
+}
+
+// Matches x * c, c * x and x / c with a scalar constant c. On success the value is moved to x, the scale is multiplied
+// by the factor and the matched node is returned
+std::shared_ptr<ov::Node> match_scale(ov::Output<ov::Node>& value, float& scale) {
+    const auto node = value.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v1::Multiply>(node)) {
+        for (size_t i = 0; i < 2; i++) {
+            if (const auto factor = get_scalar(node->input_value(i))) {
+                scale *= *factor;
+                value = node->input_value(1 - i);
+                return node;
+            }
+        }
+    } else if (ov::is_type<ov::op::v1::Divide>(node)) {
+        if (const auto divisor = get_scalar(node->input_value(1)); divisor && *divisor != 0.F) {
+            scale /= *divisor;
+            value = node->input_value(0);
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+bool is_last_axis_softmax(const std::shared_ptr<ov::Node>& node) {
+    if (const auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(node)) {
+        return softmax->get_axis() == 1;
+    }
+    if (const auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(node)) {
+        return softmax->get_axis() == 1 || softmax->get_axis() == -1;
+    }
+    return false;
+}
+
+// Checks that the node gathers the ids by the sampled positions in each batch row
+bool is_ids_gather(const std::shared_ptr<ov::Node>& node,
+                   const ov::Output<ov::Node>& ids,
+                   const ov::Output<ov::Node>& positions) {
+    if (node->get_input_size() < 2 || node->input_value(0) != ids || node->input_value(1) != positions) {
+        return false;
+    }
+    if (const auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(node)) {
+        const auto batch_dims = gather->get_batch_dims();
+        return ov::is_type<ov::op::v0::Constant>(gather->get_input_node_ptr(2)) && gather->get_axis() == 1 &&
+               (batch_dims == 1 || batch_dims == -1);
+    }
+    if (const auto gather_elements = ov::as_type_ptr<ov::op::v6::GatherElements>(node)) {
+        return gather_elements->get_axis() == 1 || gather_elements->get_axis() == -1;
+    }
+    return false;
+}
+
+}  // namespace
+
+ov::intel_cpu::LogitsSamplingFusion::LogitsSamplingFusion() {
+    MATCHER_SCOPE(LogitsSamplingFusion);
+
+    auto multinomial_m = ov::pass::pattern::wrap_type<ov::op::v13::Multinomial>(
+        {ov::pass::pattern::any_input(ov::pass::pattern::rank_equals(2)), ov::pass::pattern::any_input()});
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        const auto multinomial = ov::as_type_ptr<ov::op::v13::Multinomial>(m.get_match_root());
+        if (!multinomial || transformation_callback(multinomial)) {
+            return false;
+        }
+
+        ov::NodeVector fused_nodes{multinomial};
+        ov::Output<ov::Node> value = multinomial->input_value(0);
+        if (!multinomial->get_log_probs()) {
+            const auto softmax = value.get_node_shared_ptr();
+            if (!is_last_axis_softmax(softmax)) {
+                return false;
+            }
+            fused_nodes.push_back(softmax);
+            value = softmax->input_value(0);
+        }
+
+        float scale = 1.F;
+        if (const auto scale_node = match_scale(value, scale)) {
+            fused_nodes.push_back(scale_node);
+        }
+
+        std::shared_ptr<ov::Node> output_node = multinomial;
+        auto output_type = ov::element::Type(multinomial->get_convert_type());
+        uint64_t top_k = 0;
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(value.get_node_shared_ptr());
+        if (topk && value.get_index() == 0) {
+            if (topk->get_input_partial_shape(0).rank() != 2 || topk->get_mode() != ov::op::TopKMode::MAX ||
+                topk->get_sort_type() != ov::op::TopKSortType::SORT_VALUES || topk->get_axis() != 1) {
+                return false;
+            }
+            top_k = topk->get_k();
+            // the samples are positions among the top k logits, the fused node returns the ids they are mapped to
+            const auto& consumers = multinomial->get_output_target_inputs(0);
+            if (top_k == 0 || consumers.size() != 1) {
+                return false;
+            }
+            const auto gather = consumers.begin()->get_node()->shared_from_this();
+            if (!is_ids_gather(gather, topk->output(1), multinomial->output(0))) {
+                return false;
+            }
+            fused_nodes.push_back(topk);
+            fused_nodes.push_back(gather);
+            output_node = gather;
+            output_type = topk->get_index_element_type();
+
+            value = topk->input_value(0);
+            // a scale applied before the TopK must keep the order of the logits
+            float logits_scale = 1.F;
+            const auto scale_node = match_scale(value, logits_scale);
+            if (scale_node && logits_scale <= 0.F) {
+                return false;
+            }
+            if (scale_node) {
+                fused_nodes.push_back(scale_node);
+                scale *= logits_scale;
+            }
+        }
+
+        // a bare Multinomial over log probabilities is left to its own node
+        if (fused_nodes.size() == 1) {
+            return false;
+        }
+
+        LogitsSamplingNode::Config config;
+        config.scale = scale;
+        config.top_k = top_k;
+        config.with_replacement = multinomial->get_with_replacement();
+        config.global_seed = multinomial->get_global_seed();
+        config.op_seed = multinomial->get_op_seed();
+        config.output_type = output_type;
+        auto sampling = std::make_shared<LogitsSamplingNode>(value, multinomial->input_value(1), config);
+        sampling->set_friendly_name(output_node->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, sampling);
+        ov::replace_node(output_node, sampling);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(multinomial_m, matcher_name);
+    this->register_matcher(m, callback);
+}
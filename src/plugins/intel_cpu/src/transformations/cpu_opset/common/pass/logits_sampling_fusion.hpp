@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the logits processing chain of a generation step into LogitsSamplingNode:
+ *
+ *     logits -> [Multiply/Divide(scalar)] -> [TopK(MAX, SORT_VALUES)] -> [Multiply/Divide(scalar)] ->
+ *         Softmax -> Multinomial -> [Gather/GatherElements(TopK indices)]
+ *
+ * The Softmax may be omitted if the Multinomial takes log probabilities, the TopK requires the Gather mapping the
+ * sampled positions back to the vocabulary ids. All the reductions are over the last axis of the 2D logits.
+ */
+class LogitsSamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("LogitsSamplingFusion");
+    LogitsSamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/interpolate_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+
+namespace {
+
+using ResizeMode = ov::intel_cpu::YuvPreprocessNode::ResizeMode;
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+std::shared_ptr<ov::Node> single_consumer(const ov::Output<ov::Node>& value) {
+    const auto& consumers = value.get_target_inputs();
+    if (consumers.size() != 1) {
+        return nullptr;
+    }
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+// A scalar constant or a constant of 3 values along the channel axis, which is counted from the last axis
+std::optional<std::vector<float>> get_channel_values(const ov::Output<ov::Node>& output, size_t channel_axis) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || !constant->get_element_type().is_real()) {
+        return std::nullopt;
+    }
+    const auto& shape = constant->get_shape();
+    if (shape.size() > 4) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < shape.size(); i++) {
+        const bool channel = shape.size() - 1 - i == channel_axis;
+        if (shape[i] != 1 && !(channel && shape[i] == 3)) {
+            return std::nullopt;
+        }
+    }
+    auto values = constant->cast_vector<float>();
+    if (values.size() == 1) {
+        values.resize(3, values[0]);
+    }
+    return values;
+}
+
+// Folds the eltwise applied to value * scale + shift into the scale and the shift
+bool fold_eltwise(const std::shared_ptr<ov::Node>& node,
+                  const ov::Output<ov::Node>& value,
+                  size_t channel_axis,
+                  std::vector<float>& scale,
+                  std::vector<float>& shift) {
+    const auto eltwise = ov::as_type_ptr<ov::op::util::BinaryElementwiseArithmetic>(node);
+    if (!eltwise || eltwise->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY ||
+        !ov::is_type_any_of<ov::op::v1::Add, ov::op::v1::Subtract, ov::op::v1::Multiply, ov::op::v1::Divide>(node)) {
+        return false;
+    }
+    const size_t value_idx = node->input_value(0) == value ? 0 : 1;
+    const auto values = get_channel_values(node->input_value(1 - value_idx), channel_axis);
+    if (!values) {
+        return false;
+    }
+    const auto& c = *values;
+    if (ov::is_type<ov::op::v1::Divide>(node)) {
+        if (value_idx != 0 || c[0] == 0.F || c[1] == 0.F || c[2] == 0.F) {
+            return false;
+        }
+    }
+    for (size_t ch = 0; ch < 3; ch++) {
+        if (ov::is_type<ov::op::v1::Add>(node)) {
+            shift[ch] += c[ch];
+        } else if (ov::is_type<ov::op::v1::Subtract>(node)) {
+            if (value_idx == 0) {
+                shift[ch] -= c[ch];
+            } else {
+                scale[ch] = -scale[ch];
+                shift[ch] = c[ch] - shift[ch];
+            }
+        } else if (ov::is_type<ov::op::v1::Multiply>(node)) {
+            scale[ch] *= c[ch];
+            shift[ch] *= c[ch];
+        } else {
+            scale[ch] /= c[ch];
+            shift[ch] /= c[ch];
+        }
+    }
+    return true;
+}
+
+// The resize of the spatial axes of a 4D image, height_axis is followed by the width axis
+std::optional<ResizeMode> get_resize_mode(const std::shared_ptr<ov::Node>& node, size_t height_axis) {
+    if (!ov::is_type_any_of<ov::op::v4::Interpolate, ov::op::v11::Interpolate>(node)) {
+        return std::nullopt;
+    }
+    const auto& attrs = ov::as_type_ptr<InterpolateBase>(node)->get_attrs();
+    const auto is_zero = [](size_t pad) {
+        return pad == 0;
+    };
+    if (attrs.shape_calculation_mode != InterpolateBase::ShapeCalcMode::SIZES || attrs.antialias ||
+        attrs.coordinate_transformation_mode != InterpolateBase::CoordinateTransformMode::HALF_PIXEL ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero)) {
+        return std::nullopt;
+    }
+    const auto& in_shape = node->get_input_partial_shape(0);
+    const auto& out_shape = node->get_output_partial_shape(0);
+    if (in_shape.rank() != 4 || out_shape.rank() != 4) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < 4; i++) {
+        const bool spatial = i == height_axis || i == height_axis + 1;
+        if (spatial ? out_shape[i].is_dynamic() : out_shape[i] != in_shape[i]) {
+            return std::nullopt;
+        }
+    }
+    switch (attrs.mode) {
+    case InterpolateBase::InterpolateMode::NEAREST:
+        if (attrs.nearest_mode != InterpolateBase::NearestMode::ROUND_PREFER_FLOOR) {
+            return std::nullopt;
+        }
+        return ResizeMode::NEAREST;
+    case InterpolateBase::InterpolateMode::LINEAR:
+    case InterpolateBase::InterpolateMode::LINEAR_ONNX:
+        return ResizeMode::LINEAR;
+    default:
+        return std::nullopt;
+    }
+}
+
+bool is_nhwc_to_nchw(const std::shared_ptr<ov::Node>& node) {
+    if (!ov::is_type<ov::op::v1::Transpose>(node)) {
+        return false;
+    }
+    const auto order = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    return order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2};
+}
+
+}  // namespace
+
+ov::intel_cpu::YuvPreprocessFusion::YuvPreprocessFusion() {
+    MATCHER_SCOPE(YuvPreprocessFusion);
+
+    auto color_convert_m = ov::pass::pattern::
+        wrap_type<ov::op::v8::NV12toRGB, ov::op::v8::NV12toBGR, ov::op::v8::I420toRGB, ov::op::v8::I420toBGR>();
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        const auto color_convert = m.get_match_root();
+        if (transformation_callback(color_convert) || color_convert->get_output_partial_shape(0).rank() != 4) {
+            return false;
+        }
+
+        YuvPreprocessNode::Config config;
+        config.i420 = ov::is_type_any_of<ov::op::v8::I420toRGB, ov::op::v8::I420toBGR>(color_convert);
+        config.bgr = ov::is_type_any_of<ov::op::v8::NV12toBGR, ov::op::v8::I420toBGR>(color_convert);
+        config.round_rgb = color_convert->get_output_element_type(0) == ov::element::u8;
+
+        ov::NodeVector fused_nodes{color_convert};
+        ov::Output<ov::Node> value = color_convert->output(0);
+        while (const auto next = single_consumer(value)) {
+            const bool is_f32 = value.get_element_type() == ov::element::f32;
+            if (ov::is_type<ov::op::v0::Convert>(next)) {
+                if (value.get_element_type() != ov::element::u8 ||
+                    next->get_output_element_type(0) != ov::element::f32) {
+                    break;
+                }
+            } else if (!is_f32) {
+                break;
+            } else if (const auto resize_mode = get_resize_mode(next, config.planar ? 2 : 1);
+                       resize_mode && config.resize_mode == ResizeMode::NONE) {
+                config.resize_mode = *resize_mode;
+                const auto& out_shape = next->get_output_partial_shape(0);
+                config.height = out_shape[config.planar ? 2 : 1].get_length();
+                config.width = out_shape[config.planar ? 3 : 2].get_length();
+            } else if (fold_eltwise(next, value, config.planar ? 2 : 0, config.channel_scale, config.channel_shift)) {
+                // the values are folded into the config
+            } else if (!config.planar && is_nhwc_to_nchw(next)) {
+                config.planar = true;
+            } else {
+                break;
+            }
+            fused_nodes.push_back(next);
+            value = next->output(0);
+        }
+
+        if (fused_nodes.size() == 1 || value.get_element_type() != ov::element::f32) {
+            return false;
+        }
+
+        const auto last = value.get_node_shared_ptr();
+        auto preprocess = std::make_shared<YuvPreprocessNode>(color_convert->input_values(), config);
+        preprocess->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, preprocess);
+        ov::replace_node(last, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(color_convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
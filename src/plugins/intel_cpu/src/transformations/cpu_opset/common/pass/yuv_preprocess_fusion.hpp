@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the image preprocessing chain emitted by PrePostProcessor for a NV12 or I420 input into YuvPreprocessNode:
+ *
+ *     NV12/I420 to RGB/BGR -> [Convert(f32)] -> any order of: Interpolate(NEAREST/LINEAR, spatial axes),
+ *         Add/Subtract/Multiply/Divide(per channel constant), Transpose(NHWC -> NCHW)
+ *
+ * The per channel eltwise operations are folded into one scale and shift per channel. They commute with the
+ * resize, whose weights sum to one, so they may precede it. The chain is fused up to the first operation which
+ * does not match, and at least one operation has to follow the color conversion.
+ */
+class YuvPreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("YuvPreprocessFusion");
+    YuvPreprocessFusion();
+};
+
+}  // namespace ov::intel_cpu
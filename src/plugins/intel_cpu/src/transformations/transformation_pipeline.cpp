@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <set>
 #include <vector>
@@ -38,16 +39,26 @@
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
 #include "openvino/op/fake_quantize.hpp"
+#include "openvino/op/loop.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/max_pool.hpp"
 #include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/reduce_max.hpp"
 #include "openvino/op/reduce_sum.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
+#include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "ov_ops/gather_compressed.hpp"
 
 // Common transformations
@@ -77,6 +88,7 @@
 #include "transformations/common_optimizations/transpose_sinking.hpp"
 #include "transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp"
 #include "transformations/common_optimizations/wrap_interpolate_into_transposes.hpp"
+#include "transformations/control_flow/unroll_tensor_iterator.hpp"
 #include "transformations/convert_precision.hpp"
 #include "transformations/fp16_compression/convert_compression_only_to_legacy.hpp"
 #include "transformations/fp16_compression/mark_decompression_convert_constant_folding.hpp"
@@ -142,10 +154,12 @@
 
 // CPU specific transformations
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
+#include "transformations/cpu_opset/common/pass/logits_sampling_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/yuv_preprocess_fusion.hpp"
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
 #include "utils/precision_support.h"
 
@@ -282,6 +296,134 @@ namespace ov::intel_cpu {
 
 using const_node_ptr = const std::shared_ptr<const ov::Node>;
 
+// The decompression of an embedding table is fused into the EmbeddingBag node, which reads the compressed rows directly
+static bool is_embedding_table(const ov::Input<ov::Node>& input) {
+    return input.get_index() == 0 && ov::is_type_any_of<ov::op::util::EmbeddingBagOffsetsBase,
+                                                        ov::op::util::EmbeddingBagPackedBase,
+                                                        ov::op::v3::EmbeddingSegmentsSum>(input.get_node());
+}
+
+// Whether the shapes computed from an output of shape {1} stay the same when it is replaced with a scalar: each
+// consumer is an elementwise op which passes it on or broadcasts it against a tensor of a non-zero rank
+static bool broadcasts_as_scalar(const ov::Output<ov::Node>& output) {
+    for (const auto& target : output.get_target_inputs()) {
+        const auto consumer = target.get_node();
+        if (ov::is_type_any_of<ov::op::v0::Convert, ov::op::util::UnaryElementwiseArithmetic>(consumer)) {
+            if (!broadcasts_as_scalar(consumer->output(0))) {
+                return false;
+            }
+            continue;
+        }
+        if (!ov::is_type_any_of<ov::op::util::BinaryElementwiseArithmetic,
+                                ov::op::util::BinaryElementwiseComparison,
+                                ov::op::util::BinaryElementwiseLogical>(consumer) ||
+            consumer->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY) {
+            return false;
+        }
+        const auto& other = consumer->get_input_partial_shape(1 - target.get_index());
+        if (other.rank().is_dynamic() || other.rank().get_length() == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A TensorIterator or Loop with a few iterations over static shapes and a small body is unrolled into the outer graph:
+// the sliced inputs become Split outputs, the back edges become direct edges between the body copies and the
+// concatenated outputs are written by in-place Concat, so nothing is copied between the iterations
+static bool is_unrollable_loop(const_node_ptr& node) {
+    constexpr int64_t max_unrolled_iterations = 8;
+    constexpr size_t max_unrolled_ops = 128;
+
+    const auto sub_graph_op = ov::as_type_ptr<const ov::op::util::SubGraphOp>(node);
+    if (!sub_graph_op || node->is_dynamic()) {
+        return false;
+    }
+    const int64_t num_iter = sub_graph_op->get_num_iterations();
+    if (num_iter < 1 || num_iter > max_unrolled_iterations) {
+        return false;
+    }
+
+    if (const auto loop = ov::as_type_ptr<const ov::op::v5::Loop>(node)) {
+        // the unrolled body ignores the execution conditions, so the Loop must run exactly num_iter times
+        const auto execution_cond = ov::as_type_ptr<const ov::op::v0::Constant>(loop->get_input_node_shared_ptr(1));
+        if (!execution_cond || !execution_cond->cast_vector<bool>()[0]) {
+            return false;
+        }
+        const auto body_cond_idx = loop->get_special_body_ports().body_condition_output_idx;
+        if (body_cond_idx < 0) {
+            return false;
+        }
+        const auto body_cond = ov::as_type_ptr<const ov::op::v0::Constant>(
+            loop->get_function()->get_results()[body_cond_idx]->get_input_node_shared_ptr(0));
+        if (!body_cond || !body_cond->cast_vector<bool>()[0]) {
+            return false;
+        }
+        // the current iteration is replaced with an i64 scalar constant
+        const auto current_iteration_idx = loop->get_special_body_ports().current_iteration_input_idx;
+        if (current_iteration_idx >= 0) {
+            const auto& current_iteration = loop->get_function()->get_parameters()[current_iteration_idx];
+            if (current_iteration->get_element_type() != ov::element::i64) {
+                return false;
+            }
+            const auto& shape = current_iteration->get_partial_shape();
+            if (shape != ov::PartialShape{} &&
+                (shape != ov::PartialShape{1} || !broadcasts_as_scalar(current_iteration->output(0)))) {
+                return false;
+            }
+        }
+    }
+
+    const auto& body = sub_graph_op->get_function();
+    if (!body->get_sinks().empty()) {
+        return false;
+    }
+    size_t body_ops = 0;
+    for (const auto& op : body->get_ops()) {
+        // dynamic and empty bodies are left to the TensorIterator node
+        if (ov::is_type<ov::op::util::MultiSubGraphOp>(op) || op->is_dynamic()) {
+            return false;
+        }
+        for (const auto& output : op->outputs()) {
+            if (ov::shape_size(output.get_shape()) == 0) {
+                return false;
+            }
+        }
+        if (!ov::is_type_any_of<ov::op::v0::Parameter, ov::op::v0::Result, ov::op::v0::Constant>(op)) {
+            body_ops++;
+        }
+    }
+    if (body_ops * static_cast<size_t>(num_iter) > max_unrolled_ops) {
+        return false;
+    }
+
+    // the unrolling splits the sliced inputs and concatenates the outputs along the whole axis
+    auto covers_axis = [&](const ov::PartialShape& shape, int64_t axis, int64_t stride, int64_t part_size) {
+        const auto rank = shape.rank().get_length();
+        axis = axis < 0 ? axis + rank : axis;
+        return std::abs(stride) == part_size && shape[axis].get_length() == num_iter * part_size;
+    };
+    for (const auto& desc : sub_graph_op->get_input_descriptions()) {
+        if (const auto slice = ov::as_type_ptr<ov::op::util::SubGraphOp::SliceInputDescription>(desc);
+            slice && !covers_axis(node->get_input_partial_shape(slice->m_input_index),
+                                  slice->m_axis,
+                                  slice->m_stride,
+                                  slice->m_part_size)) {
+            return false;
+        }
+    }
+    for (const auto& desc : sub_graph_op->get_output_descriptions()) {
+        if (const auto concat = ov::as_type_ptr<ov::op::util::SubGraphOp::ConcatOutputDescription>(desc);
+            concat && !covers_axis(node->get_output_partial_shape(concat->m_output_index),
+                                   concat->m_axis,
+                                   concat->m_stride,
+                                   concat->m_part_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool Transformations::is_decompression_multiply(const_node_ptr& node) {
     auto is_1x1_conv = [](const ov::Node* node) {
         const auto* conv = ov::as_type<const ov::op::v1::Convolution>(node);
@@ -307,6 +449,9 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) {
     };
 
     const auto consumers = node->get_output_target_inputs(0);
+    if (!consumers.empty() && std::all_of(consumers.begin(), consumers.end(), is_embedding_table)) {
+        return true;
+    }
     if (all_has_type(consumers, ov::op::v0::MatMul::get_type_info_static()) ||
         all_has_type(consumers, ov::op::v1::Convolution::get_type_info_static())) {
         return true;
@@ -571,6 +716,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             const auto consumers = node->get_output_target_inputs(0);
             return std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& consumer) {
                 // @todo cover RNN type of ops as well
+                if (is_embedding_table(consumer)) {
+                    return false;
+                }
                 return !is_type_any_of<ov::op::v0::MatMul,
                                        ov::op::v1::Convolution,
                                        ov::op::v1::GroupConvolution,
@@ -582,6 +730,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
     CPU_REGISTER_PASS_COMMON(manager, SDPASubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::GatedDeltaNetFusion);
+    // before CommonOptimizations, which wraps the Interpolate of the NHWC image into transposes
+    CPU_REGISTER_PASS_COMMON(manager, YuvPreprocessFusion);
     ov::pass::ConvertPagedAttnInputs::KVCacheConfig cacheConfig;
     cacheConfig.keyCachePrecision = config.keyCachePrecision;
     cacheConfig.valueCachePrecision = config.valueCachePrecision;
@@ -634,6 +784,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::WrapInterpolateIntoTransposes);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::TransposeSinking);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertSequenceToTensorIterator);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::UnrollTensorIterator);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertOpSet2ToOpSet1);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertShapeOf3);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LSTMCellDecomposition);
@@ -733,6 +884,13 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         ov::pass::ConvertGRUSequenceToTensorIterator,
         ov::pass::ConvertLSTMSequenceToTensorIterator);
 
+    CPU_SET_CALLBACK_COMMON(
+        manager,
+        [](const_node_ptr& node) -> bool {
+            return !is_unrollable_loop(node);
+        },
+        ov::pass::UnrollTensorIterator);
+
     CPU_SET_CALLBACK_COMMON(
         manager,
         [](const_node_ptr& node) -> bool {
@@ -1120,6 +1278,7 @@ void Transformations::PostLpt() {
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionFlux);
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionLtxVideo);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, LogitsSamplingFusion);
 
 #if defined(OPENVINO_ARCH_X86_64)
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <sstream>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+// The state accumulates all the tokens, outputs are the prefix sums of the tokens of the current prompt, the prefix
+// sum of the last token only and the first 3 stored tokens. All of them depend on the previous chunks, so they differ
+// if a chunk misses the state. Only the first output follows the sequence of the tokens, the size of the last one
+// matches the chunk size of the test but it must not be concatenated over the chunks
+std::shared_ptr<ov::Model> make_stateful_model() {
+    auto embeds = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1, 4});
+    embeds->output(0).set_names({"inputs_embeds"});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, -1, 4}, ov::element::f32, "past"});
+    auto init = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1, 0, 4}, std::vector<float>{});
+    auto past = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+    auto all_tokens = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, embeds}, 1);
+    auto assign = std::make_shared<ov::op::v6::Assign>(all_tokens, variable);
+
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+    auto cumsum =
+        std::make_shared<ov::op::v0::CumSum>(all_tokens, ov::op::v0::Constant::create(ov::element::i64, {}, {1}));
+    auto past_len = std::make_shared<ov::op::v8::Gather>(std::make_shared<ov::op::v3::ShapeOf>(past),
+                                                         axis,
+                                                         ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+    auto stop = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {std::numeric_limits<int64_t>::max()});
+    auto step = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+    auto prompt_sums = std::make_shared<ov::op::v8::Slice>(cumsum, past_len, stop, step, axis);
+    auto last_sum = std::make_shared<ov::op::v8::Slice>(cumsum,
+                                                        ov::op::v0::Constant::create(ov::element::i64, {1}, {-1}),
+                                                        stop,
+                                                        step,
+                                                        axis);
+    auto head = std::make_shared<ov::op::v8::Slice>(all_tokens,
+                                                    ov::op::v0::Constant::create(ov::element::i64, {1}, {0}),
+                                                    ov::op::v0::Constant::create(ov::element::i64, {1}, {3}),
+                                                    step,
+                                                    axis);
+    // the reshape to the shape of the tokens ties the sequence dimension of the prompt sums to the tokens input
+    auto prompt_result = std::make_shared<ov::op::v0::Result>(
+        std::make_shared<ov::op::v1::Reshape>(prompt_sums, std::make_shared<ov::op::v3::ShapeOf>(embeds), false));
+    auto last_result = std::make_shared<ov::op::v0::Result>(last_sum);
+    auto head_result = std::make_shared<ov::op::v0::Result>(head);
+    return std::make_shared<ov::Model>(ov::ResultVector{prompt_result, last_result, head_result},
+                                       ov::SinkVector{assign},
+                                       ov::ParameterVector{embeds});
+}
+
+void compare_with_single_pass(ov::InferRequest& chunked, ov::InferRequest& reference) {
+    // the first prompt is split into 3 chunks, the second one into 2 and the last one fits a single chunk
+    for (size_t seq_len : {8, 5, 2}) {
+        auto embeds = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, seq_len, 4});
+        for (auto* request : {&chunked, &reference}) {
+            request->set_tensor("inputs_embeds", embeds);
+            request->infer();
+        }
+        ASSERT_EQ(chunked.get_output_tensor(0).get_shape(), (ov::Shape{1, seq_len, 4}));
+        ASSERT_EQ(chunked.get_output_tensor(1).get_shape(), (ov::Shape{1, 1, 4}));
+        ASSERT_EQ(chunked.get_output_tensor(2).get_shape(), (ov::Shape{1, 3, 4}));
+        for (size_t i = 0; i < 3; i++) {
+            ov::test::utils::compare(reference.get_output_tensor(i), chunked.get_output_tensor(i));
+        }
+        ASSERT_EQ(chunked.get_tensor("inputs_embeds").get_shape(), embeds.get_shape());
+    }
+    ov::test::utils::compare(reference.query_state()[0].get_state(), chunked.query_state()[0].get_state());
+}
+
+TEST(ChunkedPrefillTest, ChunkedPromptMatchesSinglePass) {
+    ov::Core core;
+    auto model = make_stateful_model();
+    auto chunked = core.compile_model(model, "CPU", {ov::intel_cpu::prefill_chunk_size(3)}).create_infer_request();
+    auto reference = core.compile_model(model, "CPU").create_infer_request();
+    compare_with_single_pass(chunked, reference);
+}
+
+TEST(ChunkedPrefillTest, ImportedModelMatchesSinglePass) {
+    // the outputs following the sequence are exported with the model, since the transformed one may lose the symbols
+    ov::Core core;
+    auto model = make_stateful_model();
+    std::stringstream blob;
+    core.compile_model(model, "CPU", {ov::intel_cpu::prefill_chunk_size(3)}).export_model(blob);
+    auto chunked = core.import_model(blob, "CPU", {ov::intel_cpu::prefill_chunk_size(3)}).create_infer_request();
+    auto reference = core.compile_model(model, "CPU").create_infer_request();
+    compare_with_single_pass(chunked, reference);
+}
+
+TEST(ChunkedPrefillTest, ChunkOfOneTokenIsRejected) {
+    ov::Core core;
+    EXPECT_THROW(core.compile_model(make_stateful_model(), "CPU", {ov::intel_cpu::prefill_chunk_size(1)}),
+                 ov::Exception);
+}
+
+}  // namespace
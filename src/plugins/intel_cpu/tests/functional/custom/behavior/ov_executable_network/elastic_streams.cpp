@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{4, 32});
+    auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{32, 16});
+    auto matmul =
+        std::make_shared<ov::op::v0::MatMul>(param, std::make_shared<ov::op::v0::Constant>(weights), false, false);
+    auto bias = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1, 16}, 0.5f);
+    auto relu = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Add>(matmul, bias));
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+}
+
+void infer_and_compare(std::vector<ov::InferRequest>& requests, ov::CompiledModel& reference) {
+    std::vector<ov::Tensor> inputs;
+    for (auto& request : requests) {
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 32}));
+        request.set_input_tensor(inputs.back());
+        request.start_async();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].wait();
+        auto reference_request = reference.create_infer_request();
+        reference_request.set_input_tensor(inputs[i]);
+        reference_request.infer();
+        ov::test::utils::compare(reference_request.get_output_tensor(), requests[i].get_output_tensor());
+    }
+}
+
+TEST(ElasticStreamsTest, NumStreamsChangeAppliesToExistingRequests) {
+    ov::Core core;
+    auto model = make_model();
+    auto compiled = core.compile_model(model, "CPU", {ov::num_streams(1)});
+    auto reference = core.compile_model(model, "CPU");
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 4; i++) {
+        requests.push_back(compiled.create_infer_request());
+    }
+    infer_and_compare(requests, reference);
+
+    for (int streams : {4, 2, 4}) {
+        OV_ASSERT_NO_THROW(compiled.set_property({ov::num_streams(streams)}));
+        ASSERT_EQ(streams, compiled.get_property(ov::num_streams));
+        ASSERT_EQ(static_cast<uint32_t>(streams), compiled.get_property(ov::optimal_number_of_infer_requests));
+        // the requests created before the change run on the new streams together with the new ones
+        requests.push_back(compiled.create_infer_request());
+        infer_and_compare(requests, reference);
+    }
+}
+
+TEST(ElasticStreamsTest, NumStreamsChangeWhileRequestsAreRunning) {
+    ov::Core core;
+    auto model = make_model();
+    auto compiled = core.compile_model(model, "CPU", {ov::num_streams(4)});
+    auto reference = core.compile_model(model, "CPU");
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> inputs;
+    for (size_t i = 0; i < 8; i++) {
+        requests.push_back(compiled.create_infer_request());
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 32}));
+        requests.back().set_input_tensor(inputs.back());
+    }
+    for (int streams : {2, 1, 3}) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        // the change waits for the requests queued to the previous streams, so their results are not affected
+        OV_ASSERT_NO_THROW(compiled.set_property({ov::num_streams(streams)}));
+        ASSERT_EQ(streams, compiled.get_property(ov::num_streams));
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            auto reference_request = reference.create_infer_request();
+            reference_request.set_input_tensor(inputs[i]);
+            reference_request.infer();
+            ov::test::utils::compare(reference_request.get_output_tensor(), requests[i].get_output_tensor());
+        }
+    }
+}
+
+TEST(ElasticStreamsTest, WrongNumStreamsIsRejected) {
+    ov::Core core;
+    auto compiled = core.compile_model(make_model(), "CPU", {ov::num_streams(2)});
+    EXPECT_THROW(compiled.set_property({ov::num_streams(0)}), ov::Exception);
+    EXPECT_THROW(compiled.set_property({ov::num_streams(ov::streams::AUTO)}), ov::Exception);
+    EXPECT_THROW(compiled.set_property({ov::enable_profiling(true)}), ov::Exception);
+    ASSERT_EQ(2, compiled.get_property(ov::num_streams));
+}
+
+}  // namespace
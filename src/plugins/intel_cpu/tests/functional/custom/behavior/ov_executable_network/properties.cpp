@@ -31,7 +31,7 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::supported_properties.name()),
         RO_property(ov::model_name.name()),
         RO_property(ov::optimal_number_of_infer_requests.name()),
-        RO_property(ov::num_streams.name()),
+        ov::PropertyName(ov::num_streams.name(), ov::PropertyMutability::RW),
         RO_property(ov::inference_num_threads.name()),
         RO_property(ov::enable_profiling.name()),
         RO_property(ov::hint::inference_precision.name()),
@@ -41,6 +41,7 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::enable_cpu_reservation.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::hint::model_distribution_policy.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
         RO_property(ov::execution_devices.name()),
@@ -91,7 +92,8 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetROPropertiesThrow) {
 
     for (auto it = properties.begin(); it != properties.end(); ++it) {
         ASSERT_TRUE(it != properties.end());
-        ASSERT_FALSE(it->is_mutable());
+        // the number of streams can be changed after compilation
+        ASSERT_EQ(*it == ov::num_streams.name(), it->is_mutable());
         ASSERT_THROW(compiledModel.set_property({{*it, "DUMMY VALUE"}}), ov::Exception);
     }
 }
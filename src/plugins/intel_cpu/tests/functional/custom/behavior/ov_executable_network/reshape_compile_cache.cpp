@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{2, 16});
+    param->output(0).set_names({"input"});
+    auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{16, 8});
+    auto matmul =
+        std::make_shared<ov::op::v0::MatMul>(param, std::make_shared<ov::op::v0::Constant>(weights), false, false);
+    auto bias = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1, 8}, 0.5f);
+    auto relu = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Add>(matmul, bias));
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+}
+
+ov::Tensor infer(ov::CompiledModel& compiled_model, const ov::Tensor& input) {
+    auto request = compiled_model.create_infer_request();
+    request.set_input_tensor(input);
+    request.infer();
+    return request.get_output_tensor();
+}
+
+TEST(ReshapeCompileCacheTest, ReshapedModelsMatchFullCompilation) {
+    ov::Core core;
+    auto model = make_model();
+    const ov::AnyMap cache_config = {ov::intel_cpu::enable_reshape_compile_cache(true)};
+    const auto hits = [&]() {
+        return core.get_property("CPU", ov::intel_cpu::reshape_compile_cache_hits);
+    };
+    const auto initial_hits = hits();
+
+    // The first compilation transforms the model with dynamic input dimensions, the following ones reshape it
+    const std::vector<ov::Shape> shapes{{2, 16}, {4, 16}, {2, 16}, {1, 16}, {8, 16}};
+    for (size_t i = 0; i < shapes.size(); i++) {
+        const auto& shape = shapes[i];
+        model->reshape(ov::PartialShape(shape));
+        auto cached = core.compile_model(model, "CPU", cache_config);
+        ASSERT_EQ(hits(), initial_hits + i);
+        auto reference = core.compile_model(model, "CPU");
+
+        ASSERT_EQ(cached.input().get_partial_shape(), ov::PartialShape(shape));
+        ASSERT_EQ(cached.output().get_partial_shape(), ov::PartialShape({static_cast<int64_t>(shape[0]), 8}));
+        ASSERT_EQ(cached.output().get_names(), reference.output().get_names());
+
+        auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape);
+        ov::test::utils::compare(infer(reference, input), infer(cached, input));
+    }
+    // The cache is keyed by the compile properties as well
+    model->reshape(ov::PartialShape(shapes[0]));
+    core.compile_model(model, "CPU", {ov::intel_cpu::enable_reshape_compile_cache(true), ov::num_streams(1)});
+    ASSERT_EQ(hits(), initial_hits + shapes.size() - 1);
+}
+
+}  // namespace
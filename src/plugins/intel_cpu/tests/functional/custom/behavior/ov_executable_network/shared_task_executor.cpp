@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model(size_t layers) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{4, 32});
+    ov::Output<ov::Node> output = param;
+    for (size_t i = 0; i < layers; i++) {
+        auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{32, 32});
+        auto matmul =
+            std::make_shared<ov::op::v0::MatMul>(output, std::make_shared<ov::op::v0::Constant>(weights), false, false);
+        auto bias = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1, 32}, 0.5f);
+        output = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Add>(matmul, bias));
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{param});
+}
+
+// independent branches of the matmuls, which are executed as a parallel section with the inter-op parallelism
+std::shared_ptr<ov::Model> make_branched_model(size_t branches, size_t layers) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{4, 32});
+    ov::OutputVector outputs;
+    for (size_t b = 0; b < branches; b++) {
+        ov::Output<ov::Node> output = param;
+        for (size_t i = 0; i < layers; i++) {
+            auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{32, 32});
+            output = std::make_shared<ov::op::v0::Relu>(
+                std::make_shared<ov::op::v0::MatMul>(output, std::make_shared<ov::op::v0::Constant>(weights)));
+        }
+        outputs.push_back(output);
+    }
+    auto concat = std::make_shared<ov::op::v0::Concat>(outputs, 1);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param});
+}
+
+TEST(SharedTaskExecutorTest, PrioritizedModelsMatchReference) {
+    ov::Core core;
+    struct Case {
+        std::shared_ptr<ov::Model> model;
+        ov::hint::Priority priority;
+        uint32_t latency_budget_ms;
+    };
+    // the long low priority model is preempted between its nodes by the requests of the other ones
+    std::vector<Case> cases{{make_model(16), ov::hint::Priority::LOW, 0},
+                            {make_model(2), ov::hint::Priority::MEDIUM, 100},
+                            {make_model(2), ov::hint::Priority::MEDIUM, 10},
+                            {make_model(1), ov::hint::Priority::HIGH, 0}};
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::InferRequest> references;
+    std::vector<ov::Tensor> inputs;
+    for (const auto& test_case : cases) {
+        auto compiled_model = core.compile_model(test_case.model,
+                                                 "CPU",
+                                                 {ov::num_streams(2),
+                                                  ov::hint::model_priority(test_case.priority),
+                                                  ov::intel_cpu::shared_task_executor(true),
+                                                  ov::intel_cpu::latency_budget_ms(test_case.latency_budget_ms)});
+        ASSERT_EQ(test_case.priority, compiled_model.get_property(ov::hint::model_priority));
+        auto reference = core.compile_model(test_case.model, "CPU");
+        for (size_t i = 0; i < 4; i++) {
+            requests.push_back(compiled_model.create_infer_request());
+            references.push_back(reference.create_infer_request());
+            inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 32}));
+        }
+    }
+    for (size_t iter = 0; iter < 3; iter++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].set_input_tensor(inputs[i]);
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            references[i].set_input_tensor(inputs[i]);
+            references[i].infer();
+            ov::test::utils::compare(references[i].get_output_tensor(), requests[i].get_output_tensor());
+        }
+    }
+}
+
+TEST(SharedTaskExecutorTest, PreemptionDoesNotEnterParallelSections) {
+    // the low priority model executes parallel sections, the high priority requests must not be executed inside of
+    // them, as they would use the scratchpad slot of the section
+    ov::Core core;
+    const auto low_model = make_branched_model(4, 8);
+    const auto high_model = make_model(1);
+    auto low = core.compile_model(low_model,
+                                  "CPU",
+                                  {ov::num_streams(1),
+                                   ov::hint::model_priority(ov::hint::Priority::LOW),
+                                   ov::intel_cpu::shared_task_executor(true),
+                                   ov::intel_cpu::enable_inter_op_parallelism(true)});
+    auto high = core.compile_model(high_model,
+                                   "CPU",
+                                   {ov::num_streams(1),
+                                    ov::hint::model_priority(ov::hint::Priority::HIGH),
+                                    ov::intel_cpu::shared_task_executor(true)});
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::InferRequest> references;
+    std::vector<ov::Tensor> inputs;
+    for (size_t i = 0; i < 8; i++) {
+        const bool is_low = i % 2 == 0;
+        requests.push_back(is_low ? low.create_infer_request() : high.create_infer_request());
+        references.push_back(core.compile_model(is_low ? low_model : high_model, "CPU").create_infer_request());
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 32}));
+    }
+    for (size_t iter = 0; iter < 5; iter++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].set_input_tensor(inputs[i]);
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            references[i].set_input_tensor(inputs[i]);
+            references[i].infer();
+            ov::test::utils::compare(references[i].get_output_tensor(), requests[i].get_output_tensor());
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> make_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{4, 32});
+    auto weights = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{32, 16});
+    auto matmul =
+        std::make_shared<ov::op::v0::MatMul>(param, std::make_shared<ov::op::v0::Constant>(weights), false, false);
+    auto bias = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1, 16}, 0.5f);
+    auto relu = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Add>(matmul, bias));
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+}
+
+TEST(StreamAffinityTest, PinnedRequestsMatchReference) {
+    ov::Core core;
+    auto model = make_model();
+    auto pinned = core.compile_model(model,
+                                     "CPU",
+                                     {ov::num_streams(4), ov::intel_cpu::enable_stream_affinity(true)});
+    auto reference = core.compile_model(model, "CPU");
+
+    // more requests than streams, so some of them share the preferred stream and may be stolen by an idle one
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> inputs;
+    for (size_t i = 0; i < 8; i++) {
+        requests.push_back(pinned.create_infer_request());
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{4, 32}));
+    }
+    for (size_t iter = 0; iter < 3; iter++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            // the first inference touches the tensors of the request on its preferred stream, but keeps this input
+            auto input = requests[i].get_input_tensor();
+            inputs[i].copy_to(input);
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            auto reference_request = reference.create_infer_request();
+            reference_request.set_input_tensor(inputs[i]);
+            reference_request.infer();
+            ov::test::utils::compare(reference_request.get_output_tensor(), requests[i].get_output_tensor());
+        }
+    }
+}
+
+}  // namespace
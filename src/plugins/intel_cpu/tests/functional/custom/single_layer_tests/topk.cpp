@@ -396,6 +396,45 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+std::vector<ov::test::InputShape> inputShapes_long_axis = {
+    {{}, {{1, 1, 2, 40000}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_long_axis = {
+    {{1, 1, -1, -1}, {{1, 1, 1, 50000}, {1, 1, 3, 20000}}}};
+
+const std::vector<int64_t> k_long_axis = {1, 300};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_TopK_long_axis,
+    TopKLayerCPUTest,
+    ::testing::Combine(::testing::Combine(::testing::ValuesIn(k_long_axis),
+                                          ::testing::Values(3),
+                                          ::testing::ValuesIn(modes),
+                                          ::testing::ValuesIn(sortTypeStable),
+                                          ::testing::ValuesIn(netPrecisions),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::ValuesIn(inputShapes_long_axis)),
+                       ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+                       ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_TopK_long_axis_dynamic,
+    TopKLayerCPUTest,
+    ::testing::Combine(::testing::Combine(::testing::Values(1),
+                                          ::testing::Values(3),
+                                          ::testing::ValuesIn(modes),
+                                          ::testing::ValuesIn(sortTypeStable),
+                                          ::testing::ValuesIn(netPrecisions),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::ValuesIn(inputShapesDynamic_long_axis)),
+                       ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+                       ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
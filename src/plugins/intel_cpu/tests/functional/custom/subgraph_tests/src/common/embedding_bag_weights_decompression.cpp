@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
+#include "openvino/op/embeddingbag_offsets.hpp"
+#include "openvino/op/embeddingbag_packed.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *   Constant(u8/i8/u4/i4/f16)
+ *            |
+ *         Convert
+ *            |
+ *   Subtract(zero points [N, 1]) (optional)
+ *            |
+ *   Multiply(scales [N, 1]) (integer tables only)      per_sample_weights
+ *            |                                               |
+ *   EmbeddingBagOffsets / EmbeddingBagPacked / EmbeddingSegmentsSum
+ *
+ * The decompression is expected to be fused into the embedding node, which reads the compressed table directly.
+ */
+enum class EmbeddingOp { OFFSETS, PACKED, SEGMENTS };
+
+std::ostream& operator<<(std::ostream& os, EmbeddingOp op) {
+    switch (op) {
+    case EmbeddingOp::OFFSETS:
+        return os << "EmbeddingBagOffsets";
+    case EmbeddingOp::PACKED:
+        return os << "EmbeddingBagPacked";
+    case EmbeddingOp::SEGMENTS:
+        return os << "EmbeddingSegmentsSum";
+    }
+    return os;
+}
+
+using EmbeddingBagWeightsDecompressionParams = std::tuple<EmbeddingOp, element::Type, bool>;
+
+class EmbeddingBagWeightsDecompression : public testing::WithParamInterface<EmbeddingBagWeightsDecompressionParams>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagWeightsDecompressionParams>& obj) {
+        const auto& [embedding_op, table_prec, with_zero_point] = obj.param;
+        std::ostringstream result;
+        result << embedding_op << "_table_prec=" << table_prec << "_zero_point=" << with_zero_point;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        abs_threshold = 1e-4;
+        const auto& [embedding_op, table_prec, with_zero_point] = GetParam();
+
+        const size_t rows = 64;
+        const size_t depth = 37;
+        const bool is_float_table = table_prec.is_real();
+        const auto table_range = table_prec.bitwidth() == 4 ? 15 : 255;
+        const auto table_start = table_prec.is_signed() && !is_float_table ? -(table_range + 1) / 2 : 0;
+        auto table = utils::make_constant(table_prec,
+                                          Shape{rows, depth},
+                                          utils::InputGenerateData(table_start, table_range, is_float_table ? 8 : 1));
+        std::shared_ptr<Node> decompressed = std::make_shared<op::v0::Convert>(table, element::f32);
+        if (!is_float_table) {
+            if (with_zero_point) {
+                auto zero_points =
+                    utils::make_constant(element::f32, Shape{rows, 1}, utils::InputGenerateData(table_start, 8));
+                decompressed = std::make_shared<op::v1::Subtract>(decompressed, zero_points);
+            }
+            auto scales = utils::make_constant(element::f32, Shape{rows, 1}, utils::InputGenerateData(0, 1, 1000));
+            decompressed = std::make_shared<op::v1::Multiply>(decompressed, scales);
+        }
+
+        const std::vector<int32_t> indices_values{0, 2, 63, 5, 5, 17, 40, 1, 62, 33, 7, 9};
+        const auto num_indices = indices_values.size();
+        std::shared_ptr<op::v0::Parameter> per_sample_weights;
+        std::shared_ptr<Node> embedding;
+        switch (embedding_op) {
+        case EmbeddingOp::OFFSETS: {
+            init_input_shapes({InputShape{{}, {{num_indices}}}});
+            per_sample_weights = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+            auto indices = op::v0::Constant::create(element::i32, Shape{num_indices}, indices_values);
+            // an empty bag in the middle and a bag of a single index at the end
+            auto offsets = op::v0::Constant::create(element::i32, Shape{5}, {0, 3, 3, 7, 11});
+            auto default_index = op::v0::Constant::create(element::i32, Shape{}, {0});
+            embedding = std::make_shared<op::v3::EmbeddingBagOffsetsSum>(decompressed,
+                                                                         indices,
+                                                                         offsets,
+                                                                         default_index,
+                                                                         per_sample_weights);
+            break;
+        }
+        case EmbeddingOp::PACKED: {
+            const Shape indices_shape{3, num_indices / 3};
+            init_input_shapes({InputShape{{}, {indices_shape}}});
+            per_sample_weights = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+            auto indices = op::v0::Constant::create(element::i32, indices_shape, indices_values);
+            embedding = std::make_shared<op::v3::EmbeddingBagPackedSum>(decompressed, indices, per_sample_weights);
+            break;
+        }
+        case EmbeddingOp::SEGMENTS: {
+            init_input_shapes({InputShape{{}, {{num_indices}}}});
+            per_sample_weights = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+            auto indices = op::v0::Constant::create(element::i32, Shape{num_indices}, indices_values);
+            auto segment_ids =
+                op::v0::Constant::create(element::i32, Shape{num_indices}, {0, 0, 0, 2, 2, 2, 2, 3, 3, 3, 3, 5});
+            auto num_segments = op::v0::Constant::create(element::i32, Shape{}, {6});
+            auto default_index = op::v0::Constant::create(element::i32, Shape{}, {1});
+            embedding = std::make_shared<op::v3::EmbeddingSegmentsSum>(decompressed,
+                                                                       indices,
+                                                                       segment_ids,
+                                                                       num_segments,
+                                                                       default_index,
+                                                                       per_sample_weights);
+            break;
+        }
+        }
+
+        function = std::make_shared<Model>(embedding, ParameterVector{per_sample_weights});
+    }
+};
+
+TEST_P(EmbeddingBagWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<EmbeddingOp> embeddingOps = {EmbeddingOp::OFFSETS, EmbeddingOp::PACKED, EmbeddingOp::SEGMENTS};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagWeightsDecompression_integer,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingOps),
+                                            ::testing::Values(element::u8, element::i8, element::u4, element::i4),
+                                            ::testing::Bool()),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagWeightsDecompression_float,
+                         EmbeddingBagWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(embeddingOps),
+                                            ::testing::Values(element::f16),
+                                            ::testing::Values(false)),
+                         EmbeddingBagWeightsDecompression::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
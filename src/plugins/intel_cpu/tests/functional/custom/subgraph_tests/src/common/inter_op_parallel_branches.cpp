@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph with inter-op parallelism enabled:
+
+                          param
+                  /     /       \       \
+            Conv1x1  Conv3x3  MaxPool   Relu
+               |        |        |       |
+             Relu    Conv3x3  Conv1x1   Add --- Result
+                \       |        /      /
+                        Concat
+                          |
+                        Result
+
+The branches are executed in parallel, the test checks that the memory is not reused between them.
+*/
+
+namespace ov {
+namespace test {
+
+class InterOpParallelBranches : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::enable_inter_op_parallelism(true));
+        const auto precision = ov::element::f32;
+        init_input_shapes({{{}, {{1, 16, 14, 14}}}});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto make_conv = [&](const ov::Output<ov::Node>& input, size_t kernel) {
+            const std::vector<ptrdiff_t> pads(2, kernel / 2);
+            return utils::make_convolution(input,
+                                           precision,
+                                           {kernel, kernel},
+                                           {1, 1},
+                                           pads,
+                                           pads,
+                                           {1, 1},
+                                           ov::op::PadType::EXPLICIT,
+                                           16,
+                                           true);
+        };
+
+        auto branch_1 = std::make_shared<ov::op::v0::Relu>(make_conv(param, 1));
+        auto branch_2 = make_conv(make_conv(param, 3), 3);
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(param,
+                                                          ov::Strides{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{3, 3});
+        auto branch_3 = make_conv(pool, 1);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto add_const = std::make_shared<ov::op::v0::Constant>(precision, ov::Shape{1}, std::vector<float>{1.0f});
+        auto branch_4 = utils::make_eltwise(relu, add_const, utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::NodeVector{branch_1, branch_2, branch_3, branch_4}, 1);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat),
+                                 std::make_shared<ov::op::v0::Result>(branch_4)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "InterOpParallelBranches");
+    }
+};
+
+TEST_F(InterOpParallelBranches, smoke_CompareWithRefs) {
+    run();
+}
+
+/*The second branch contains an If node, the inner graphs of which share the scratchpad with the outer graph:
+
+                          param        cond
+                  /         |           |
+            Conv3x3        If ----------+
+               |     (Conv3x3 | Relu)
+                \         /
+                  Concat
+                    |
+                  Result
+
+The If node must not be executed concurrently with the other branch.
+*/
+class InterOpParallelBranchesWithIf : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::enable_inter_op_parallelism(true));
+        const auto precision = ov::element::f32;
+        init_input_shapes({{{}, {{1, 16, 14, 14}}}, {{}, {{1}}}});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto cond = std::make_shared<ov::op::v0::Parameter>(ov::element::boolean, inputDynamicShapes[1]);
+
+        auto make_conv = [&](const ov::Output<ov::Node>& input) {
+            const std::vector<ptrdiff_t> pads(2, 1);
+            return utils::make_convolution(input,
+                                           precision,
+                                           {3, 3},
+                                           {1, 1},
+                                           pads,
+                                           pads,
+                                           {1, 1},
+                                           ov::op::PadType::EXPLICIT,
+                                           16,
+                                           true);
+        };
+
+        auto then_param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto then_result = std::make_shared<ov::op::v0::Result>(make_conv(then_param));
+        auto then_body = std::make_shared<ov::Model>(ov::ResultVector{then_result}, ov::ParameterVector{then_param});
+
+        auto else_param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto else_result = std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v0::Relu>(else_param));
+        auto else_body = std::make_shared<ov::Model>(ov::ResultVector{else_result}, ov::ParameterVector{else_param});
+
+        auto if_op = std::make_shared<ov::op::v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(param, then_param, else_param);
+        auto if_output = if_op->set_output(then_result, else_result);
+
+        auto branch_1 = make_conv(make_conv(param));
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch_1, if_output}, 1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                               ov::ParameterVector{param, cond},
+                                               "InterOpParallelBranchesWithIf");
+    }
+};
+
+TEST_F(InterOpParallelBranchesWithIf, smoke_CompareWithRefs) {
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *                 logits
+ *                    |
+ *        [TopK(max) ------------------ indices]
+ *                    |                    |
+ *   Multiply/Divide(temperature)          |
+ *                    |                    |
+ *            [Softmax(last axis)]         |
+ *                    |                    |
+ *               Multinomial               |
+ *                    |                    |
+ *               [Gather(batch_dims=1) ----+]
+ *
+ * The chain is fused into a single LogitsSampling node. The Softmax is omitted if the Multinomial takes log
+ * probabilities, the TopK and the Gather are present in the top k chain only.
+ */
+enum class SamplingChain { SOFTMAX, LOG_PROBS, TOP_K };
+
+std::ostream& operator<<(std::ostream& os, SamplingChain chain) {
+    switch (chain) {
+    case SamplingChain::SOFTMAX:
+        return os << "Softmax";
+    case SamplingChain::LOG_PROBS:
+        return os << "LogProbs";
+    case SamplingChain::TOP_K:
+        return os << "TopK";
+    }
+    return os;
+}
+
+using LogitsSamplingParams = std::tuple<InputShape, SamplingChain, bool, element::Type>;
+
+class LogitsSamplingCPUTest : public testing::WithParamInterface<LogitsSamplingParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LogitsSamplingParams>& obj) {
+        const auto& [shape, chain, with_replacement, output_type] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_chain=" << chain << "_with_replacement=" << with_replacement
+               << "_output_type=" << output_type;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, chain, with_replacement, output_type] = GetParam();
+        init_input_shapes({shape});
+
+        auto logits = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+        Output<Node> values = logits;
+        std::shared_ptr<op::v11::TopK> topk;
+        if (chain == SamplingChain::TOP_K) {
+            auto k = op::v0::Constant::create(element::i64, Shape{}, {40});
+            topk = std::make_shared<op::v11::TopK>(logits,
+                                                   k,
+                                                   -1,
+                                                   op::TopKMode::MAX,
+                                                   op::TopKSortType::SORT_VALUES,
+                                                   output_type);
+            values = topk->output(0);
+        }
+        auto temperature = op::v0::Constant::create(element::f32, Shape{}, {0.8f});
+        values = std::make_shared<op::v1::Divide>(values, temperature);
+        if (chain != SamplingChain::LOG_PROBS) {
+            values = std::make_shared<op::v8::Softmax>(values, -1);
+        }
+        auto num_samples = op::v0::Constant::create(element::i32, Shape{1}, {4});
+        std::shared_ptr<Node> samples = std::make_shared<op::v13::Multinomial>(values,
+                                                                             num_samples,
+                                                                             output_type,
+                                                                             with_replacement,
+                                                                             chain == SamplingChain::LOG_PROBS,
+                                                                             1,
+                                                                             2);
+        if (topk) {
+            auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
+            samples = std::make_shared<op::v8::Gather>(topk->output(1), samples, axis, 1);
+        }
+        function = std::make_shared<Model>(samples, ParameterVector{logits});
+    }
+
+    void generate_inputs(const std::vector<Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        utils::InputGenerateData logits_data(-4, 8, 1000);
+        inputs.insert({funcInputs[0].get_node_shared_ptr(),
+                       utils::create_and_fill_tensor(element::f32, targetInputStaticShapes[0], logits_data)});
+    }
+};
+
+TEST_P(LogitsSamplingCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithTypes(compiledModel, {"Multinomial", "Softmax", "TopK", "Gather", "Eltwise"}, 0);
+    CheckNumberOfNodesWithType(compiledModel, "LogitsSampling", 1);
+}
+
+namespace {
+
+const std::vector<InputShape> logitsShapes = {
+    {{}, {{1, 1000}}},
+    {{}, {{3, 300}}},
+    {{-1, -1}, {{1, 2000}, {4, 100}, {2, 700}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LogitsSampling,
+                         LogitsSamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(logitsShapes),
+                                            ::testing::Values(SamplingChain::SOFTMAX,
+                                                              SamplingChain::LOG_PROBS,
+                                                              SamplingChain::TOP_K),
+                                            ::testing::Bool(),
+                                            ::testing::Values(element::i32, element::i64)),
+                         LogitsSamplingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
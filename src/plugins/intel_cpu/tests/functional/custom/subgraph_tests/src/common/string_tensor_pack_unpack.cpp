@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/string_tensor_pack.hpp"
+#include "openvino/op/string_tensor_unpack.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *  begins  ends  symbols
+ *      \    |    /
+ *   StringTensorPack
+ *          |
+ *   StringTensorUnpack
+ *      /    |    \
+ *  Result Result Result
+ *
+ * The unpack reads the packed tensors directly and no string tensor is materialized. The begins and ends leave gaps
+ * in the symbols, so the symbols are compacted by the unpack.
+ */
+using StringTensorUnpackOfPackParams = std::tuple<InputShape, element::Type>;
+
+class StringTensorUnpackOfPackCPUTest : public testing::WithParamInterface<StringTensorUnpackOfPackParams>,
+                                        virtual public SubgraphBaseTest,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StringTensorUnpackOfPackParams>& obj) {
+        const auto& [shape, indices_prec] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_indices_prec=" << indices_prec;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, indices_prec] = GetParam();
+        init_input_shapes({shape, shape, InputShape{{-1}, std::vector<Shape>(shape.second.size(), Shape{0})}});
+
+        auto begins = std::make_shared<op::v0::Parameter>(indices_prec, inputDynamicShapes[0]);
+        auto ends = std::make_shared<op::v0::Parameter>(indices_prec, inputDynamicShapes[1]);
+        auto symbols = std::make_shared<op::v0::Parameter>(element::u8, inputDynamicShapes[2]);
+        auto pack = std::make_shared<op::v15::StringTensorPack>(begins, ends, symbols);
+        auto unpack = std::make_shared<op::v15::StringTensorUnpack>(pack);
+        function = std::make_shared<Model>(unpack->outputs(), ParameterVector{begins, ends, symbols});
+    }
+
+    void generate_inputs(const std::vector<Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        const auto indices_prec = funcInputs[0].get_element_type();
+        const auto& shape = targetInputStaticShapes[0];
+        const auto count = shape_size(shape);
+
+        std::mt19937 gen(static_cast<unsigned>(count));
+        std::uniform_int_distribution<int64_t> length(0, 7);
+        std::vector<int64_t> begins_values(count);
+        std::vector<int64_t> ends_values(count);
+        int64_t offset = 0;
+        for (size_t i = 0; i < count; i++) {
+            offset += length(gen) / 2;  // gap
+            begins_values[i] = offset;
+            offset += length(gen);
+            ends_values[i] = offset;
+        }
+
+        ov::Tensor begins_tensor(indices_prec, shape);
+        ov::Tensor ends_tensor(indices_prec, shape);
+        for (size_t i = 0; i < count; i++) {
+            if (indices_prec == element::i64) {
+                begins_tensor.data<int64_t>()[i] = begins_values[i];
+                ends_tensor.data<int64_t>()[i] = ends_values[i];
+            } else {
+                begins_tensor.data<int32_t>()[i] = static_cast<int32_t>(begins_values[i]);
+                ends_tensor.data<int32_t>()[i] = static_cast<int32_t>(ends_values[i]);
+            }
+        }
+        utils::InputGenerateData symbols_data(0, 255);
+        auto symbols_tensor =
+            utils::create_and_fill_tensor(element::u8, Shape{static_cast<size_t>(offset)}, symbols_data);
+
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), begins_tensor});
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), ends_tensor});
+        inputs.insert({funcInputs[2].get_node_shared_ptr(), symbols_tensor});
+    }
+};
+
+TEST_P(StringTensorUnpackOfPackCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "StringTensorPack", 0);
+    CheckNumberOfNodesWithType(compiledModel, "StringTensorUnpack", 1);
+}
+
+/*
+ *        data
+ *         |
+ *   StringTensorUnpack
+ *      /    |    \
+ *   StringTensorPack
+ *          |
+ *        Result
+ *
+ * The pair is an identity and is removed.
+ */
+class StringTensorPackOfUnpackCPUTest : public testing::WithParamInterface<InputShape>,
+                                        virtual public SubgraphBaseTest,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputShape>& obj) {
+        std::ostringstream result;
+        result << "IS=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        init_input_shapes({GetParam()});
+
+        auto data = std::make_shared<op::v0::Parameter>(element::string, inputDynamicShapes[0]);
+        auto unpack = std::make_shared<op::v15::StringTensorUnpack>(data);
+        auto pack =
+            std::make_shared<op::v15::StringTensorPack>(unpack->output(0), unpack->output(1), unpack->output(2));
+        function = std::make_shared<Model>(pack, ParameterVector{data});
+    }
+
+    void generate_inputs(const std::vector<Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        utils::InputGenerateData data(0, 10);
+        inputs.insert({funcInputs[0].get_node_shared_ptr(),
+                       utils::create_and_fill_tensor(element::string, targetInputStaticShapes[0], data)});
+    }
+};
+
+TEST_P(StringTensorPackOfUnpackCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithTypes(compiledModel, {"StringTensorPack", "StringTensorUnpack"}, 0);
+}
+
+namespace {
+
+const std::vector<InputShape> stringShapes = {
+    {{}, {{5}}},
+    {{}, {{2, 3, 4}}},
+    {{-1, -1}, {{1, 1}, {4, 8}, {2, 2}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StringTensorUnpackOfPack,
+                         StringTensorUnpackOfPackCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(stringShapes),
+                                            ::testing::Values(element::i32, element::i64)),
+                         StringTensorUnpackOfPackCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_StringTensorPackOfUnpack,
+                         StringTensorPackOfUnpackCPUTest,
+                         ::testing::ValuesIn(stringShapes),
+                         StringTensorPackOfUnpackCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *            logits
+ *              |
+ *          TopK(max) ------------ indices
+ *              |
+ *   [Multiply/Divide(temperature)]
+ *              |
+ *      Softmax(last axis)
+ *
+ * The softmax of the top k logits is computed by the TopK node, the temperature scale is fused as well.
+ */
+enum class TemperatureOp { NONE, MULTIPLY, DIVIDE };
+
+std::ostream& operator<<(std::ostream& os, TemperatureOp temperature_op) {
+    switch (temperature_op) {
+    case TemperatureOp::NONE:
+        return os << "None";
+    case TemperatureOp::MULTIPLY:
+        return os << "Multiply";
+    case TemperatureOp::DIVIDE:
+        return os << "Divide";
+    }
+    return os;
+}
+
+using TopKSoftmaxParams = std::tuple<InputShape, int64_t, TemperatureOp>;
+
+class TopKSoftmaxCPUTest : public testing::WithParamInterface<TopKSoftmaxParams>,
+                           virtual public SubgraphBaseTest,
+                           public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TopKSoftmaxParams>& obj) {
+        const auto& [shape, k, temperature_op] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_k=" << k << "_temperature=" << temperature_op;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, k, temperature_op] = GetParam();
+        init_input_shapes({shape});
+
+        auto logits = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+        auto k_const = op::v0::Constant::create(element::i64, Shape{}, {k});
+        auto topk = std::make_shared<op::v11::TopK>(logits,
+                                                    k_const,
+                                                    -1,
+                                                    op::TopKMode::MAX,
+                                                    op::TopKSortType::SORT_VALUES,
+                                                    element::i32);
+        Output<Node> scaled = topk->output(0);
+        if (temperature_op == TemperatureOp::MULTIPLY) {
+            auto scale = op::v0::Constant::create(element::f32, Shape{}, {1.25f});
+            scaled = std::make_shared<op::v1::Multiply>(scaled, scale);
+        } else if (temperature_op == TemperatureOp::DIVIDE) {
+            auto temperature = op::v0::Constant::create(element::f32, Shape{}, {0.7f});
+            scaled = std::make_shared<op::v1::Divide>(scaled, temperature);
+        }
+        const auto axis = static_cast<size_t>(inputDynamicShapes[0].rank().get_length() - 1);
+        auto softmax = std::make_shared<op::v1::Softmax>(scaled, axis);
+        function = std::make_shared<Model>(OutputVector{softmax, topk->output(1)}, ParameterVector{logits});
+    }
+
+    void generate_inputs(const std::vector<Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        // unique values, so the indices of the top k elements are defined unambiguously
+        ov::Tensor tensor(element::f32, targetInputStaticShapes[0]);
+        auto* data = tensor.data<float>();
+        std::iota(data, data + tensor.get_size(), 0.F);
+        std::mt19937 gen(static_cast<unsigned>(tensor.get_size()));
+        std::shuffle(data, data + tensor.get_size(), gen);
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            data[i] *= 0.01F;
+        }
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(TopKSoftmaxCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<InputShape> logitsShapes = {
+    {{}, {{1, 50000}}},
+    {{}, {{4, 1000}}},
+    {{-1, -1}, {{1, 32000}, {3, 150}, {2, 20000}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopKSoftmax,
+                         TopKSoftmaxCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(logitsShapes),
+                                            ::testing::Values(1, 50),
+                                            ::testing::Values(TemperatureOp::NONE,
+                                                              TemperatureOp::MULTIPLY,
+                                                              TemperatureOp::DIVIDE)),
+                         TopKSoftmaxCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
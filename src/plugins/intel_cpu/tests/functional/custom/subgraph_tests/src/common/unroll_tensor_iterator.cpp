@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/tanh.hpp"
+#include "openvino/op/tensor_iterator.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *        X[B, L, C]    H[B, 1, C]
+ *            |             |
+ *   TensorIterator(sliced by axis 1)
+ *   +-------------------------------+
+ *   |    Xi        Hi <--------+    |
+ *   |      \      /            |    |
+ *   |        Add               |    |
+ *   |         |                |    |
+ *   |      Multiply            |    |
+ *   |         |                |    |
+ *   |        Tanh -------------+    |
+ *   +-------------------------------+
+ *       |                   |
+ *  concat by axis 1    last iteration
+ *
+ * A TensorIterator with a static shape and a few iterations is unrolled into the outer graph, a long one is
+ * executed by the TensorIterator node.
+ */
+using UnrollTensorIteratorParams = std::tuple<Shape, bool>;
+
+class UnrollTensorIteratorCPUTest : public testing::WithParamInterface<UnrollTensorIteratorParams>,
+                                    virtual public SubgraphBaseTest,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<UnrollTensorIteratorParams>& obj) {
+        const auto& [shape, unrolled] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_unrolled=" << unrolled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, unrolled] = GetParam();
+        const Shape state_shape{shape[0], 1, shape[2]};
+        init_input_shapes(static_shapes_to_test_representation({shape, state_shape}));
+
+        auto x = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+        auto h = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[1]);
+
+        auto xi = std::make_shared<op::v0::Parameter>(element::f32, state_shape);
+        auto hi = std::make_shared<op::v0::Parameter>(element::f32, state_shape);
+        auto add = std::make_shared<op::v1::Add>(xi, hi);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = std::make_shared<op::v1::Multiply>(add, scale);
+        auto tanh = std::make_shared<op::v0::Tanh>(multiply);
+        auto body_result = std::make_shared<op::v0::Result>(tanh);
+        auto body = std::make_shared<Model>(ResultVector{body_result}, ParameterVector{xi, hi});
+
+        auto tensor_iterator = std::make_shared<op::v0::TensorIterator>();
+        tensor_iterator->set_body(body);
+        tensor_iterator->set_sliced_input(xi, x, 0, 1, 1, -1, 1);
+        tensor_iterator->set_merged_input(hi, h, body_result);
+        auto concat_output = tensor_iterator->get_concatenated_slices(body_result, 0, 1, 1, -1, 1);
+        auto last_output = tensor_iterator->get_iter_value(body_result, -1);
+
+        function = std::make_shared<Model>(OutputVector{concat_output, last_output}, ParameterVector{x, h});
+    }
+};
+
+TEST_P(UnrollTensorIteratorCPUTest, CompareWithRefs) {
+    run();
+    const auto& [shape, unrolled] = GetParam();
+    CheckNumberOfNodesWithType(compiledModel, "TensorIterator", unrolled ? 0 : 1);
+}
+
+/*
+ *        X[B, L, C]    H[B, 1, C]
+ *            |             |
+ *        Loop(trip count L, sliced by axis 1)
+ *   +------------------------------------------+
+ *   |    Xi        Hi <--------+       iter    |
+ *   |      \      /            |        |      |
+ *   |        Add               |     Convert   |
+ *   |         |                |        |      |
+ *   |        Add --------------|--------+      |
+ *   |         |                |               |
+ *   |      Multiply            |  cond = true or iter < 3
+ *   |         |                |               |
+ *   |        Tanh -------------+               |
+ *   +------------------------------------------+
+ *                     |
+ *               last iteration
+ *
+ * A Loop is unrolled only when it always runs for the whole trip count, the one that may exit early through
+ * the body condition is executed by the TensorIterator node. The unrolled body gets the iteration as a scalar, so
+ * the Loop whose iteration of shape {1} is concatenated instead of broadcast is executed by the TensorIterator node
+ * as well.
+ */
+using UnrollLoopParams = std::tuple<Shape, bool, bool, bool>;  // shape, early exit, concatenated iteration, unrolled
+
+class UnrollLoopCPUTest : public testing::WithParamInterface<UnrollLoopParams>,
+                          virtual public SubgraphBaseTest,
+                          public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<UnrollLoopParams>& obj) {
+        const auto& [shape, earlyExit, iterConcat, unrolled] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_earlyExit=" << earlyExit << "_iterConcat=" << iterConcat
+               << "_unrolled=" << unrolled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, earlyExit, iterConcat, unrolled] = GetParam();
+        const Shape state_shape{shape[0], 1, shape[2]};
+        init_input_shapes(static_shapes_to_test_representation({shape, state_shape}));
+
+        auto x = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+        auto h = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[1]);
+
+        auto xi = std::make_shared<op::v0::Parameter>(element::f32, state_shape);
+        auto hi = std::make_shared<op::v0::Parameter>(element::f32, state_shape);
+        auto iter = std::make_shared<op::v0::Parameter>(element::i64, Shape{1});
+        auto add = std::make_shared<op::v1::Add>(xi, hi);
+        std::shared_ptr<Node> iter_f32 = std::make_shared<op::v0::Convert>(iter, element::f32);
+        if (iterConcat) {
+            // the iteration becomes the first channel, the scalar one fails the validation of the Concat
+            auto channels = op::v0::Constant::create(element::f32, Shape{shape[2] - 1}, {1.0f});
+            iter_f32 = std::make_shared<op::v0::Concat>(OutputVector{iter_f32, channels}, 0);
+        }
+        auto add_iter = std::make_shared<op::v1::Add>(add, iter_f32);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = std::make_shared<op::v1::Multiply>(add_iter, scale);
+        auto tanh = std::make_shared<op::v0::Tanh>(multiply);
+        auto body_result = std::make_shared<op::v0::Result>(tanh);
+        std::shared_ptr<Node> cond;
+        if (earlyExit) {
+            cond = std::make_shared<op::v1::Less>(iter, op::v0::Constant::create(element::i64, Shape{1}, {3}));
+        } else {
+            cond = op::v0::Constant::create(element::boolean, Shape{1}, {true});
+        }
+        auto cond_result = std::make_shared<op::v0::Result>(cond);
+        auto body = std::make_shared<Model>(ResultVector{body_result, cond_result}, ParameterVector{xi, hi, iter});
+
+        auto trip_count = op::v0::Constant::create(element::i64, Shape{1}, {static_cast<int64_t>(shape[1])});
+        auto execution_cond = op::v0::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<op::v5::Loop>(trip_count, execution_cond);
+        loop->set_function(body);
+        loop->set_special_body_ports({2, 1});
+        loop->set_sliced_input(xi, x, 0, 1, 1, -1, 1);
+        loop->set_merged_input(hi, h, body_result);
+        auto last_output = loop->get_iter_value(body_result, -1);
+
+        function = std::make_shared<Model>(OutputVector{last_output}, ParameterVector{x, h});
+    }
+};
+
+TEST_P(UnrollLoopCPUTest, CompareWithRefs) {
+    run();
+    const auto& [shape, earlyExit, iterConcat, unrolled] = GetParam();
+    CheckNumberOfNodesWithType(compiledModel, "TensorIterator", unrolled ? 0 : 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_UnrollTensorIterator,
+                         UnrollTensorIteratorCPUTest,
+                         ::testing::Values(UnrollTensorIteratorParams{Shape{2, 4, 16}, true},
+                                           UnrollTensorIteratorParams{Shape{1, 8, 3}, true},
+                                           UnrollTensorIteratorParams{Shape{2, 32, 16}, false}),
+                         UnrollTensorIteratorCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_UnrollLoop,
+                         UnrollLoopCPUTest,
+                         ::testing::Values(UnrollLoopParams{Shape{2, 4, 16}, false, false, true},
+                                           UnrollLoopParams{Shape{2, 8, 16}, true, false, false},
+                                           UnrollLoopParams{Shape{2, 4, 16}, false, true, false},
+                                           UnrollLoopParams{Shape{2, 32, 16}, false, false, false}),
+                         UnrollLoopCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
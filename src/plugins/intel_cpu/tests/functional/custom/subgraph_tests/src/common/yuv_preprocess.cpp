@@ -0,0 +1,182 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <type_traits>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *     Y / UV (or U, V) planes (u8)
+ *                 |
+ *       NV12toRGB / I420toBGR ...
+ *                 |
+ *            Convert(f32)
+ *                 |
+ *     [Interpolate(nearest/linear)]
+ *                 |
+ *         Subtract(mean per channel)
+ *                 |
+ *         Divide(scale per channel)
+ *                 |
+ *           [Transpose(NCHW)]
+ *
+ * The preprocessing chain of the video frames is executed by a single YuvPreprocess node.
+ */
+enum class YuvFormat { NV12_SINGLE_PLANE, NV12_TWO_PLANES, I420_THREE_PLANES };
+enum class ResizeType { NONE, NEAREST, LINEAR };
+
+std::ostream& operator<<(std::ostream& os, YuvFormat format) {
+    switch (format) {
+    case YuvFormat::NV12_SINGLE_PLANE:
+        return os << "NV12_single_plane";
+    case YuvFormat::NV12_TWO_PLANES:
+        return os << "NV12_two_planes";
+    case YuvFormat::I420_THREE_PLANES:
+        return os << "I420_three_planes";
+    }
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os, ResizeType resize) {
+    switch (resize) {
+    case ResizeType::NONE:
+        return os << "None";
+    case ResizeType::NEAREST:
+        return os << "Nearest";
+    case ResizeType::LINEAR:
+        return os << "Linear";
+    }
+    return os;
+}
+
+// image height and width, format, BGR output, resize, planar output
+using YuvPreprocessParams = std::tuple<std::pair<size_t, size_t>, YuvFormat, bool, ResizeType, bool>;
+
+class YuvPreprocessCPUTest : public testing::WithParamInterface<YuvPreprocessParams>,
+                             virtual public SubgraphBaseTest,
+                             public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<YuvPreprocessParams>& obj) {
+        const auto& [image, format, bgr, resize, planar] = obj.param;
+        std::ostringstream result;
+        result << "H=" << image.first << "_W=" << image.second << "_format=" << format << "_bgr=" << bgr
+               << "_resize=" << resize << "_planar=" << planar;
+        return result.str();
+    }
+
+protected:
+    template <typename ColorConvert>
+    static std::shared_ptr<Node> make_color_convert(const OutputVector& planes) {
+        if (planes.size() == 1) {
+            return std::make_shared<ColorConvert>(planes[0]);
+        }
+        // I420 has separate U and V planes
+        if constexpr (std::is_constructible_v<ColorConvert, Output<Node>, Output<Node>, Output<Node>>) {
+            return std::make_shared<ColorConvert>(planes[0], planes[1], planes[2]);
+        } else {
+            return std::make_shared<ColorConvert>(planes[0], planes[1]);
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [image, format, bgr, resize, planar] = GetParam();
+        const auto [height, width] = image;
+        abs_threshold = 1e-3;
+
+        std::vector<InputShape> shapes;
+        if (format == YuvFormat::NV12_SINGLE_PLANE) {
+            shapes.push_back({{}, {{1, height * 3 / 2, width, 1}}});
+        } else {
+            shapes.push_back({{}, {{1, height, width, 1}}});
+            if (format == YuvFormat::NV12_TWO_PLANES) {
+                shapes.push_back({{}, {{1, height / 2, width / 2, 2}}});
+            } else {
+                shapes.push_back({{}, {{1, height / 2, width / 2, 1}}});
+                shapes.push_back({{}, {{1, height / 2, width / 2, 1}}});
+            }
+        }
+        init_input_shapes(shapes);
+
+        ParameterVector params;
+        for (const auto& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<op::v0::Parameter>(element::u8, shape));
+        }
+        const OutputVector planes(params.begin(), params.end());
+        std::shared_ptr<Node> color_convert;
+        if (format == YuvFormat::I420_THREE_PLANES) {
+            color_convert = bgr ? make_color_convert<op::v8::I420toBGR>(planes)
+                                : make_color_convert<op::v8::I420toRGB>(planes);
+        } else {
+            color_convert = bgr ? make_color_convert<op::v8::NV12toBGR>(planes)
+                                : make_color_convert<op::v8::NV12toRGB>(planes);
+        }
+
+        Output<Node> value = std::make_shared<op::v0::Convert>(color_convert, element::f32);
+        if (resize != ResizeType::NONE) {
+            op::v11::Interpolate::InterpolateAttrs attrs;
+            attrs.mode = resize == ResizeType::NEAREST ? op::v11::Interpolate::InterpolateMode::NEAREST
+                                                       : op::v11::Interpolate::InterpolateMode::LINEAR;
+            attrs.shape_calculation_mode = op::v11::Interpolate::ShapeCalcMode::SIZES;
+            attrs.coordinate_transformation_mode = op::v11::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+            attrs.nearest_mode = op::v11::Interpolate::NearestMode::ROUND_PREFER_FLOOR;
+            attrs.pads_begin = {0, 0, 0, 0};
+            attrs.pads_end = {0, 0, 0, 0};
+            auto sizes = op::v0::Constant::create(element::i64, Shape{2}, {int64_t{224}, int64_t{160}});
+            auto axes = op::v0::Constant::create(element::i64, Shape{2}, {int64_t{1}, int64_t{2}});
+            value = std::make_shared<op::v11::Interpolate>(value, sizes, axes, attrs);
+        }
+        auto mean = op::v0::Constant::create(element::f32, Shape{1, 1, 1, 3}, {123.675F, 116.28F, 103.53F});
+        value = std::make_shared<op::v1::Subtract>(value, mean);
+        auto scale = op::v0::Constant::create(element::f32, Shape{1, 1, 1, 3}, {58.395F, 57.12F, 57.375F});
+        value = std::make_shared<op::v1::Divide>(value, scale);
+        if (planar) {
+            auto order = op::v0::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+            value = std::make_shared<op::v1::Transpose>(value, order);
+        }
+        function = std::make_shared<Model>(OutputVector{value}, params, "YuvPreprocess");
+    }
+};
+
+TEST_P(YuvPreprocessCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithTypes(compiledModel, {"ColorConvert", "Interpolate", "Eltwise", "Transpose"}, 0);
+    CheckNumberOfNodesWithType(compiledModel, "YuvPreprocess", 1);
+}
+
+namespace {
+
+const std::vector<std::pair<size_t, size_t>> imageSizes = {{32, 48}, {480, 640}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_YuvPreprocess,
+                         YuvPreprocessCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(imageSizes),
+                                            ::testing::Values(YuvFormat::NV12_SINGLE_PLANE,
+                                                              YuvFormat::NV12_TWO_PLANES,
+                                                              YuvFormat::I420_THREE_PLANES),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ResizeType::NONE,
+                                                              ResizeType::NEAREST,
+                                                              ResizeType::LINEAR),
+                                            ::testing::Bool()),
+                         YuvPreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
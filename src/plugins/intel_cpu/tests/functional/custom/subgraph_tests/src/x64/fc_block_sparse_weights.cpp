@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+/*
+ *     data[M, K]    weights[N, K] (constant, block sparse)
+ *          \          /
+ *        MatMul(transpose_b)
+ *
+ * The weights consist of 16 x 32 blocks, the given share of which is all zeros. The FullyConnected node stores only
+ * the non zero blocks and skips the zero ones when the share is large enough or the weights are marked as pruned
+ * by blocks in the runtime info.
+ */
+using FCBlockSparseWeightsParams = std::tuple<InputShape,
+                                              size_t,        // N
+                                              float,         // share of the zero blocks
+                                              bool,          // runtime info hint
+                                              ElementType>;  // inference precision
+
+class FCBlockSparseWeightsCPUTest : public testing::WithParamInterface<FCBlockSparseWeightsParams>,
+                                    virtual public SubgraphBaseTest,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCBlockSparseWeightsParams>& obj) {
+        const auto& [shape, N, zeroBlocks, hint, precision] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << shape << "_N=" << N << "_zeroBlocks=" << zeroBlocks << "_hint=" << hint
+               << "_inferPrc=" << precision;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [shape, N, zeroBlocks, hint, precision] = GetParam();
+        if (precision == ElementType::bf16 && !ov::with_cpu_x86_bfloat16()) {
+            GTEST_SKIP();
+        }
+        init_input_shapes({shape});
+        configuration.insert({ov::hint::inference_precision(precision)});
+        if (precision == ElementType::bf16) {
+            rel_threshold = 2e-2f;
+        }
+
+        const size_t K = inputDynamicShapes[0].rbegin()->get_length();
+        constexpr size_t N_BLOCK = 16;
+        constexpr size_t K_BLOCK = 32;
+        std::vector<float> weights(N * K);
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t k = 0; k < K; k++) {
+                // spreads the zero blocks evenly over the weights
+                const size_t block = (n / N_BLOCK) * (K / K_BLOCK) + k / K_BLOCK;
+                const bool isZero = static_cast<float>(block * 37 % 8) < zeroBlocks * 8;
+                weights[n * K + k] = isZero ? 0.f : dist(gen);
+            }
+        }
+
+        auto data = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+        auto weights_const = op::v0::Constant::create(element::f32, Shape{N, K}, weights);
+        auto matmul = std::make_shared<op::v0::MatMul>(data, weights_const, false, true);
+        if (hint) {
+            matmul->get_rt_info()["blockSparseWeights"] = true;
+        }
+        function = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{data});
+
+        const bool blockSparse = ov::with_cpu_x86_avx2() && (zeroBlocks >= 0.5f || (hint && zeroBlocks >= 0.3f));
+        selectedType = blockSparse ? "brgemm_sparse_.*" : "(?!brgemm_sparse).*";
+    }
+};
+
+TEST_P(FCBlockSparseWeightsCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+}
+
+namespace {
+
+const std::vector<InputShape> dataShapes = {
+    {{}, {{1, 256}}},
+    {{}, {{45, 256}}},
+    {{-1, 256}, {{1, 256}, {70, 256}, {3, 256}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCBlockSparseWeights,
+                         FCBlockSparseWeightsCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(dataShapes),
+                                            ::testing::Values(64, 128),
+                                            ::testing::Values(0.75f),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::f32, ElementType::bf16)),
+                         FCBlockSparseWeightsCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCBlockSparseWeights_Hint,
+                         FCBlockSparseWeightsCPUTest,
+                         ::testing::Combine(::testing::Values(dataShapes[1]),
+                                            ::testing::Values(64),
+                                            ::testing::Values(0.375f),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(ElementType::f32)),
+                         FCBlockSparseWeightsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
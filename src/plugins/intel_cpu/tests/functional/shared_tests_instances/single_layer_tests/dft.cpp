@@ -103,7 +103,27 @@ const auto testCase4D =
                        ::testing::ValuesIn(axes_in_type),
                        ::testing::ValuesIn(signal_size_in_type));
 
+/* 1D DFT of the sizes computed by the generic radix 11 and 13 butterflies, Bluestein's algorithm and the frame size
+ * of the speech models */
+
+const std::vector<std::vector<ov::Shape>> input_shapes_planned = {
+    {{2, 40, 3, 2}},
+};
+
+const std::vector<std::vector<int64_t>> signalSizesPlanned1D = {{22}, {26}, {143}, {17}, {34}, {400}};
+
+const auto testCasePlanned1D =
+    ::testing::Combine(::testing::ValuesIn(ov::test::static_shapes_to_test_representation(input_shapes_planned)),
+                       ::testing::Values(ov::element::f32),
+                       ::testing::Values(std::vector<int64_t>{1}),
+                       ::testing::ValuesIn(signalSizesPlanned1D),
+                       ::testing::ValuesIn(op_types),
+                       ::testing::Values(ov::test::utils::DEVICE_CPU),
+                       ::testing::Values(ov::test::utils::InputLayerType::CONSTANT),
+                       ::testing::Values(ov::test::utils::InputLayerType::CONSTANT));
+
 INSTANTIATE_TEST_SUITE_P(smoke_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_TestsDFT_1d_planned, DFTLayerTest, testCasePlanned1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
@@ -15,5 +15,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_STFT_static,
                          STFTLayerTest,
                          STFTLayerTest::GetTestDataForDevice(ov::test::utils::DEVICE_CPU),
                          STFTLayerTest::getTestCaseName);
+
+// The frame sizes computed by Bluestein's algorithm, the generic radix 7 butterfly and the frame size of the speech
+// models
+const std::vector<InputShape> planned_input_shapes = {
+    {{}, {{2, 1000}}},  // 1st input
+    {{}, {{16}}},       // 2nd input
+    {{}, {{}}},         // 3rd input
+    {{}, {{}}}          // 4th input
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_STFT_planned,
+                         STFTLayerTest,
+                         ::testing::Combine(::testing::Values(planned_input_shapes),
+                                            ::testing::Values(17, 34, 56, 400),
+                                            ::testing::Values(160),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::i64),
+                                            ::testing::Values(utils::InputLayerType::CONSTANT),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         STFTLayerTest::getTestCaseName);
 }  // namespace test
 }  // namespace ov
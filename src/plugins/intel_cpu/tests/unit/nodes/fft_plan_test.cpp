@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nodes/common/fft_plan.h"
+#include "openvino/core/parallel.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<float> referenceDft(const std::vector<float>& signal, bool inverse) {
+    const size_t size = signal.size() / 2;
+    std::vector<float> spectrum(signal.size());
+    for (size_t k = 0; k < size; k++) {
+        double re = 0.0;
+        double im = 0.0;
+        for (size_t n = 0; n < size; n++) {
+            const double angle = (inverse ? 2.0 : -2.0) * M_PI * static_cast<double>(k * n % size) /
+                                 static_cast<double>(size);
+            re += signal[2 * n] * std::cos(angle) - signal[2 * n + 1] * std::sin(angle);
+            im += signal[2 * n] * std::sin(angle) + signal[2 * n + 1] * std::cos(angle);
+        }
+        spectrum[2 * k] = static_cast<float>(re);
+        spectrum[2 * k + 1] = static_cast<float>(im);
+    }
+    return spectrum;
+}
+
+std::vector<float> randomSignal(size_t count) {
+    std::mt19937 gen(static_cast<unsigned>(count));
+    std::uniform_real_distribution<float> dist(-1.F, 1.F);
+    std::vector<float> signal(count);
+    for (auto& value : signal) {
+        value = dist(gen);
+    }
+    return signal;
+}
+
+void expectNear(const std::vector<float>& actual, const std::vector<float>& expected, size_t size) {
+    // the error of the FFT grows with the logarithm of the size, the one of the sums with the square root
+    const float tolerance = 1e-4F * std::sqrt(static_cast<float>(size));
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        ASSERT_NEAR(actual[i], expected[i], tolerance) << "size=" << size << " i=" << i;
+    }
+}
+
+class FftPlanTest : public testing::TestWithParam<size_t> {};
+
+}  // namespace
+
+// 7, 11, 13 and their products use the generic butterflies, 17, 34 and 97 use Bluestein's algorithm, 400 is the
+// frame size of the speech models
+TEST_P(FftPlanTest, ComplexMatchesDft) {
+    const size_t size = GetParam();
+    const auto plan = getFftPlan(size);
+    const auto signal = randomSignal(2 * size);
+    std::vector<float> scratch(plan->scratchSize());
+    for (bool inverse : {false, true}) {
+        std::vector<float> spectrum(2 * size);
+        plan->execute(signal.data(), spectrum.data(), scratch.data(), inverse);
+        expectNear(spectrum, referenceDft(signal, inverse), size);
+
+        // in place
+        auto data = signal;
+        plan->execute(data.data(), data.data(), scratch.data(), inverse);
+        expectNear(data, spectrum, size);
+    }
+}
+
+TEST_P(FftPlanTest, RealMatchesDft) {
+    const size_t size = GetParam();
+    const auto plan = getRealFftPlan(size);
+    const auto samples = randomSignal(size);
+    std::vector<float> signal(2 * size, 0.F);
+    for (size_t n = 0; n < size; n++) {
+        signal[2 * n] = samples[n];
+    }
+    auto expected = referenceDft(signal, false);
+    expected.resize(2 * (size / 2 + 1));
+
+    std::vector<float> scratch(plan->scratchSize());
+    std::vector<float> spectrum(2 * (size / 2 + 1));
+    plan->forward(samples.data(), spectrum.data(), scratch.data());
+    expectNear(spectrum, expected, size);
+
+    std::vector<float> restored(size);
+    plan->inverse(spectrum.data(), restored.data(), scratch.data());
+    expectNear(restored, samples, size);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FftPlan,
+                         FftPlanTest,
+                         testing::Values(16, 24, 40, 7, 11, 13, 14, 22, 26, 77, 143, 17, 34, 97, 400),
+                         [](const testing::TestParamInfo<size_t>& info) {
+                             return "size" + std::to_string(info.param);
+                         });
+
+TEST(FftPlanCacheTest, PlanIsShared) {
+    const auto plan = getFftPlan(400);
+    ASSERT_EQ(plan, getFftPlan(400));
+    ASSERT_EQ(plan->size(), 400U);
+}
+
+TEST(FftPlanCacheTest, PlanOutlivesEviction) {
+    const auto plan = getFftPlan(17);
+    // the cache is bounded, so the plans of many other sizes evict the one of size 17
+    for (size_t size = 1000; size < 1100; size++) {
+        getFftPlan(size);
+    }
+    std::vector<float> signal(2 * 17, 1.F);
+    std::vector<float> scratch(plan->scratchSize());
+    plan->execute(signal.data(), signal.data(), scratch.data(), false);
+    ASSERT_NEAR(signal[0], 17.F, 1e-4F);
+    ASSERT_NEAR(signal[1], 17.F, 1e-4F);
+    ASSERT_NEAR(signal[2], 0.F, 1e-4F);
+}
+
+TEST(FftPlanCacheTest, WorkspaceIsReusedByThreads) {
+    const size_t size = 97;
+    const size_t signals = 64;
+    const auto plan = getFftPlan(size);
+    const auto signal = randomSignal(2 * size);
+    std::vector<float> expected(2 * size);
+    std::vector<float> scratch(plan->scratchSize());
+    plan->execute(signal.data(), expected.data(), scratch.data(), false);
+
+    // each thread transforms its signals in its own buffer, which holds the signal and the scratch of the plan
+    FftWorkspace workspace(2 * size + plan->scratchSize());
+    std::vector<float> spectra(signals * 2 * size);
+    ov::parallel_for(signals, [&](size_t i) {
+        float* buffer = workspace.local();
+        std::copy(signal.begin(), signal.end(), buffer);
+        plan->execute(buffer, spectra.data() + i * 2 * size, buffer + 2 * size, false);
+    });
+    for (size_t i = 0; i < signals; i++) {
+        const std::vector<float> spectrum(spectra.begin() + i * 2 * size, spectra.begin() + (i + 1) * 2 * size);
+        expectNear(spectrum, expected, size);
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "nodes/common/nms_engine.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<NmsCandidate> referenceTopK(std::vector<NmsCandidate> candidates, size_t k) {
+    std::sort(candidates.begin(), candidates.end(), [](const NmsCandidate& l, const NmsCandidate& r) {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    });
+    candidates.resize(std::min(k, candidates.size()));
+    return candidates;
+}
+
+// Scores from a small set of values, so many candidates share the same score
+std::vector<NmsCandidate> generateCandidates(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-32, 31);
+    std::vector<NmsCandidate> candidates(count);
+    for (size_t i = 0; i < count; i++) {
+        candidates[i] = {static_cast<float>(dist(gen)) / 16.F, static_cast<int>(i)};
+    }
+    return candidates;
+}
+
+using Box = std::array<float, 4>;  // xMin, yMin, xMax, yMax
+
+std::vector<size_t> referenceNms(const std::vector<Box>& boxes, float iouThreshold, size_t maxKept) {
+    const auto area = [](const Box& b) {
+        return (b[2] - b[0]) * (b[3] - b[1]);
+    };
+    std::vector<size_t> kept;
+    for (size_t i = 0; i < boxes.size() && kept.size() < maxKept; i++) {
+        const bool suppressed = std::any_of(kept.begin(), kept.end(), [&](size_t k) {
+            const float width = std::max(std::min(boxes[i][2], boxes[k][2]) - std::max(boxes[i][0], boxes[k][0]), 0.F);
+            const float height = std::max(std::min(boxes[i][3], boxes[k][3]) - std::max(boxes[i][1], boxes[k][1]), 0.F);
+            const float intersection = width * height;
+            return intersection / (area(boxes[i]) + area(boxes[k]) - intersection) > iouThreshold;
+        });
+        if (!suppressed) {
+            kept.push_back(i);
+        }
+    }
+    return kept;
+}
+
+std::vector<size_t> greedyNms(const std::vector<Box>& boxes, float iouThreshold, size_t maxKept) {
+    GreedyNms nms(iouThreshold, false);
+    nms.resize(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto& b = boxes[i];
+        nms.setBox(i, b[0], b[1], b[2], b[3], (b[2] - b[0]) * (b[3] - b[1]));
+    }
+    return nms.run(maxKept);
+}
+
+}  // namespace
+
+TEST(NmsSelectTopKTest, PartialSort) {
+    const auto candidates = generateCandidates(500, 1);
+    for (size_t k : {1, 10, 499, 500, 600}) {
+        auto selected = candidates;
+        nmsSelectTopK(selected, k);
+        ASSERT_EQ(selected, referenceTopK(candidates, k)) << "k=" << k;
+    }
+}
+
+TEST(NmsSelectTopKTest, RadixSelect) {
+    const auto candidates = generateCandidates(4096, 2);
+    for (size_t k : {1, 100, 1023, 1024, 4095}) {
+        auto selected = candidates;
+        nmsSelectTopK(selected, k);
+        ASSERT_EQ(selected, referenceTopK(candidates, k)) << "k=" << k;
+    }
+}
+
+TEST(NmsSelectTopKTest, TiesAreOrderedByIndex) {
+    for (size_t count : {100, 2048}) {
+        std::vector<NmsCandidate> candidates(count);
+        for (size_t i = 0; i < count; i++) {
+            // the reversed indices check that the ties are not kept in the input order
+            candidates[i] = {i % 2 == 0 ? 0.5F : 0.25F, static_cast<int>(count - 1 - i)};
+        }
+        const size_t k = count / 2 + 10;
+        auto selected = candidates;
+        nmsSelectTopK(selected, k);
+        ASSERT_EQ(selected, referenceTopK(candidates, k)) << "count=" << count;
+    }
+}
+
+TEST(GreedyNmsTest, TileBoundaries) {
+    // Boxes on a line with the step smaller than their width, so each box overlaps the neighbours that may lie in
+    // the next tile
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> width(1.F, 4.F);
+    std::vector<Box> boxes(300);
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const float xMin = static_cast<float>(i % 150);
+        boxes[i] = {xMin, 0.F, xMin + width(gen), 1.F};
+    }
+    for (size_t maxKept : {boxes.size(), size_t{70}}) {
+        ASSERT_EQ(greedyNms(boxes, 0.3F, maxKept), referenceNms(boxes, 0.3F, maxKept)) << "maxKept=" << maxKept;
+    }
+}
+
+TEST(GreedyNmsTest, SuppressionAcrossTiles) {
+    std::vector<Box> boxes(130);
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const float xMin = 10.F * static_cast<float>(i);
+        boxes[i] = {xMin, 0.F, xMin + 1.F, 1.F};
+    }
+    // the last box of the third tile overlaps the first box only
+    boxes[129] = {0.F, 0.F, 1.F, 1.F};
+
+    auto expected = std::vector<size_t>(129);
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] = i;
+    }
+    ASSERT_EQ(greedyNms(boxes, 0.5F, boxes.size()), expected);
+}
+
+TEST(GreedyNmsTest, SuppressedTileIsSkipped) {
+    // The first box suppresses the whole second tile, so the boxes kept from the first tile skip it, and the boxes
+    // of the third tile are checked against all of them
+    std::vector<Box> boxes(192);
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const float xMin = 10.F * static_cast<float>(i);
+        boxes[i] = {xMin, 0.F, xMin + 1.F, 1.F};
+    }
+    for (size_t i = 64; i < 128; i++) {
+        boxes[i] = boxes[0];
+    }
+    for (size_t i = 128; i < 192; i += 2) {
+        boxes[i] = boxes[i - 127];
+    }
+
+    const auto kept = greedyNms(boxes, 0.5F, boxes.size());
+    ASSERT_EQ(kept, referenceNms(boxes, 0.5F, boxes.size()));
+    ASSERT_EQ(kept.size(), 64 + 32);
+    ASSERT_TRUE(std::none_of(kept.begin(), kept.end(), [](size_t i) {
+        return i >= 64 && i < 128;
+    }));
+}
@@ -6,6 +6,7 @@
 
 #include <future>
 
+#include "openvino/runtime/completion_queue.hpp"
 #include "shared_test_classes/base/ov_behavior_test_utils.hpp"
 
 namespace ov {
@@ -122,6 +123,42 @@ TEST_P(OVInferRequestCallbackTests, ImplDoesNotCopyCallback) {
     OV_ASSERT_NO_THROW(req.wait());
 }
 
+TEST_P(OVInferRequestCallbackTests, canDrainCompletionQueueInBatches) {
+    const uint64_t num_requests = 4;
+    std::vector<ov::InferRequest> requests(num_requests);
+    for (auto& req : requests) {
+        OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    }
+    ov::CompletionQueue queue;
+    for (uint64_t iter = 0; iter < 2; iter++) {
+        for (uint64_t i = 0; i < num_requests; i++) {
+            OV_ASSERT_NO_THROW(queue.start_async(requests[i], i));
+        }
+        std::vector<ov::CompletionQueue::Completion> completions;
+        while (queue.pending() > 0) {
+            ASSERT_GT(queue.wait(completions), 0);
+        }
+        ASSERT_EQ(0, queue.wait(completions));
+        ASSERT_EQ(num_requests, completions.size());
+        std::vector<bool> returned(num_requests, false);
+        for (auto& completion : completions) {
+            ASSERT_EQ(nullptr, completion.exception);
+            ASSERT_LT(completion.tag, num_requests);
+            ASSERT_FALSE(returned[completion.tag]);
+            returned[completion.tag] = true;
+            OV_ASSERT_NO_THROW(completion.request.wait());
+        }
+    }
+}
+
+TEST_P(OVInferRequestCallbackTests, completionQueueReturnsNothingOnTimeout) {
+    ov::CompletionQueue queue;
+    std::vector<ov::CompletionQueue::Completion> completions;
+    ASSERT_EQ(0, queue.poll(completions));
+    ASSERT_EQ(0, queue.wait_for(completions, 1, std::chrono::milliseconds{1}));
+    ASSERT_TRUE(completions.empty());
+}
+
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov